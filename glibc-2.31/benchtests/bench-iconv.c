@@ -0,0 +1,286 @@
+/* Measure iconv between UTF-8 and ISO-8859-1, CP1252 and UTF-16.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <errno.h>
+#include <iconv.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench-timing.h"
+#include "json-lib.h"
+
+/* Convert texts with iconv_open (TO, FROM), which uses the direct
+   converter, and with two descriptors through WCHAR_T, which take the
+   same two steps as a conversion through the internal UCS4 format, and
+   report the time per input byte.  The texts are ASCII, mostly ASCII
+   with some Latin-1 letters, or with many characters of CP1252 which
+   are not in ASCII.  */
+
+#define TEXT_CHARS (64 * 1024)
+/* Convert about as many bytes for each text.  */
+#define TOTAL (64 * 1024 * 1024)
+/* The size of the intermediate buffer of the two steps, as that of
+   the steps of one descriptor.  */
+#define PIVOT_CHARS 8160
+
+struct bench_pair
+{
+  const char *from;
+  const char *to;
+};
+
+static const struct bench_pair pairs[] =
+{
+  { "UTF-8", "ISO-8859-1" },
+  { "ISO-8859-1", "UTF-8" },
+  { "UTF-8", "CP1252" },
+  { "CP1252", "UTF-8" },
+  { "UTF-8", "UTF-16LE" },
+  { "UTF-16LE", "UTF-8" }
+};
+
+struct bench_text
+{
+  const char *name;
+  /* One in RARE characters is one of the NOTHER characters of OTHER,
+     which are in UTF-8.  */
+  unsigned int rare;
+  const char *const *other;
+  size_t nother;
+  /* Nonzero if all the characters are in ISO-8859-1.  */
+  int latin1;
+};
+
+static const char *const latin1_letters[] =
+  { "\xc3\xa9", "\xc3\xa8", "\xc3\xa0", "\xc3\xb6", "\xc3\xbc",
+    "\xc3\x9f" };
+static const char *const cp1252_chars[] =
+  { "\xe2\x82\xac", "\xc3\xa9", "\xe2\x80\x9c", "\xe2\x80\x9d",
+    "\xc3\xb1" };
+
+static const struct bench_text texts[] =
+{
+  { "ascii", 0, NULL, 0, 1 },
+  { "latin1", 16, latin1_letters,
+    sizeof (latin1_letters) / sizeof (latin1_letters[0]), 1 },
+  { "cp1252", 4, cp1252_chars,
+    sizeof (cp1252_chars) / sizeof (cp1252_chars[0]), 0 }
+};
+
+static uint32_t rand_state = 42;
+
+static uint32_t
+next_rand (void)
+{
+  /* xorshift32, so that runs are reproducible.  */
+  rand_state ^= rand_state << 13;
+  rand_state ^= rand_state >> 17;
+  rand_state ^= rand_state << 5;
+  return rand_state;
+}
+
+static char *utf8_text;
+static size_t utf8_len;
+static char *in_buf;
+static size_t in_len;
+static char *out_buf;
+static size_t out_size;
+static wchar_t pivot_buf[PIVOT_CHARS];
+
+/* Fill UTF8_TEXT with TEXT_CHARS characters of TEXT.  */
+static void
+make_text (const struct bench_text *text)
+{
+  char *p = utf8_text;
+
+  for (size_t i = 0; i < TEXT_CHARS; i++)
+    {
+      uint32_t r = next_rand ();
+      if (text->rare != 0 && r % text->rare == 0)
+	{
+	  const char *o = text->other[(r >> 8) % text->nother];
+	  p = stpcpy (p, o);
+	}
+      else
+	*p++ = (r >> 8) % 64 == 0 ? ' ' : 'a' + (r >> 16) % 26;
+    }
+  utf8_len = p - utf8_text;
+}
+
+/* Convert N bytes at IN with CD into OUT_BUF and return the number of
+   bytes written.  */
+static size_t
+convert_direct (iconv_t cd, char *in, size_t n)
+{
+  char *out = out_buf;
+  size_t outleft = out_size;
+
+  iconv (cd, NULL, NULL, NULL, NULL);
+  if (iconv (cd, &in, &n, &out, &outleft) == (size_t) -1)
+    {
+      perror ("iconv");
+      exit (1);
+    }
+  return out - out_buf;
+}
+
+/* Likewise with TO_WCHAR and FROM_WCHAR in turn.  */
+static size_t
+convert_pivot (iconv_t to_wchar, iconv_t from_wchar, char *in, size_t n)
+{
+  char *out = out_buf;
+  size_t outleft = out_size;
+
+  iconv (to_wchar, NULL, NULL, NULL, NULL);
+  iconv (from_wchar, NULL, NULL, NULL, NULL);
+  while (n > 0)
+    {
+      char *wptr = (char *) pivot_buf;
+      size_t wleft = sizeof (pivot_buf);
+      if (iconv (to_wchar, &in, &n, &wptr, &wleft) == (size_t) -1
+	  && errno != E2BIG)
+	{
+	  perror ("iconv");
+	  exit (1);
+	}
+
+      char *wstart = (char *) pivot_buf;
+      wleft = wptr - wstart;
+      if (iconv (from_wchar, &wstart, &wleft, &out, &outleft) == (size_t) -1)
+	{
+	  perror ("iconv");
+	  exit (1);
+	}
+    }
+  return out - out_buf;
+}
+
+static void
+do_one_test (json_ctx_t *json_ctx, const char *variant, iconv_t cd,
+	     iconv_t to_wchar, iconv_t from_wchar)
+{
+  timing_t start, stop, cur;
+  size_t iters = TOTAL / in_len + 1;
+
+  /* Warm up the caches and the branch predictors.  */
+  if (cd != (iconv_t) -1)
+    convert_direct (cd, in_buf, in_len);
+  else
+    convert_pivot (to_wchar, from_wchar, in_buf, in_len);
+
+  TIMING_NOW (start);
+  for (size_t i = 0; i < iters; i++)
+    if (cd != (iconv_t) -1)
+      convert_direct (cd, in_buf, in_len);
+    else
+      convert_pivot (to_wchar, from_wchar, in_buf, in_len);
+  TIMING_NOW (stop);
+  TIMING_DIFF (cur, start, stop);
+
+  json_attr_double (json_ctx, variant,
+		    (double) cur / ((double) iters * in_len));
+}
+
+static iconv_t
+xiconv_open (const char *to, const char *from)
+{
+  iconv_t cd = iconv_open (to, from);
+  if (cd == (iconv_t) -1)
+    {
+      fprintf (stderr, "iconv_open (\"%s\", \"%s\"): %m\n", to, from);
+      exit (1);
+    }
+  return cd;
+}
+
+int
+main (void)
+{
+  /* Each character takes at most three bytes in UTF-8 and four in
+     UTF-16.  */
+  utf8_text = malloc (3 * TEXT_CHARS);
+  in_buf = malloc (4 * TEXT_CHARS);
+  out_size = 4 * TEXT_CHARS;
+  out_buf = malloc (out_size);
+  if (utf8_text == NULL || in_buf == NULL || out_buf == NULL)
+    {
+      perror ("malloc");
+      exit (1);
+    }
+
+  json_ctx_t json_ctx;
+  json_init (&json_ctx, 0, stdout);
+  json_document_begin (&json_ctx);
+  json_attr_string (&json_ctx, "timing_type", TIMING_TYPE);
+  json_attr_object_begin (&json_ctx, "functions");
+  json_attr_object_begin (&json_ctx, "iconv");
+
+  for (size_t p = 0; p < sizeof (pairs) / sizeof (pairs[0]); p++)
+    {
+      const struct bench_pair *b = &pairs[p];
+      char name[64];
+      snprintf (name, sizeof (name), "%s-%s", b->from, b->to);
+
+      iconv_t cd = xiconv_open (b->to, b->from);
+      iconv_t to_wchar = xiconv_open ("WCHAR_T", b->from);
+      iconv_t from_wchar = xiconv_open (b->to, "WCHAR_T");
+      iconv_t from_utf8 = xiconv_open (b->from, "UTF-8");
+
+      json_array_begin (&json_ctx, name);
+      for (size_t t = 0; t < sizeof (texts) / sizeof (texts[0]); t++)
+	{
+	  if (!texts[t].latin1
+	      && (strcmp (b->from, "ISO-8859-1") == 0
+		  || strcmp (b->to, "ISO-8859-1") == 0))
+	    continue;
+
+	  make_text (&texts[t]);
+	  char *u = utf8_text;
+	  size_t ulen = utf8_len;
+	  char *in = in_buf;
+	  size_t inleft = 4 * TEXT_CHARS;
+	  if (iconv (from_utf8, &u, &ulen, &in, &inleft) == (size_t) -1)
+	    {
+	      perror ("iconv");
+	      exit (1);
+	    }
+	  in_len = in - in_buf;
+
+	  json_element_object_begin (&json_ctx);
+	  json_attr_string (&json_ctx, "text", texts[t].name);
+	  json_attr_uint (&json_ctx, "length", in_len);
+	  do_one_test (&json_ctx, "direct", cd, NULL, NULL);
+	  do_one_test (&json_ctx, "pivot", (iconv_t) -1, to_wchar,
+		       from_wchar);
+	  json_element_object_end (&json_ctx);
+	}
+      json_array_end (&json_ctx);
+
+      iconv_close (cd);
+      iconv_close (to_wchar);
+      iconv_close (from_wchar);
+      iconv_close (from_utf8);
+    }
+
+  json_attr_object_end (&json_ctx);
+  json_attr_object_end (&json_ctx);
+  json_document_end (&json_ctx);
+  return 0;
+}
@@ -0,0 +1,197 @@
+/* Measure the libmvec array functions.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench-timing.h"
+#include "json-lib.h"
+
+/* Apply every function to arrays of inputs drawn uniformly from the
+   range in which it is usually called, once with a loop calling the
+   scalar function and once with the array function, and report the
+   time per element.  The sizes go from arrays which fit in the L1 cache
+   to arrays which only fit in memory.  */
+
+#ifdef __x86_64__
+
+#include <mathvec.h>
+
+#define MAX_NELEM (4 * 1024 * 1024)
+/* Process about as many elements for each size.  */
+#define TOTAL (16 * 1024 * 1024)
+
+static const size_t sizes[] = { 1024, 64 * 1024, MAX_NELEM };
+
+static double *in_d, *in2_d, *out_d;
+static float *in_f, *in2_f, *out_f;
+
+struct bench_func
+{
+  const char *name;
+  double lo;
+  double hi;
+  void (*scalar) (size_t);
+  void (*array) (size_t);
+};
+
+/* Define the scalar loop and the array call for the function FUNC
+   taking one (v) or two (vv) arguments of the type with suffix SFX.  */
+#define BENCH(func, sfx, nargs)						\
+  static void								\
+  func##_scalar (size_t n)						\
+  {									\
+    for (size_t i = 0; i < n; i++)					\
+      out_##sfx[i] = CALL_##nargs (func, in_##sfx[i], in2_##sfx[i]);	\
+  }									\
+  static void								\
+  func##_array (size_t n)						\
+  {									\
+    ARRAY_##nargs (v##func, sfx, n);					\
+  }
+#define CALL_v(f, x, y) f (x)
+#define CALL_vv(f, x, y) f (x, y)
+#define ARRAY_v(f, sfx, n) f (out_##sfx, in_##sfx, n)
+#define ARRAY_vv(f, sfx, n) f (out_##sfx, in_##sfx, in2_##sfx, n)
+
+#define BENCH_BOTH(func, nargs)						\
+  BENCH (func, d, nargs)						\
+  BENCH (func##f, f, nargs)
+
+BENCH_BOTH (sin, v)
+BENCH_BOTH (exp, v)
+BENCH_BOTH (log, v)
+BENCH_BOTH (pow, vv)
+BENCH_BOTH (tan, v)
+BENCH_BOTH (atan2, vv)
+BENCH_BOTH (tanh, v)
+
+#define ENTRY(func, lo, hi)						\
+  { #func, lo, hi, func##_scalar, func##_array },			\
+  { #func "f", lo, hi, func##f_scalar, func##f_array }
+
+static const struct bench_func funcs[] =
+{
+  ENTRY (sin, -10.0, 10.0),
+  ENTRY (exp, -60.0, 60.0),
+  ENTRY (log, 0x1p-20, 0x1p20),
+  ENTRY (pow, 0.5, 10.0),
+  ENTRY (tan, -10.0, 10.0),
+  ENTRY (atan2, -10.0, 10.0),
+  ENTRY (tanh, -10.0, 10.0)
+};
+
+static uint32_t rand_state = 42;
+
+static double
+next_rand (double lo, double hi)
+{
+  /* xorshift32, so that runs are reproducible.  */
+  rand_state ^= rand_state << 13;
+  rand_state ^= rand_state >> 17;
+  rand_state ^= rand_state << 5;
+  return lo + (hi - lo) * (rand_state / 4294967296.0);
+}
+
+static void
+do_one_test (json_ctx_t *json_ctx, const char *variant,
+	     void (*fn) (size_t), size_t n)
+{
+  timing_t start, stop, cur;
+  size_t iters = TOTAL / n;
+
+  /* Warm up the caches and the branch predictors.  */
+  fn (n);
+  TIMING_NOW (start);
+  for (size_t i = 0; i < iters; i++)
+    fn (n);
+  TIMING_NOW (stop);
+  TIMING_DIFF (cur, start, stop);
+
+  json_attr_double (json_ctx, variant, (double) cur / ((double) iters * n));
+}
+
+static void *
+xalloc (size_t size)
+{
+  void *p;
+  if (posix_memalign (&p, 64, size) != 0)
+    {
+      perror ("posix_memalign");
+      exit (1);
+    }
+  return p;
+}
+
+int
+main (void)
+{
+  in_d = xalloc (MAX_NELEM * sizeof (double));
+  in2_d = xalloc (MAX_NELEM * sizeof (double));
+  out_d = xalloc (MAX_NELEM * sizeof (double));
+  in_f = xalloc (MAX_NELEM * sizeof (float));
+  in2_f = xalloc (MAX_NELEM * sizeof (float));
+  out_f = xalloc (MAX_NELEM * sizeof (float));
+
+  json_ctx_t json_ctx;
+  json_init (&json_ctx, 0, stdout);
+  json_document_begin (&json_ctx);
+  json_attr_string (&json_ctx, "timing_type", TIMING_TYPE);
+  json_attr_object_begin (&json_ctx, "functions");
+
+  for (size_t f = 0; f < sizeof (funcs) / sizeof (funcs[0]); f++)
+    {
+      const struct bench_func *b = &funcs[f];
+      for (size_t i = 0; i < MAX_NELEM; i++)
+	{
+	  in_d[i] = next_rand (b->lo, b->hi);
+	  in2_d[i] = next_rand (b->lo, b->hi);
+	  in_f[i] = in_d[i];
+	  in2_f[i] = in2_d[i];
+	}
+
+      json_attr_object_begin (&json_ctx, b->name);
+      json_array_begin (&json_ctx, "results");
+      for (size_t s = 0; s < sizeof (sizes) / sizeof (sizes[0]); s++)
+	{
+	  json_element_object_begin (&json_ctx);
+	  json_attr_uint (&json_ctx, "length", sizes[s]);
+	  do_one_test (&json_ctx, "scalar", b->scalar, sizes[s]);
+	  do_one_test (&json_ctx, "array", b->array, sizes[s]);
+	  json_element_object_end (&json_ctx);
+	}
+      json_array_end (&json_ctx);
+      json_attr_object_end (&json_ctx);
+    }
+
+  json_attr_object_end (&json_ctx);
+  json_document_end (&json_ctx);
+  return 0;
+}
+
+#else
+
+int
+main (void)
+{
+  return 0;
+}
+
+#endif
@@ -0,0 +1,232 @@
+/* Measure the x86_64 libmvec vector math functions.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "bench-timing.h"
+#include "json-lib.h"
+
+/* Apply every function to an array of NELEM inputs drawn uniformly from
+   the range in which it is usually called, with the scalar function and
+   with each vector variant the processor supports, and report the time
+   per element.  The vector variants are called through their vector ABI
+   names, as code vectorized by the compiler does.  */
+
+#define NELEM 4096
+#define ITERS 256
+
+#ifdef __x86_64__
+
+typedef double v2df __attribute__ ((vector_size (16)));
+typedef double v4df __attribute__ ((vector_size (32)));
+typedef double v8df __attribute__ ((vector_size (64)));
+typedef float v4sf __attribute__ ((vector_size (16)));
+typedef float v8sf __attribute__ ((vector_size (32)));
+typedef float v16sf __attribute__ ((vector_size (64)));
+
+static double in_d[NELEM] __attribute__ ((aligned (64)));
+static double in2_d[NELEM] __attribute__ ((aligned (64)));
+static double out_d[NELEM] __attribute__ ((aligned (64)));
+static float in_f[NELEM] __attribute__ ((aligned (64)));
+static float in2_f[NELEM] __attribute__ ((aligned (64)));
+static float out_f[NELEM] __attribute__ ((aligned (64)));
+
+typedef void (*loop_fn) (void);
+
+/* Define the scalar loop and the loop for the vector variant with
+   prefix ISA and VLEN elements of type VT, for the function FUNC taking
+   one (v) or two (vv) arguments.  */
+#define LOOP_SCALAR(func, sfx, nargs)					\
+  static void								\
+  func##_scalar (void)							\
+  {									\
+    for (size_t i = 0; i < NELEM; i++)					\
+      out_##sfx[i] = CALL_##nargs (func, in_##sfx[i], in2_##sfx[i]);	\
+  }
+#define LOOP_VECTOR(func, sfx, vt, isa, vlen, nargs, features)		\
+  extern vt _ZGV##isa##N##vlen##nargs##_##func (ARGS_##nargs (vt));	\
+  static void __attribute__ ((target (features)))			\
+  func##_##isa (void)							\
+  {									\
+    for (size_t i = 0; i < NELEM; i += vlen)				\
+      {									\
+	vt x, y;							\
+	memcpy (&x, &in_##sfx[i], sizeof (x));				\
+	memcpy (&y, &in2_##sfx[i], sizeof (y));				\
+	x = CALL_##nargs (_ZGV##isa##N##vlen##nargs##_##func, x, y);	\
+	memcpy (&out_##sfx[i], &x, sizeof (x));				\
+      }									\
+  }
+#define CALL_v(f, x, y) f (x)
+#define CALL_vv(f, x, y) f (x, y)
+#define ARGS_v(t) t
+#define ARGS_vv(t) t, t
+
+#define BENCH_DOUBLE(func, nargs)					\
+  LOOP_SCALAR (func, d, nargs)						\
+  LOOP_VECTOR (func, d, v2df, b, 2, nargs, "sse4.1")			\
+  LOOP_VECTOR (func, d, v4df, d, 4, nargs, "avx2")			\
+  LOOP_VECTOR (func, d, v8df, e, 8, nargs, "avx512f")
+#define BENCH_FLOAT(func, nargs)					\
+  LOOP_SCALAR (func, f, nargs)						\
+  LOOP_VECTOR (func, f, v4sf, b, 4, nargs, "sse4.1")			\
+  LOOP_VECTOR (func, f, v8sf, d, 8, nargs, "avx2")			\
+  LOOP_VECTOR (func, f, v16sf, e, 16, nargs, "avx512f")
+#define BENCH_BOTH(func, nargs)						\
+  BENCH_DOUBLE (func, nargs)						\
+  BENCH_FLOAT (func##f, nargs)
+
+BENCH_BOTH (exp, v)
+BENCH_BOTH (log, v)
+BENCH_BOTH (pow, vv)
+BENCH_BOTH (tan, v)
+BENCH_BOTH (atan, v)
+BENCH_BOTH (atan2, vv)
+BENCH_BOTH (exp2, v)
+BENCH_BOTH (log2, v)
+BENCH_BOTH (log10, v)
+BENCH_BOTH (log1p, v)
+BENCH_BOTH (expm1, v)
+BENCH_BOTH (sinh, v)
+BENCH_BOTH (cosh, v)
+BENCH_BOTH (tanh, v)
+BENCH_BOTH (cbrt, v)
+BENCH_BOTH (erf, v)
+
+struct bench_func
+{
+  const char *name;
+  double lo;
+  double hi;
+  loop_fn scalar;
+  loop_fn sse;
+  loop_fn avx2;
+  loop_fn avx512;
+};
+
+#define ENTRY(func, lo, hi)						\
+  { #func, lo, hi, func##_scalar, func##_b, func##_d, func##_e },	\
+  { #func "f", lo, hi, func##f_scalar, func##f_b, func##f_d,		\
+    func##f_e }
+
+static const struct bench_func funcs[] =
+{
+  ENTRY (exp, -60.0, 60.0),
+  ENTRY (log, 0x1p-20, 0x1p20),
+  ENTRY (pow, 0.5, 10.0),
+  ENTRY (tan, -10.0, 10.0),
+  ENTRY (atan, -10.0, 10.0),
+  ENTRY (atan2, -10.0, 10.0),
+  ENTRY (exp2, -60.0, 60.0),
+  ENTRY (log2, 0x1p-20, 0x1p20),
+  ENTRY (log10, 0x1p-20, 0x1p20),
+  ENTRY (log1p, -0.5, 100.0),
+  ENTRY (expm1, -20.0, 20.0),
+  ENTRY (sinh, -20.0, 20.0),
+  ENTRY (cosh, -20.0, 20.0),
+  ENTRY (tanh, -10.0, 10.0),
+  ENTRY (cbrt, -1000.0, 1000.0),
+  ENTRY (erf, -5.0, 5.0)
+};
+
+static uint32_t rand_state = 42;
+
+static double
+next_rand (double lo, double hi)
+{
+  /* xorshift32, so that runs are reproducible.  */
+  rand_state ^= rand_state << 13;
+  rand_state ^= rand_state >> 17;
+  rand_state ^= rand_state << 5;
+  return lo + (hi - lo) * (rand_state / 4294967296.0);
+}
+
+static void
+do_one_test (json_ctx_t *json_ctx, const char *variant, loop_fn fn)
+{
+  timing_t start, stop, cur;
+
+  /* Warm up the caches and the branch predictors.  */
+  fn ();
+  TIMING_NOW (start);
+  for (int i = 0; i < ITERS; i++)
+    fn ();
+  TIMING_NOW (stop);
+  TIMING_DIFF (cur, start, stop);
+
+  json_attr_double (json_ctx, variant,
+		    (double) cur / ((double) ITERS * NELEM));
+}
+
+int
+main (void)
+{
+  __builtin_cpu_init ();
+  bool have_sse = __builtin_cpu_supports ("sse4.1");
+  bool have_avx2 = __builtin_cpu_supports ("avx2");
+  bool have_avx512 = __builtin_cpu_supports ("avx512f");
+
+  json_ctx_t json_ctx;
+  json_init (&json_ctx, 0, stdout);
+  json_document_begin (&json_ctx);
+  json_attr_string (&json_ctx, "timing_type", TIMING_TYPE);
+  json_attr_object_begin (&json_ctx, "functions");
+
+  for (size_t f = 0; f < sizeof (funcs) / sizeof (funcs[0]); f++)
+    {
+      const struct bench_func *b = &funcs[f];
+      for (size_t i = 0; i < NELEM; i++)
+	{
+	  in_d[i] = next_rand (b->lo, b->hi);
+	  in2_d[i] = next_rand (b->lo, b->hi);
+	  in_f[i] = in_d[i];
+	  in2_f[i] = in2_d[i];
+	}
+
+      json_attr_object_begin (&json_ctx, b->name);
+      json_attr_string (&json_ctx, "bench-variant", "default");
+      json_attr_double (&json_ctx, "lo", b->lo);
+      json_attr_double (&json_ctx, "hi", b->hi);
+      do_one_test (&json_ctx, "scalar", b->scalar);
+      if (have_sse)
+	do_one_test (&json_ctx, "sse4", b->sse);
+      if (have_avx2)
+	do_one_test (&json_ctx, "avx2", b->avx2);
+      if (have_avx512)
+	do_one_test (&json_ctx, "avx512", b->avx512);
+      json_attr_object_end (&json_ctx);
+    }
+
+  json_attr_object_end (&json_ctx);
+  json_document_end (&json_ctx);
+  return 0;
+}
+
+#else
+
+int
+main (void)
+{
+  return 0;
+}
+
+#endif
@@ -0,0 +1,200 @@
+/* Measure qsort function.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench-timing.h"
+#include "json-lib.h"
+
+/* Sort arrays of NMEMB elements for each element size and input
+   pattern below.  The default maximum keeps a run short; pass a larger
+   maximum (e.g. 100000000) on the command line to measure the large
+   sizes as well.  */
+
+#define DEFAULT_MAX_NMEMB 1000000
+
+/* Total number of elements to sort per measurement, so that small
+   arrays are sorted many times.  */
+#define ELEMS_PER_RUN 4000000
+
+typedef enum
+{
+  Sorted,
+  Reverse,
+  FewUnique,
+  Random
+} pattern_t;
+
+static const char *const pattern_names[] =
+{
+  "sorted", "reverse", "few-unique", "random"
+};
+
+static const size_t element_sizes[] = { 4, 8, 16, 32 };
+
+static uint32_t rand_state = 42;
+
+static uint32_t
+next_rand (void)
+{
+  /* xorshift32, so that runs are reproducible.  */
+  rand_state ^= rand_state << 13;
+  rand_state ^= rand_state >> 17;
+  rand_state ^= rand_state << 5;
+  return rand_state;
+}
+
+static void
+fill_array (unsigned char *array, size_t nmemb, size_t size,
+	    pattern_t pattern)
+{
+  memset (array, 0, nmemb * size);
+  for (size_t i = 0; i < nmemb; i++)
+    {
+      uint32_t key;
+      switch (pattern)
+	{
+	case Sorted:
+	  key = i;
+	  break;
+	case Reverse:
+	  key = nmemb - i;
+	  break;
+	case FewUnique:
+	  key = next_rand () % 16;
+	  break;
+	case Random:
+	default:
+	  key = next_rand ();
+	  break;
+	}
+      memcpy (array + i * size, &key, sizeof (key));
+    }
+}
+
+static int
+compare (const void *a, const void *b)
+{
+  uint32_t ka, kb;
+  memcpy (&ka, a, sizeof (ka));
+  memcpy (&kb, b, sizeof (kb));
+  return (ka > kb) - (ka < kb);
+}
+
+/* Sort with qsort, or with the typed sort functions for the element
+   sizes they support if TYPED is true.  */
+static void
+do_sort (unsigned char *array, size_t nmemb, size_t size, bool typed)
+{
+  if (typed && size == sizeof (uint32_t))
+    qsort_u32 ((uint32_t *) array, nmemb);
+  else if (typed && size == sizeof (uint64_t))
+    qsort_u64 ((uint64_t *) array, nmemb);
+  else
+    qsort (array, nmemb, size, compare);
+}
+
+static void
+do_one_test (json_ctx_t *json_ctx, unsigned char *array,
+	     unsigned char *input, size_t nmemb, size_t size,
+	     pattern_t pattern, bool typed)
+{
+  timing_t start, stop, cur, total = 0;
+  size_t runs = ELEMS_PER_RUN / nmemb;
+  if (runs == 0)
+    runs = 1;
+
+  fill_array (input, nmemb, size, pattern);
+  for (size_t i = 0; i < runs; i++)
+    {
+      memcpy (array, input, nmemb * size);
+      TIMING_NOW (start);
+      do_sort (array, nmemb, size, typed);
+      TIMING_NOW (stop);
+      TIMING_DIFF (cur, start, stop);
+      TIMING_ACCUM (total, cur);
+    }
+
+  json_element_object_begin (json_ctx);
+  json_attr_uint (json_ctx, "nmemb", nmemb);
+  json_attr_uint (json_ctx, "size", size);
+  json_attr_string (json_ctx, "pattern", pattern_names[pattern]);
+  json_attr_double (json_ctx, "timing", (double) total / (double) runs);
+  json_element_object_end (json_ctx);
+}
+
+int
+main (int argc, char **argv)
+{
+  size_t max_nmemb = DEFAULT_MAX_NMEMB;
+  if (argc > 1)
+    max_nmemb = strtoul (argv[1], NULL, 0);
+
+  size_t max_size = element_sizes[sizeof (element_sizes)
+				  / sizeof (element_sizes[0]) - 1];
+  unsigned char *array = malloc (max_nmemb * max_size);
+  unsigned char *input = malloc (max_nmemb * max_size);
+  if (array == NULL || input == NULL)
+    {
+      fprintf (stderr, "out of memory\n");
+      return 1;
+    }
+
+  json_ctx_t json_ctx;
+  json_init (&json_ctx, 0, stdout);
+  json_document_begin (&json_ctx);
+  json_attr_string (&json_ctx, "timing_type", TIMING_TYPE);
+  json_attr_object_begin (&json_ctx, "functions");
+  json_attr_object_begin (&json_ctx, "qsort");
+  json_attr_string (&json_ctx, "bench-variant", "default");
+  json_array_begin (&json_ctx, "results");
+
+  for (size_t s = 0; s < sizeof (element_sizes) / sizeof (element_sizes[0]);
+       s++)
+    for (size_t nmemb = 10; nmemb <= max_nmemb; nmemb *= 10)
+      for (pattern_t pattern = Sorted; pattern <= Random; pattern++)
+	do_one_test (&json_ctx, array, input, nmemb, element_sizes[s],
+		     pattern, false);
+
+  json_array_end (&json_ctx);
+  json_attr_object_end (&json_ctx);
+
+  /* The typed sort functions, to compare against the results of qsort
+     for the 4 and 8 byte elements above.  */
+  json_attr_object_begin (&json_ctx, "qsort_u32_u64");
+  json_attr_string (&json_ctx, "bench-variant", "default");
+  json_array_begin (&json_ctx, "results");
+
+  for (size_t size = sizeof (uint32_t); size <= sizeof (uint64_t);
+       size *= 2)
+    for (size_t nmemb = 10; nmemb <= max_nmemb; nmemb *= 10)
+      for (pattern_t pattern = Sorted; pattern <= Random; pattern++)
+	do_one_test (&json_ctx, array, input, nmemb, size, pattern, true);
+
+  json_array_end (&json_ctx);
+  json_attr_object_end (&json_ctx);
+  json_attr_object_end (&json_ctx);
+  json_document_end (&json_ctx);
+
+  free (array);
+  free (input);
+  return 0;
+}
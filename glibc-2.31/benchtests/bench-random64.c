@@ -0,0 +1,127 @@
+/* Measure random and random64 with several threads.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench-timing.h"
+#include "json-lib.h"
+
+/* Every thread draws NUM_VALUES numbers, so the timing per value stays
+   constant if the threads do not interfere with each other.  random
+   takes a global lock and degrades with the number of threads, while
+   random64 uses per-thread state.  */
+
+#define NUM_VALUES (1 << 22)
+#define FILL_CHUNK 4096
+
+static const unsigned int thread_counts[] = { 1, 2, 4, 8 };
+
+typedef enum
+{
+  Random,
+  Random64,
+  Random64Fill
+} variant_t;
+
+static const char *const variant_names[] =
+{
+  "random", "random64", "random64_fill"
+};
+
+static void *
+worker (void *closure)
+{
+  variant_t variant = (variant_t) (uintptr_t) closure;
+  uint64_t sum = 0;
+
+  switch (variant)
+    {
+    case Random:
+      for (size_t i = 0; i < NUM_VALUES; i++)
+	sum += random ();
+      break;
+    case Random64:
+      for (size_t i = 0; i < NUM_VALUES; i++)
+	sum += random64 ();
+      break;
+    case Random64Fill:
+      {
+	static __thread uint64_t buf[FILL_CHUNK];
+	for (size_t i = 0; i < NUM_VALUES; i += FILL_CHUNK)
+	  {
+	    random64_fill (buf, FILL_CHUNK);
+	    sum += buf[0];
+	  }
+      }
+      break;
+    }
+
+  return (void *) (uintptr_t) sum;
+}
+
+static void
+do_one_test (json_ctx_t *json_ctx, variant_t variant, unsigned int nthreads)
+{
+  pthread_t threads[nthreads];
+  timing_t start, stop, cur;
+
+  TIMING_NOW (start);
+  for (unsigned int i = 0; i < nthreads; i++)
+    if (pthread_create (&threads[i], NULL, worker,
+			(void *) (uintptr_t) variant) != 0)
+      {
+	fprintf (stderr, "pthread_create failed\n");
+	exit (1);
+      }
+  for (unsigned int i = 0; i < nthreads; i++)
+    pthread_join (threads[i], NULL);
+  TIMING_NOW (stop);
+  TIMING_DIFF (cur, start, stop);
+
+  json_element_object_begin (json_ctx);
+  json_attr_string (json_ctx, "variant", variant_names[variant]);
+  json_attr_uint (json_ctx, "threads", nthreads);
+  json_attr_double (json_ctx, "timing", (double) cur / NUM_VALUES);
+  json_element_object_end (json_ctx);
+}
+
+int
+main (void)
+{
+  json_ctx_t json_ctx;
+  json_init (&json_ctx, 0, stdout);
+  json_document_begin (&json_ctx);
+  json_attr_string (&json_ctx, "timing_type", TIMING_TYPE);
+  json_attr_object_begin (&json_ctx, "functions");
+  json_attr_object_begin (&json_ctx, "random64");
+  json_attr_string (&json_ctx, "bench-variant", "threads");
+  json_array_begin (&json_ctx, "results");
+
+  for (variant_t v = Random; v <= Random64Fill; v++)
+    for (size_t t = 0; t < sizeof (thread_counts) / sizeof (thread_counts[0]);
+	 t++)
+      do_one_test (&json_ctx, v, thread_counts[t]);
+
+  json_array_end (&json_ctx);
+  json_attr_object_end (&json_ctx);
+  json_attr_object_end (&json_ctx);
+  json_document_end (&json_ctx);
+  return 0;
+}
@@ -0,0 +1,106 @@
+/* Case mapping and classification of byte arrays.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#define	__NO_CTYPE
+#include <ctype.h>
+#include <ctype_bulk.h>
+#include <locale/localeinfo.h>
+
+/* The tables of the locale are read once per call.  In most locales
+   the case mappings only change the ASCII letters, which localedef
+   records in _NL_CTYPE_NONASCII_CASE, and then the bytes are mapped in
+   blocks without the tables.  */
+
+static void
+map_bytes (unsigned char *dst, const unsigned char *src, size_t n,
+	   const int32_t *table, locale_t l, unsigned char first)
+{
+  size_t done = 0;
+
+  if (l->__locales[LC_CTYPE]->values[_NL_ITEM_INDEX
+				     (_NL_CTYPE_NONASCII_CASE)].word == 0)
+    done = ctype_bulk_flip_case (dst, src, n, first);
+
+  for (; done < n; ++done)
+    dst[done] = table[src[done]];
+}
+
+void
+__memtolower_l (void *dst, const void *src, size_t n, locale_t l)
+{
+  map_bytes (dst, src, n, l->__ctype_tolower, l, 'A');
+}
+weak_alias (__memtolower_l, memtolower_l)
+
+void
+__memtoupper_l (void *dst, const void *src, size_t n, locale_t l)
+{
+  map_bytes (dst, src, n, l->__ctype_toupper, l, 'a');
+}
+weak_alias (__memtoupper_l, memtoupper_l)
+
+size_t
+__memctype_l (unsigned char *bits, const void *src, size_t n, int mask,
+	      locale_t l)
+{
+  const unsigned char *s = src;
+  const uint16_t *table = l->__ctype_b;
+  size_t count = 0;
+  size_t done;
+
+  /* Eight bytes give one byte of the result.  */
+  for (done = 0; done + 8 <= n; done += 8)
+    {
+      unsigned int b = 0;
+      for (int i = 0; i < 8; ++i)
+	b |= ((table[s[done + i]] & mask) != 0) << i;
+      bits[done / 8] = b;
+      count += __builtin_popcount (b);
+    }
+
+  if (done < n)
+    {
+      unsigned int b = 0;
+      for (int i = 0; done + i < n; ++i)
+	b |= ((table[s[done + i]] & mask) != 0) << i;
+      bits[done / 8] = b;
+      count += __builtin_popcount (b);
+    }
+
+  return count;
+}
+weak_alias (__memctype_l, memctype_l)
+
+
+void
+memtolower (void *dst, const void *src, size_t n)
+{
+  __memtolower_l (dst, src, n, _NL_CURRENT_LOCALE);
+}
+
+void
+memtoupper (void *dst, const void *src, size_t n)
+{
+  __memtoupper_l (dst, src, n, _NL_CURRENT_LOCALE);
+}
+
+size_t
+memctype (unsigned char *bits, const void *src, size_t n, int mask)
+{
+  return __memctype_l (bits, src, n, mask, _NL_CURRENT_LOCALE);
+}
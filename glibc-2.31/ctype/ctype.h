@@ -75,7 +75,12 @@ enum
    for broken old programs.  The case conversion arrays are of `int's
    rather than `unsigned char's because tolower (EOF) must be EOF, which
    doesn't fit into an `unsigned char'.  But today more important is that
-   the arrays are also used for multi-byte character sets.  */
+   the arrays are also used for multi-byte character sets.
+
+   Each thread has its own copy of the pointers, which uselocale sets to
+   the tables of the new locale of the thread, and setlocale to those of
+   the new global locale if the calling thread uses it.  So a loop which
+   does not change the locale may read them once.  */
 extern const unsigned short int **__ctype_b_loc (void)
      __THROW __attribute__ ((__const__));
 extern const __int32_t **__ctype_tolower_loc (void)
@@ -133,6 +138,26 @@ __exctype (isblank);
 #ifdef __USE_GNU
 /* Test C for a set of character classes according to MASK.  */
 extern int isctype (int __c, int __mask) __THROW;
+
+# define __need_size_t
+# include <stddef.h>
+
+/* Store the lowercase versions of the N bytes at SRC, as tolower returns
+   them, at DST, which may be SRC.  */
+extern void memtolower (void *__dst, const void *__src, size_t __n)
+     __THROW __nonnull ((1, 2));
+
+/* Store the uppercase versions of the N bytes at SRC, as toupper returns
+   them, at DST, which may be SRC.  */
+extern void memtoupper (void *__dst, const void *__src, size_t __n)
+     __THROW __nonnull ((1, 2));
+
+/* Set bit I % 8 of BITS[I / 8] if byte I of the N bytes at SRC belongs
+   to a class in MASK, as isctype tells, and clear it otherwise.  The
+   other bits of the last byte are cleared.  Return the number of bytes
+   which belong to a class in MASK.  */
+extern size_t memctype (unsigned char *__bits, const void *__src,
+			size_t __n, int __mask) __THROW __nonnull ((1, 2));
 #endif
 
 #if defined __USE_MISC || defined __USE_XOPEN
@@ -280,6 +305,17 @@ extern int toupper_l (int __c, locale_t __l) __THROW;
 #  define toupper_l(c, locale)	__toupper_l ((c), (locale))
 # endif	/* Optimizing gcc */
 
+# ifdef __USE_GNU
+/* Likewise, using the character classes and case mappings of L.  */
+extern void memtolower_l (void *__dst, const void *__src, size_t __n,
+			  locale_t __l) __THROW __nonnull ((1, 2, 4));
+extern void memtoupper_l (void *__dst, const void *__src, size_t __n,
+			  locale_t __l) __THROW __nonnull ((1, 2, 4));
+extern size_t memctype_l (unsigned char *__bits, const void *__src,
+			  size_t __n, int __mask, locale_t __l)
+     __THROW __nonnull ((1, 2, 5));
+# endif
+
 
 # ifndef __NO_CTYPE
 #  define __isalnum_l(c,l)	__isctype_l((c), _ISalnum, (l))
@@ -0,0 +1,142 @@
+/* Test memtolower, memtoupper and memctype against the single bytes.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+/* The case mappings of the UTF-8 locales and of the C locale only
+   change the ASCII letters, so the bytes are mapped in blocks, while
+   those of the ISO-8859 locales always use the tables.  Compare the
+   results with tolower, toupper and isctype on every byte value, at
+   every length and alignment of the buffers, and in place.  */
+
+#include <ctype.h>
+#include <locale.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <support/check.h>
+
+#define MAXLEN 100
+
+static const char *const locales[] =
+  { "C", "de_DE.UTF-8", "tr_TR.UTF-8", "de_DE.ISO-8859-1",
+    "tr_TR.ISO-8859-9" };
+
+static const int masks[] =
+  { _ISupper, _ISlower, _ISalpha, _ISdigit, _ISxdigit, _ISspace,
+    _ISprint, _ISgraph, _ISblank, _IScntrl, _ISpunct, _ISalnum,
+    _ISupper | _ISdigit };
+
+static void
+check_buffer (const unsigned char *src, size_t n, locale_t l)
+{
+  unsigned char expected[MAXLEN + 1];
+  unsigned char buf[MAXLEN + 1];
+
+  for (size_t i = 0; i < n; ++i)
+    expected[i] = tolower (src[i]);
+  memset (buf, '\xaa', sizeof (buf));
+  memtolower (buf, src, n);
+  TEST_COMPARE_BLOB (buf, n, expected, n);
+  TEST_COMPARE (buf[n], 0xaa);
+  memtolower_l (buf, src, n, l);
+  TEST_COMPARE_BLOB (buf, n, expected, n);
+  memcpy (buf, src, n);
+  memtolower (buf, buf, n);
+  TEST_COMPARE_BLOB (buf, n, expected, n);
+
+  for (size_t i = 0; i < n; ++i)
+    expected[i] = toupper (src[i]);
+  memset (buf, '\xaa', sizeof (buf));
+  memtoupper (buf, src, n);
+  TEST_COMPARE_BLOB (buf, n, expected, n);
+  TEST_COMPARE (buf[n], 0xaa);
+  memtoupper_l (buf, src, n, l);
+  TEST_COMPARE_BLOB (buf, n, expected, n);
+  memcpy (buf, src, n);
+  memtoupper (buf, buf, n);
+  TEST_COMPARE_BLOB (buf, n, expected, n);
+
+  for (size_t m = 0; m < sizeof (masks) / sizeof (masks[0]); ++m)
+    {
+      unsigned char bits[MAXLEN / 8 + 2];
+      unsigned char expected_bits[MAXLEN / 8 + 2];
+      size_t count = 0;
+
+      memset (expected_bits, '\0', sizeof (expected_bits));
+      for (size_t i = 0; i < n; ++i)
+	if (isctype (src[i], masks[m]))
+	  {
+	    expected_bits[i / 8] |= 1 << (i % 8);
+	    ++count;
+	  }
+
+      memset (bits, '\xaa', sizeof (bits));
+      TEST_COMPARE (memctype (bits, src, n, masks[m]), count);
+      TEST_COMPARE_BLOB (bits, (n + 7) / 8, expected_bits, (n + 7) / 8);
+      TEST_COMPARE (bits[(n + 7) / 8], 0xaa);
+      TEST_COMPARE (memctype_l (bits, src, n, masks[m], l), count);
+      TEST_COMPARE_BLOB (bits, (n + 7) / 8, expected_bits, (n + 7) / 8);
+    }
+}
+
+static int
+do_test (void)
+{
+  unsigned char all[256];
+  unsigned char src[MAXLEN + 16];
+
+  for (int c = 0; c < 256; ++c)
+    all[c] = c;
+
+  for (size_t i = 0; i < sizeof (locales) / sizeof (locales[0]); ++i)
+    {
+      if (setlocale (LC_ALL, locales[i]) == NULL)
+	FAIL_EXIT1 ("setlocale (LC_ALL, \"%s\") failed", locales[i]);
+      locale_t l = newlocale (LC_ALL_MASK, locales[i], 0);
+      TEST_VERIFY_EXIT (l != NULL);
+
+      /* Every byte value, in runs which start at each offset.  */
+      for (size_t start = 0; start < 256; start += MAXLEN / 2)
+	check_buffer (all + start, 256 - start < MAXLEN ? 256 - start
+		      : MAXLEN, l);
+
+      srandom (i);
+      for (int iter = 0; iter < 200; ++iter)
+	{
+	  size_t n = random () % (MAXLEN + 1);
+	  size_t align = random () % 16;
+	  for (size_t j = 0; j < n; ++j)
+	    src[align + j] = random () % 2 ? random () % 256 : 'A' + j % 58;
+	  check_buffer (src + align, n, l);
+	}
+
+      /* The _l functions use L, not the locale of the thread.  */
+      locale_t c = newlocale (LC_ALL_MASK, "C", 0);
+      TEST_VERIFY_EXIT (c != NULL);
+      unsigned char buf[256];
+      memtoupper_l (buf, all, 256, c);
+      for (int ch = 0; ch < 256; ++ch)
+	TEST_COMPARE (buf[ch], toupper_l (ch, c));
+      freelocale (c);
+
+      freelocale (l);
+    }
+
+  return 0;
+}
+
+#include <support/test-driver.c>
@@ -25,6 +25,7 @@
 
 /* Collect various system dependent definitions and declarations.  */
 #include <bits/dlfcn.h>
+#include <bits/dl_find_object.h>
 
 
 #ifdef __USE_GNU
@@ -194,6 +195,34 @@ typedef struct
   Dl_serpath dls_serpath[1];	/* Actually longer, dls_cnt elements.  */
 # endif
 } Dl_serinfo;
+
+/* Information about the object containing an address, stored by
+   `_dl_find_object'.  The reserved members are set to zero.  */
+struct dl_find_object
+{
+  __extension__ unsigned long long int dlfo_flags; /* Currently zero.  */
+  void *dlfo_map_start;		/* Beginning of the object's mapping.  */
+  void *dlfo_map_end;		/* End of the object's mapping.  */
+  struct link_map *dlfo_link_map;
+  void *dlfo_eh_frame;		/* Exception handling data, or null.  */
+# if DLFO_STRUCT_HAS_EH_DBASE
+  void *dlfo_eh_dbase;		/* Base address for DW_EH_PE_datarel.  */
+#  if __WORDSIZE == 32
+  unsigned int __dlfo_eh_dbase_pad;
+#  endif
+# endif
+# if DLFO_STRUCT_HAS_EH_COUNT
+  int dlfo_eh_count;		/* Number of exception handling entries.  */
+  unsigned int __dlfo_eh_count_pad;
+# endif
+  __extension__ unsigned long long int __dlfo_reserved[7];
+};
+
+/* If ADDRESS is inside a loaded object, describe that object in
+   *RESULT and return 0, otherwise return -1.  This is meant for
+   unwinders: it takes no lock once the program has started.  */
+extern int _dl_find_object (void *__address,
+			    struct dl_find_object *__result) __THROW;
 #endif /* __USE_GNU */
 
 
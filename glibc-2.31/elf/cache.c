@@ -291,6 +291,109 @@ compare (const struct cache_entry *e1, const struct cache_entry *e2)
   return res;
 }
 
+/* The number of seeds which are tried for a bucket of the hash
+   index.  */
+#define HASH_INDEX_MAX_SEED 0x10000
+
+/* The buckets of the names and their sizes, for compare_buckets.  */
+static const uint32_t *hash_index_bucket;
+static const uint32_t *hash_index_count;
+
+/* Sort the names by bucket, with the large buckets first.  */
+static int
+compare_buckets (const void *p1, const void *p2)
+{
+  uint32_t b1 = hash_index_bucket[*(const uint32_t *) p1];
+  uint32_t b2 = hash_index_bucket[*(const uint32_t *) p2];
+
+  if (hash_index_count[b1] != hash_index_count[b2])
+    return hash_index_count[b1] > hash_index_count[b2] ? -1 : 1;
+  if (b1 != b2)
+    return b1 < b2 ? -1 : 1;
+  return 0;
+}
+
+/* Build the hash index of the NNAMES different library names in NAMES,
+   whose first entries in the new format have the indices in FIRST.
+   Return the index and store its size in *SIZE, or return NULL if no
+   seeds are found for the buckets.  */
+static struct cache_hash_index *
+build_hash_index (const char **names, const uint32_t *first,
+		  uint32_t nnames, size_t *size)
+{
+  uint32_t nseeds = nnames / 4 + 1;
+  uint32_t nslots = nnames + nnames / 4 + 1;
+
+  *size = (sizeof (struct cache_hash_index)
+	   + ((size_t) nseeds + nslots) * sizeof (uint32_t));
+  struct cache_hash_index *index = xcalloc (1, *size);
+  index->nseeds = nseeds;
+  index->nslots = nslots;
+  uint32_t *seeds = index->seeds;
+  uint32_t *slots = &index->seeds[nseeds];
+
+  uint32_t *bucket = xmalloc (nnames * sizeof (uint32_t));
+  uint32_t *count = xcalloc (nseeds, sizeof (uint32_t));
+  uint32_t *order = xmalloc (nnames * sizeof (uint32_t));
+  uint32_t maxcount = 0;
+  for (uint32_t i = 0; i < nnames; ++i)
+    {
+      bucket[i] = _dl_cache_hash_reduce (_dl_cache_hash (names[i], 0),
+					 nseeds);
+      if (++count[bucket[i]] > maxcount)
+	maxcount = count[bucket[i]];
+      order[i] = i;
+    }
+
+  /* The large buckets are placed first, while most slots are free.  */
+  hash_index_bucket = bucket;
+  hash_index_count = count;
+  qsort (order, nnames, sizeof (uint32_t), compare_buckets);
+
+  uint32_t *trial = xmalloc (maxcount * sizeof (uint32_t));
+  for (uint32_t i = 0; i < nnames; )
+    {
+      uint32_t b = bucket[order[i]];
+      uint32_t n = count[b];
+      uint32_t seed;
+
+      for (seed = 1; seed < HASH_INDEX_MAX_SEED; ++seed)
+	{
+	  uint32_t k;
+	  for (k = 0; k < n; ++k)
+	    {
+	      uint32_t h = _dl_cache_hash (names[order[i + k]], seed);
+	      uint32_t slot = _dl_cache_hash_reduce (h, nslots);
+	      if (slots[slot] != 0)
+		break;
+	      slots[slot] = first[order[i + k]] + 1;
+	      trial[k] = slot;
+	    }
+	  if (k == n)
+	    break;
+
+	  /* Undo the assignments and try the next seed.  */
+	  while (k-- > 0)
+	    slots[trial[k]] = 0;
+	}
+
+      if (seed == HASH_INDEX_MAX_SEED)
+	{
+	  free (index);
+	  index = NULL;
+	  break;
+	}
+      seeds[b] = seed;
+      i += n;
+    }
+
+  free (trial);
+  free (order);
+  free (count);
+  free (bucket);
+  return index;
+}
+
 /* Save the contents of the cache.  */
 void
 save_cache (const char *cache_name)
@@ -424,6 +527,40 @@ save_cache (const char *cache_name)
       && idx_old < cache_entry_old_count)
     file_entries->libs[idx_old] = file_entries->libs[idx_old - 1];
 
+  /* Add the hash index to the new format, after the strings.  */
+  struct cache_hash_index *hash_index = NULL;
+  size_t hash_index_size = 0;
+  size_t hash_pad = 0;
+  if (opt_format != 0 && cache_entry_count > 0)
+    {
+      const char **names = xmalloc (cache_entry_count * sizeof (char *));
+      uint32_t *first = xmalloc (cache_entry_count * sizeof (uint32_t));
+      uint32_t nnames = 0;
+
+      for (idx_new = 0, entry = entries; entry != NULL;
+	   entry = entry->next, ++idx_new)
+	if (nnames == 0
+	    || _dl_cache_libcmp (names[nnames - 1], entry->lib) != 0)
+	  {
+	    names[nnames] = entry->lib;
+	    first[nnames] = idx_new;
+	    ++nnames;
+	  }
+
+      hash_index = build_hash_index (names, first, nnames,
+				     &hash_index_size);
+      if (hash_index != NULL)
+	{
+	  size_t end = file_entries_new_size + total_strlen;
+	  size_t align = __alignof__ (struct cache_hash_index);
+	  hash_pad = ((end + align - 1) & ~(align - 1)) - end;
+	  file_entries_new->hash_offset = end + hash_pad;
+	}
+
+      free (first);
+      free (names);
+    }
+
   /* Write out the cache.  */
 
   /* Write cache first to a temporary file and rename it later.  */
@@ -462,6 +599,15 @@ save_cache (const char *cache_name)
   if (write (fd, strings, total_strlen) != (ssize_t) total_strlen)
     error (EXIT_FAILURE, errno, _("Writing of cache data failed"));
 
+  if (hash_index != NULL)
+    {
+      char zero[__alignof__ (struct cache_hash_index)] = { 0 };
+      if (write (fd, zero, hash_pad) != (ssize_t) hash_pad
+	  || (write (fd, hash_index, hash_index_size)
+	      != (ssize_t) hash_index_size))
+	error (EXIT_FAILURE, errno, _("Writing of cache data failed"));
+    }
+
   /* Make sure user can always read cache file */
   if (chmod (temp_name, S_IROTH|S_IRGRP|S_IRUSR|S_IWUSR))
     error (EXIT_FAILURE, errno,
@@ -478,6 +624,7 @@ save_cache (const char *cache_name)
 	   cache_name);
 
   /* Free all allocated memory.  */
+  free (hash_index);
   free (file_entries_new);
   free (file_entries);
   free (strings);
@@ -0,0 +1,611 @@
+/* Persistent cache of the symbol bindings of the objects loaded at startup.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+/* If LD_BIND_CACHE names a directory, the bindings of the symbols
+   referenced by the relocations of the objects loaded at startup are
+   stored there in a file named after the build ID of the program.
+   Each binding names the object which defines the symbol by its
+   position in the global scope and the symbol by its index in the
+   symbol table of that object, so that the file does not depend on
+   the addresses at which the objects are loaded.  On later starts,
+   the bindings are used instead of searching the scope if the global
+   scope consists of objects with the same build IDs.  Otherwise the
+   bindings are recorded again and the file is replaced.  */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <ldsodefs.h>
+#include <not-cancel.h>
+#include <_itoa.h>
+
+#define BINDCACHE_MAGIC "glibc-bindcache1"
+
+/* Set in the flags if LD_DYNAMIC_WEAK was in effect.  */
+#define BINDCACHE_DYNAMIC_WEAK	1
+
+/* The value of def_object for weak references to undefined symbols.  */
+#define BINDCACHE_UNDEFINED	UINT32_MAX
+
+/* The file starts with the header, followed by the array of objects,
+   the hash table of the bindings and the build IDs.  */
+struct bindcache_header
+{
+  char magic[sizeof BINDCACHE_MAGIC - 1];
+  uint32_t flags;
+  /* The number of objects in the global scope.  */
+  uint32_t nobjects;
+  /* The number of slots of the hash table, a power of two.  */
+  uint32_t nslots;
+  /* The size of the build IDs.  */
+  uint32_t build_ids_size;
+};
+
+struct bindcache_object
+{
+  /* The location of the build ID, relative to the start of the build
+     IDs.  */
+  uint32_t build_id_offset;
+  uint32_t build_id_size;
+};
+
+struct bindcache_binding
+{
+  /* The position of the referencing object in the global scope plus
+     one, or zero if the slot is unused.  */
+  uint32_t object;
+  /* The index of the referenced symbol in its symbol table.  */
+  uint32_t symidx;
+  uint32_t type_class;
+  /* The position of the defining object in the global scope, and the
+     index of the symbol in its symbol table.  */
+  uint32_t def_object;
+  uint32_t def_symidx;
+};
+
+static struct
+{
+  /* The objects of the global scope.  */
+  struct link_map **maps;
+  unsigned int nmaps;
+
+  /* The mapped file, if it can be used.  */
+  const struct bindcache_header *file;
+  size_t file_size;
+  const struct bindcache_binding *slots;
+
+  /* The bindings recorded if the file cannot be used, and whether
+     some of them could not be recorded.  */
+  struct bindcache_binding *recorded;
+  size_t nrecorded;
+  size_t recorded_alloc;
+  bool record_failed;
+
+  /* The name of the file.  */
+  char *name;
+} bindcache;
+
+
+/* Return the build ID of MAP and store its size in *SIZEP, or return
+   NULL if it has none.  */
+static const unsigned char *
+get_build_id (const struct link_map *map, size_t *sizep)
+{
+  for (const ElfW(Phdr) *ph = map->l_phdr; ph < &map->l_phdr[map->l_phnum];
+       ++ph)
+    if (ph->p_type == PT_NOTE)
+      {
+	/* Notes are aligned to 4 bytes unless the segment requires 8.  */
+	ElfW(Addr) align = ph->p_align == 8 ? 8 : 4;
+	ElfW(Addr) start = ph->p_vaddr + map->l_addr;
+	const ElfW(Nhdr) *note = (const void *) start;
+
+	while ((ElfW(Addr)) (note + 1) - start < ph->p_memsz)
+	  {
+	    if (note->n_type == NT_GNU_BUILD_ID
+		&& note->n_namesz == sizeof "GNU"
+		&& memcmp (note + 1, "GNU", sizeof "GNU") == 0
+		&& note->n_descsz > 0)
+	      {
+		*sizep = note->n_descsz;
+		return ((const unsigned char *) note
+			+ ELF_NOTE_DESC_OFFSET (sizeof "GNU", align));
+	      }
+	    note = ((const void *) note
+		    + ELF_NOTE_NEXT_OFFSET (note->n_namesz, note->n_descsz,
+					    align));
+	  }
+      }
+
+  return NULL;
+}
+
+static size_t
+binding_slot (uint32_t object, uint32_t symidx, uint32_t type_class,
+	      uint32_t nslots)
+{
+  return (((object * 0x9e3779b1) ^ (symidx * 0x85ebca6b) ^ type_class)
+	  & (nslots - 1));
+}
+
+/* Return the number of symbols in the symbol table of MAP, or zero if
+   it cannot be determined.  */
+static uint32_t
+symbol_count (const struct link_map *map)
+{
+  if (map->l_info[ELF_MACHINE_GNU_HASH_ADDRIDX] != NULL)
+    {
+      const Elf32_Word *hash32
+	= (const void *) D_PTR (map, l_info[ELF_MACHINE_GNU_HASH_ADDRIDX]);
+      Elf32_Word nbuckets = hash32[0];
+      Elf32_Word symbias = hash32[1];
+      Elf32_Word bitmask_nwords = hash32[2];
+      const Elf32_Word *buckets
+	= hash32 + 4 + bitmask_nwords * (__ELF_NATIVE_CLASS / 32);
+      const Elf32_Word *chain = buckets + nbuckets - symbias;
+
+      /* The symbols are sorted by bucket, so the chain of the highest
+	 bucket ends with the last symbol.  */
+      Elf32_Word last = 0;
+      for (Elf32_Word i = 0; i < nbuckets; ++i)
+	if (buckets[i] > last)
+	  last = buckets[i];
+      if (last < symbias)
+	return symbias;
+      while ((chain[last] & 1) == 0)
+	++last;
+      return last + 1;
+    }
+
+  if (map->l_info[DT_HASH] != NULL)
+    return ((const Elf_Symndx *) D_PTR (map, l_info[DT_HASH]))[1];
+
+  return 0;
+}
+
+/* Return true if the mapped FILE of SIZE bytes is well-formed and was
+   recorded for the objects in bindcache.maps.  */
+static bool
+file_matches (const struct bindcache_header *file, size_t size)
+{
+  if (size < sizeof (*file)
+      || memcmp (file->magic, BINDCACHE_MAGIC, sizeof file->magic) != 0
+      || file->flags != (GLRO(dl_dynamic_weak) ? BINDCACHE_DYNAMIC_WEAK : 0)
+      || file->nobjects != bindcache.nmaps
+      || file->nslots == 0
+      || (file->nslots & (file->nslots - 1)) != 0
+      || file->nslots > size / sizeof (struct bindcache_binding))
+    return false;
+
+  size_t expected = (sizeof (*file)
+		     + file->nobjects * sizeof (struct bindcache_object)
+		     + (size_t) file->nslots
+		       * sizeof (struct bindcache_binding)
+		     + file->build_ids_size);
+  if (size != expected)
+    return false;
+
+  const struct bindcache_object *objects = (const void *) (file + 1);
+  const unsigned char *build_ids = ((const unsigned char *) file + size
+				    - file->build_ids_size);
+  for (unsigned int i = 0; i < bindcache.nmaps; ++i)
+    {
+      size_t build_id_size;
+      const unsigned char *build_id = get_build_id (bindcache.maps[i],
+						    &build_id_size);
+      if (build_id == NULL
+	  || objects[i].build_id_size != build_id_size
+	  || objects[i].build_id_offset > file->build_ids_size
+	  || (file->build_ids_size - objects[i].build_id_offset
+	      < build_id_size)
+	  || memcmp (build_ids + objects[i].build_id_offset, build_id,
+		     build_id_size) != 0)
+	return false;
+    }
+
+  /* Every binding must refer to a symbol of its defining object, and
+     there must be an unused slot to end the probe sequences.  */
+  uint32_t nsyms[bindcache.nmaps];
+  for (unsigned int i = 0; i < bindcache.nmaps; ++i)
+    nsyms[i] = symbol_count (bindcache.maps[i]);
+
+  const struct bindcache_binding *slots
+    = (const void *) (objects + file->nobjects);
+  uint32_t used = 0;
+  for (uint32_t i = 0; i < file->nslots; ++i)
+    if (slots[i].object != 0)
+      {
+	if (slots[i].object > file->nobjects
+	    || (slots[i].def_object != BINDCACHE_UNDEFINED
+		&& (slots[i].def_object >= file->nobjects
+		    || slots[i].def_symidx >= nsyms[slots[i].def_object])))
+	  return false;
+	++used;
+      }
+
+  return used < file->nslots;
+}
+
+/* Map the file NAME and store its size in *SIZEP.  A file written by
+   another user could bind symbols to other definitions of the same
+   name, so only files owned by the user are used.  */
+static void *
+map_file (const char *name, size_t *sizep)
+{
+  void *result = MAP_FAILED;
+  struct stat64 st;
+  int fd = __open64_nocancel (name, O_RDONLY | O_NOFOLLOW | O_CLOEXEC);
+  if (fd >= 0)
+    {
+      if (__fxstat64 (_STAT_VER, fd, &st) >= 0
+	  && S_ISREG (st.st_mode) && st.st_uid == __geteuid ()
+	  && st.st_size != 0)
+	{
+	  *sizep = st.st_size;
+	  result = __mmap (NULL, *sizep, PROT_READ, MAP_PRIVATE, fd, 0);
+	}
+      __close_nocancel (fd);
+    }
+  return result;
+}
+
+void
+_dl_bindcache_setup (struct link_map *main_map)
+{
+  if (GLRO(dl_bindcache_dir) == NULL || GLRO(dl_naudit) > 0
+      || (GLRO(dl_debug_mask) & (DL_DEBUG_BINDINGS | DL_DEBUG_SYMBOLS)))
+    return;
+
+  /* The file is named after the build ID of the program.  */
+  size_t build_id_size;
+  const unsigned char *build_id = get_build_id (main_map, &build_id_size);
+  if (build_id == NULL)
+    return;
+
+  size_t dirlen = strlen (GLRO(dl_bindcache_dir));
+  bindcache.name = malloc (dirlen + 1 + 2 * build_id_size
+			   + sizeof ".bindcache");
+  if (bindcache.name == NULL)
+    return;
+  char *cp = __mempcpy (bindcache.name, GLRO(dl_bindcache_dir), dirlen);
+  *cp++ = '/';
+  for (size_t i = 0; i < build_id_size; ++i)
+    {
+      *cp++ = "0123456789abcdef"[build_id[i] >> 4];
+      *cp++ = "0123456789abcdef"[build_id[i] & 15];
+    }
+  strcpy (cp, ".bindcache");
+
+  bindcache.maps = main_map->l_searchlist.r_list;
+  bindcache.nmaps = main_map->l_searchlist.r_nlist;
+  for (unsigned int i = 0; i < bindcache.nmaps; ++i)
+    {
+      size_t size;
+      if (get_build_id (bindcache.maps[i], &size) == NULL)
+	{
+	  /* Objects without build ID cannot be recognized.  */
+	  bindcache.nmaps = 0;
+	  return;
+	}
+    }
+
+  size_t size;
+  void *file = map_file (bindcache.name, &size);
+  if (file != MAP_FAILED)
+    {
+      if (file_matches (file, size))
+	{
+	  bindcache.file = file;
+	  bindcache.file_size = size;
+	  bindcache.slots = ((const void *) file
+			     + sizeof (struct bindcache_header)
+			     + (bindcache.nmaps
+				* sizeof (struct bindcache_object)));
+	}
+      else
+	__munmap (file, size);
+    }
+
+  if (__glibc_unlikely (GLRO(dl_debug_mask) & DL_DEBUG_RELOC))
+    _dl_debug_printf ("\n%s binding cache %s\n",
+		      bindcache.file != NULL ? "using" : "recording",
+		      bindcache.name);
+
+  for (unsigned int i = 0; i < bindcache.nmaps; ++i)
+    bindcache.maps[i]->l_bindcache_idx = i + 1;
+}
+
+
+/* Look up the binding of the symbol with index SYMIDX referenced by L
+   in the file.  file_matches has checked that the probe sequence ends
+   at an unused slot.  */
+static const struct bindcache_binding *
+find_binding (const struct link_map *l, uint32_t symidx, int type_class)
+{
+  uint32_t nslots = bindcache.file->nslots;
+  size_t slot = binding_slot (l->l_bindcache_idx, symidx, type_class,
+			      nslots);
+
+  while (bindcache.slots[slot].object != 0)
+    {
+      const struct bindcache_binding *b = &bindcache.slots[slot];
+      if (b->object == l->l_bindcache_idx && b->symidx == symidx
+	  && b->type_class == type_class)
+	return b;
+      slot = (slot + 1) & (nslots - 1);
+    }
+
+  return NULL;
+}
+
+/* Return true if the symbol with index SYMIDX of MAP has the version
+   VERSION, or is not hidden if VERSION is NULL.  Other cases are left
+   to _dl_lookup_symbol_x.  */
+static bool
+version_matches (const struct link_map *map, uint32_t symidx,
+		 const struct r_found_version *version)
+{
+  const ElfW(Versym) *verstab = map->l_versyms;
+  if (verstab == NULL)
+    return version == NULL;
+  if (version == NULL)
+    return (verstab[symidx] & 0x8000) == 0;
+
+  ElfW(Half) ndx = verstab[symidx] & 0x7fff;
+  return (ndx < map->l_nversions && map->l_versions[ndx].name != NULL
+	  && map->l_versions[ndx].hash == version->hash
+	  && strcmp (map->l_versions[ndx].name, version->name) == 0);
+}
+
+/* Add the binding B to the recorded ones.  */
+static void
+record_binding (const struct bindcache_binding *b)
+{
+  if (bindcache.nrecorded == bindcache.recorded_alloc)
+    {
+      size_t newalloc = (bindcache.recorded_alloc == 0
+			 ? GLRO(dl_pagesize) / sizeof (*b)
+			 : 2 * bindcache.recorded_alloc);
+      struct bindcache_binding *newrecorded
+	= __mmap (NULL, newalloc * sizeof (*b), PROT_READ | PROT_WRITE,
+		  MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
+      if (newrecorded == MAP_FAILED)
+	{
+	  /* Do not write an incomplete file.  */
+	  bindcache.record_failed = true;
+	  return;
+	}
+      if (bindcache.recorded != NULL)
+	{
+	  memcpy (newrecorded, bindcache.recorded,
+		  bindcache.nrecorded * sizeof (*b));
+	  __munmap (bindcache.recorded,
+		    bindcache.recorded_alloc * sizeof (*b));
+	}
+      bindcache.recorded = newrecorded;
+      bindcache.recorded_alloc = newalloc;
+    }
+
+  bindcache.recorded[bindcache.nrecorded++] = *b;
+}
+
+lookup_t
+_dl_bindcache_lookup (const char *undef_name, struct link_map *l,
+		      const ElfW(Sym) **ref, struct r_scope_elem *scope[],
+		      const struct r_found_version *version, int type_class)
+{
+  const ElfW(Sym) *symtab = (const void *) D_PTR (l, l_info[DT_SYMTAB]);
+  uint32_t symidx = *ref - symtab;
+
+  if (bindcache.file != NULL)
+    {
+      const struct bindcache_binding *b = find_binding (l, symidx,
+							type_class);
+      if (b != NULL && b->def_object == BINDCACHE_UNDEFINED)
+	{
+	  ++GL(dl_num_cache_relocations);
+	  *ref = NULL;
+	  return NULL;
+	}
+      if (b != NULL && b->def_object < bindcache.nmaps)
+	{
+	  struct link_map *map = bindcache.maps[b->def_object];
+	  const ElfW(Sym) *sym = ((const ElfW(Sym) *)
+				  D_PTR (map, l_info[DT_SYMTAB])
+				  + b->def_symidx);
+	  const char *strtab = (const void *) D_PTR (map, l_info[DT_STRTAB]);
+
+	  /* The build IDs match, but check that the symbol can still
+	     satisfy the reference.  */
+	  if (sym->st_shndx != SHN_UNDEF
+	      && ELFW(ST_BIND) (sym->st_info) != STB_LOCAL
+	      && ELFW(ST_VISIBILITY) (sym->st_other) != STV_HIDDEN
+	      && ELFW(ST_VISIBILITY) (sym->st_other) != STV_INTERNAL
+	      && version_matches (map, b->def_symidx, version)
+	      && strcmp (strtab + sym->st_name, undef_name) == 0)
+	    {
+	      ++GL(dl_num_cache_relocations);
+	      map->l_used = 1;
+	      *ref = sym;
+	      return LOOKUP_VALUE (map);
+	    }
+	}
+    }
+
+  lookup_t result = _dl_lookup_symbol_x (undef_name, l, ref, scope, version,
+					 type_class,
+					 DL_LOOKUP_ADD_DEPENDENCY
+					 | DL_LOOKUP_FOR_RELOCATE, NULL);
+
+  /* Unique symbols have to be entered in the table of unique symbols
+     by a lookup.  */
+  if (bindcache.file == NULL && !bindcache.record_failed
+      && (*ref == NULL
+	  || (result->l_bindcache_idx != 0
+	      && ELFW(ST_BIND) ((*ref)->st_info) != STB_GNU_UNIQUE)))
+    {
+      struct bindcache_binding b =
+	{
+	  .object = l->l_bindcache_idx,
+	  .symidx = symidx,
+	  .type_class = type_class,
+	  .def_object = BINDCACHE_UNDEFINED,
+	  .def_symidx = 0
+	};
+      if (*ref != NULL)
+	{
+	  b.def_object = result->l_bindcache_idx - 1;
+	  b.def_symidx = (*ref - (const ElfW(Sym) *)
+			  D_PTR (result, l_info[DT_SYMTAB]));
+	}
+      record_binding (&b);
+    }
+
+  return result;
+}
+
+
+/* Write the recorded bindings to the file.  */
+static void
+write_file (void)
+{
+  size_t nslots = 16;
+  while (nslots < 2 * bindcache.nrecorded)
+    nslots *= 2;
+
+  size_t build_ids_size = 0;
+  for (unsigned int i = 0; i < bindcache.nmaps; ++i)
+    {
+      size_t size;
+      get_build_id (bindcache.maps[i], &size);
+      build_ids_size += size;
+    }
+
+  size_t objects_size = bindcache.nmaps * sizeof (struct bindcache_object);
+  size_t size = (sizeof (struct bindcache_header) + objects_size
+		 + nslots * sizeof (struct bindcache_binding)
+		 + build_ids_size);
+  if (nslots > UINT32_MAX || build_ids_size > UINT32_MAX)
+    return;
+  void *data = __mmap (NULL, size, PROT_READ | PROT_WRITE,
+		       MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
+  if (data == MAP_FAILED)
+    return;
+
+  struct bindcache_header *header = data;
+  memcpy (header->magic, BINDCACHE_MAGIC, sizeof header->magic);
+  header->flags = GLRO(dl_dynamic_weak) ? BINDCACHE_DYNAMIC_WEAK : 0;
+  header->nobjects = bindcache.nmaps;
+  header->nslots = nslots;
+  header->build_ids_size = build_ids_size;
+
+  struct bindcache_object *objects = (void *) (header + 1);
+  struct bindcache_binding *slots = (void *) objects + objects_size;
+  unsigned char *build_ids = (unsigned char *) data + size - build_ids_size;
+  uint32_t offset = 0;
+  for (unsigned int i = 0; i < bindcache.nmaps; ++i)
+    {
+      size_t build_id_size;
+      const unsigned char *build_id = get_build_id (bindcache.maps[i],
+						    &build_id_size);
+      objects[i].build_id_offset = offset;
+      objects[i].build_id_size = build_id_size;
+      memcpy (build_ids + offset, build_id, build_id_size);
+      offset += build_id_size;
+    }
+
+  /* The mapping is zero-filled, so all slots are unused.  A binding is
+     recorded as often as its relocations are processed.  */
+  for (size_t i = 0; i < bindcache.nrecorded; ++i)
+    {
+      const struct bindcache_binding *b = &bindcache.recorded[i];
+      size_t slot = binding_slot (b->object, b->symidx, b->type_class,
+				  nslots);
+      while (slots[slot].object != 0
+	     && (slots[slot].object != b->object
+		 || slots[slot].symidx != b->symidx
+		 || slots[slot].type_class != b->type_class))
+	slot = (slot + 1) & (nslots - 1);
+      slots[slot] = *b;
+    }
+
+  /* Write to a temporary file and rename it, so that processes which
+     start at the same time never see a partial file.  */
+  size_t namelen = strlen (bindcache.name);
+  char tmpname[namelen + 12];
+  char *cp = __mempcpy (tmpname, bindcache.name, namelen);
+  char buf[11];
+  buf[10] = '\0';
+  *cp++ = '.';
+  strcpy (cp, _itoa (__getpid (), &buf[10], 10, 0));
+
+  int fd = __open64_nocancel (tmpname,
+			      O_WRONLY | O_CREAT | O_EXCL | O_NOFOLLOW
+			      | O_CLOEXEC, DEFFILEMODE);
+  if (fd != -1)
+    {
+      const char *p = data;
+      size_t left = size;
+      while (left > 0)
+	{
+	  ssize_t n = TEMP_FAILURE_RETRY (__write_nocancel (fd, p, left));
+	  if (n <= 0)
+	    break;
+	  p += n;
+	  left -= n;
+	}
+      __close_nocancel (fd);
+
+      if (left != 0
+	  || __renameat (AT_FDCWD, tmpname, AT_FDCWD, bindcache.name) != 0)
+	__unlink (tmpname);
+    }
+
+  __munmap (data, size);
+}
+
+void
+_dl_bindcache_finish (void)
+{
+  if (bindcache.nmaps != 0 && bindcache.file == NULL
+      && !bindcache.record_failed)
+    write_file ();
+
+  for (unsigned int i = 0; i < bindcache.nmaps; ++i)
+    bindcache.maps[i]->l_bindcache_idx = 0;
+
+  if (bindcache.file != NULL)
+    __munmap ((void *) bindcache.file, bindcache.file_size);
+  if (bindcache.recorded != NULL)
+    __munmap (bindcache.recorded,
+	      bindcache.recorded_alloc * sizeof (struct bindcache_binding));
+  free (bindcache.name);
+  bindcache.file = NULL;
+  bindcache.recorded = NULL;
+  bindcache.nrecorded = 0;
+  bindcache.recorded_alloc = 0;
+  bindcache.record_failed = false;
+  bindcache.name = NULL;
+  bindcache.nmaps = 0;
+}
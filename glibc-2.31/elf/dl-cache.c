@@ -35,9 +35,50 @@ static struct cache_file *cache;
 static struct cache_file_new *cache_new;
 static size_t cachesize;
 
+/* The hash index of the new format, or NULL.  */
+static const struct cache_hash_index *cache_hash;
+
 /* 1 if cache_data + PTR points into the cache.  */
 #define _dl_cache_verify_ptr(ptr) (ptr < cache_data_size)
 
+#define SELECT_CACHE_ENTRY(cache) \
+/* Find the best entry for NAME in the entries from MIDDLE on, which	      \
+   are known to be for NAME up to LEFT, and store its file name in	      \
+   BEST.  */								      \
+do									      \
+  {									      \
+    int flags;								      \
+    __typeof__ (cache->libs[0]) *lib = &cache->libs[middle];		      \
+									      \
+    /* Only perform the name test if necessary.  */			      \
+    if (middle > left							      \
+	/* We haven't seen this string so far.  Test whether the	      \
+	   index is ok and whether the name matches.  Otherwise		      \
+	   we are done.  */						      \
+	&& (! _dl_cache_verify_ptr (lib->key)				      \
+	    || (_dl_cache_libcmp (name, cache_data + lib->key)		      \
+		!= 0)))							      \
+      break;								      \
+									      \
+    flags = lib->flags;							      \
+    if (_dl_cache_check_flags (flags)					      \
+	&& _dl_cache_verify_ptr (lib->value))				      \
+      {									      \
+	if (best == NULL || flags == GLRO(dl_correct_cache_id))		      \
+	  {								      \
+	    HWCAP_CHECK;						      \
+	    best = cache_data + lib->value;				      \
+									      \
+	    if (flags == GLRO(dl_correct_cache_id))			      \
+	      /* We've found an exact match for the shared		      \
+		 object and no general `ELF' release.  Stop		      \
+		 searching.  */						      \
+	      break;							      \
+	  }								      \
+      }									      \
+  }									      \
+while (++middle <= right)
+
 #define SEARCH_CACHE(cache) \
 /* We use binary search since the table is sorted in the cache file.	      \
    The first matching entry in the table is returned.			      \
@@ -88,39 +129,7 @@ do									      \
 		--middle;						      \
 	      }								      \
 									      \
-	    do								      \
-	      {								      \
-		int flags;						      \
-		__typeof__ (cache->libs[0]) *lib = &cache->libs[middle];      \
-									      \
-		/* Only perform the name test if necessary.  */		      \
-		if (middle > left					      \
-		    /* We haven't seen this string so far.  Test whether the  \
-		       index is ok and whether the name matches.  Otherwise   \
-		       we are done.  */					      \
-		    && (! _dl_cache_verify_ptr (lib->key)		      \
-			|| (_dl_cache_libcmp (name, cache_data + lib->key)    \
-			    != 0)))					      \
-		  break;						      \
-									      \
-		flags = lib->flags;					      \
-		if (_dl_cache_check_flags (flags)			      \
-		    && _dl_cache_verify_ptr (lib->value))		      \
-		  {							      \
-		    if (best == NULL || flags == GLRO(dl_correct_cache_id))   \
-		      {							      \
-			HWCAP_CHECK;					      \
-			best = cache_data + lib->value;			      \
-									      \
-			if (flags == GLRO(dl_correct_cache_id))		      \
-			  /* We've found an exact match for the shared	      \
-			     object and no general `ELF' release.  Stop	      \
-			     searching.  */				      \
-			  break;					      \
-		      }							      \
-		  }							      \
-	      }								      \
-	    while (++middle <= right);					      \
+	    SELECT_CACHE_ENTRY (cache);					      \
 	    break;							      \
 	}								      \
 									      \
@@ -172,6 +181,49 @@ _dl_cache_libcmp (const char *p1, const char *p2)
 }
 
 
+/* Set CACHE_HASH to the hash index of CACHE_NEW if it has a valid one.  */
+static void
+setup_cache_hash (void)
+{
+  size_t size = (const char *) cache + cachesize - (const char *) cache_new;
+  uint32_t offset = cache_new->hash_offset;
+
+  cache_hash = NULL;
+  if (offset == 0 || offset % __alignof__ (struct cache_hash_index) != 0
+      || offset > size || size - offset < sizeof (struct cache_hash_index))
+    return;
+
+  const struct cache_hash_index *index
+    = (const void *) ((const char *) cache_new + offset);
+  if (index->nseeds != 0 && index->nslots != 0
+      && ((size - offset - sizeof (struct cache_hash_index))
+	  / sizeof (uint32_t)) >= (uint64_t) index->nseeds + index->nslots)
+    cache_hash = index;
+}
+
+/* Return the index of the first entry for NAME in CACHE_NEW according to
+   the hash index, or -1 if there is none.  */
+static int
+search_cache_hash (const char *name, const char *cache_data,
+		   uint32_t cache_data_size)
+{
+  const uint32_t *seeds = cache_hash->seeds;
+  const uint32_t *slots = &cache_hash->seeds[cache_hash->nseeds];
+  uint32_t h = _dl_cache_hash (name, 0);
+  uint32_t seed = seeds[_dl_cache_hash_reduce (h, cache_hash->nseeds)];
+  h = _dl_cache_hash (name, seed);
+  uint32_t slot = slots[_dl_cache_hash_reduce (h, cache_hash->nslots)];
+  if (slot == 0 || slot > cache_new->nlibs)
+    return -1;
+
+  uint32_t key = cache_new->libs[slot - 1].key;
+  if (! _dl_cache_verify_ptr (key)
+      || _dl_cache_libcmp (name, cache_data + key) != 0)
+    return -1;
+  return slot - 1;
+}
+
+
 /* Look up NAME in ld.so.cache and return the file name stored there, or null
    if none is found.  The cache is loaded if it was not already.  If loading
    the cache previously failed there will be no more attempts to load it.
@@ -238,6 +290,9 @@ _dl_load_cache_lookup (const char *name)
 	}
 
       assert (cache != NULL);
+
+      if (cache_new != (void *) -1)
+	setup_cache_hash ();
     }
 
   if (cache == (void *) -1)
@@ -276,7 +331,19 @@ _dl_load_cache_lookup (const char *name)
 	  && (lib->hwcap & _DL_HWCAP_PLATFORM) != 0			      \
 	  && (lib->hwcap & _DL_HWCAP_PLATFORM) != platform)		      \
 	continue
-      SEARCH_CACHE (cache_new);
+      if (cache_hash != NULL)
+	{
+	  /* The hash index finds the first entry for NAME, if any.  */
+	  middle = search_cache_hash (name, cache_data, cache_data_size);
+	  if (middle >= 0)
+	    {
+	      left = middle;
+	      right = cache_new->nlibs - 1;
+	      SELECT_CACHE_ENTRY (cache_new);
+	    }
+	}
+      else
+	SEARCH_CACHE (cache_new);
     }
   else
     {
@@ -321,6 +388,7 @@ _dl_unload_cache (void)
     {
       __munmap (cache, cachesize);
       cache = NULL;
+      cache_hash = NULL;
     }
 }
 #endif
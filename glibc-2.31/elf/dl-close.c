@@ -473,6 +473,11 @@ _dl_close_worker (struct link_map *map, bool force)
   if (!unload_any)
     goto out;
 
+  /* The results of symbol lookups cached while objects are relocated,
+     which happens if an IFUNC resolver calls dlclose, may refer to the
+     removed objects.  */
+  _dl_lookup_cache_flush ();
+
 #ifdef SHARED
   /* Auditing checkpoint: we will start deleting objects.  */
   if (__glibc_unlikely (do_audit))
@@ -542,6 +547,12 @@ _dl_close_worker (struct link_map *map, bool force)
 	  free (fsl->list[--fsl->count]);
     }
 
+  /* Remove the objects from the snapshot used by _dl_find_object and
+     dl_iterate_phdr, and wait for the threads iterating over an older
+     snapshot before unmapping anything.  */
+  _dl_find_object_update ();
+  _dl_find_object_wait_readers ();
+
   size_t tls_free_start;
   size_t tls_free_end;
   tls_free_start = tls_free_end = NO_TLS_OFFSET;
@@ -0,0 +1,315 @@
+/* Look up the object containing an address without taking a lock.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <dlfcn.h>
+#include <ldsodefs.h>
+#include <limits.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <tls.h>
+#include <dl-find_object.h>
+#include <dl-phdr-readers.h>
+
+/* Unwinders look up an address for every frame, so taking
+   GL(dl_load_write_lock) serializes all threads which throw
+   exceptions.  Instead dlopen and dlclose publish a snapshot of the
+   loaded objects, and readers retry if it changes while they look at
+   it.  There are two tables, the current one and the one the next
+   update writes, so a reader only retries when two updates overlap
+   with its lookup.  */
+
+/* Tables are never unmapped, so start with room for a typical process
+   and double the size when it is too small.  */
+#define TABLE_MIN_CAPACITY 64
+
+/* Return a new table for at least COUNT objects, or NULL.  */
+static struct dl_find_object_table *
+allocate_table (size_t count)
+{
+  size_t capacity = TABLE_MIN_CAPACITY;
+  while (capacity < count)
+    capacity *= 2;
+
+  size_t size = (sizeof (struct dl_find_object_table)
+		 + capacity * (sizeof (struct dl_find_object_entry)
+			       + sizeof (unsigned int)));
+  struct dl_find_object_table *tab
+    = __mmap (NULL, size, PROT_READ | PROT_WRITE,
+	      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (tab == MAP_FAILED)
+    return NULL;
+  tab->capacity = capacity;
+  return tab;
+}
+
+/* Describe L in *ENTRY.  */
+static void
+fill_entry (struct dl_find_object_entry *entry, struct link_map *l)
+{
+  entry->map_start = l->l_map_start;
+  entry->map_end = l->l_map_end;
+  entry->map = l;
+  entry->eh_frame = NULL;
+#if DLFO_STRUCT_HAS_EH_COUNT
+  entry->eh_count = 0;
+#endif
+
+  /* The main program of a static executable has no mapping data.  */
+  bool compute_range = entry->map_end == 0;
+  if (compute_range)
+    entry->map_start = UINTPTR_MAX;
+
+  for (const ElfW(Phdr) *ph = l->l_phdr; ph < &l->l_phdr[l->l_phnum]; ++ph)
+    if (ph->p_type == DLFO_EH_SEGMENT_TYPE)
+      {
+	entry->eh_frame = (void *) (l->l_addr + ph->p_vaddr);
+#if DLFO_STRUCT_HAS_EH_COUNT
+	entry->eh_count = ph->p_memsz / 8;
+#endif
+      }
+    else if (ph->p_type == PT_LOAD && compute_range)
+      {
+	uintptr_t start = l->l_addr + ph->p_vaddr;
+	uintptr_t end = start + ph->p_memsz;
+	if (start < entry->map_start)
+	  entry->map_start = start;
+	if (end > entry->map_end)
+	  entry->map_end = end;
+      }
+  if (entry->map_start > entry->map_end)
+    entry->map_start = entry->map_end;
+
+#if DLFO_STRUCT_HAS_EH_DBASE
+  if (l->l_info[DT_PLTGOT] != NULL)
+    entry->eh_dbase = (void *) D_PTR (l, l_info[DT_PLTGOT]);
+  else
+    entry->eh_dbase = NULL;
+#endif
+}
+
+/* Copy ENTRY to *RESULT.  */
+static void
+fill_result (struct dl_find_object *result,
+	     const struct dl_find_object_entry *entry)
+{
+  memset (result, 0, sizeof (*result));
+  result->dlfo_map_start = (void *) entry->map_start;
+  result->dlfo_map_end = (void *) entry->map_end;
+  result->dlfo_link_map = entry->map;
+  result->dlfo_eh_frame = entry->eh_frame;
+#if DLFO_STRUCT_HAS_EH_DBASE
+  result->dlfo_eh_dbase = entry->eh_dbase;
+#endif
+#if DLFO_STRUCT_HAS_EH_COUNT
+  result->dlfo_eh_count = entry->eh_count;
+#endif
+}
+
+/* Move element I of INDEX down the heap of the first N elements.  */
+static void
+sift_down (const struct dl_find_object_entry *entries, unsigned int *index,
+	   size_t i, size_t n)
+{
+  while (true)
+    {
+      size_t child = 2 * i + 1;
+      if (child >= n)
+	break;
+      if (child + 1 < n
+	  && (entries[index[child + 1]].map_start
+	      > entries[index[child]].map_start))
+	++child;
+      if (entries[index[i]].map_start >= entries[index[child]].map_start)
+	break;
+      unsigned int tmp = index[i];
+      index[i] = index[child];
+      index[child] = tmp;
+      i = child;
+    }
+}
+
+/* Sort the index of the first N entries of TAB by address.  The
+   dynamic linker has no qsort, so this is a heapsort.  */
+static void
+sort_index (struct dl_find_object_table *tab, size_t n)
+{
+  unsigned int *index = _dl_find_object_index (tab);
+
+  for (size_t i = 0; i < n; ++i)
+    index[i] = i;
+  for (size_t i = n / 2; i-- > 0; )
+    sift_down (tab->entries, index, i, n);
+  for (size_t end = n; end-- > 1; )
+    {
+      unsigned int tmp = index[0];
+      index[0] = index[end];
+      index[end] = tmp;
+      sift_down (tab->entries, index, 0, end);
+    }
+}
+
+void
+_dl_find_object_update (void)
+{
+  unsigned int version = GL(dl_find_object_version) + 1;
+  /* Keep two more than the version, which the reader slots store,
+     away from the special states.  Zero means there is no snapshot.
+     The low bit alternates.  */
+  if (version > UINT_MAX - 2)
+    version = 2;
+
+  size_t count = 0;
+  for (Lmid_t ns = 0; ns < GL(dl_nns); ++ns)
+    for (struct link_map *l = GL(dl_ns)[ns]._ns_loaded; l != NULL;
+	 l = l->l_next)
+      count += !l->l_removed;
+
+  /* Readers of the table are left over from the previous version.
+     They notice that the version has changed since then.  */
+  struct dl_find_object_table *tab = GL(dl_find_object_tables)[version & 1];
+  if (tab == NULL || tab->capacity < count)
+    {
+      /* Without a table, readers fall back to the lists of loaded
+	 objects.  */
+      tab = allocate_table (count);
+      atomic_store_release (&GL(dl_find_object_tables)[version & 1], tab);
+    }
+
+  if (tab != NULL)
+    {
+      /* Order the stores below after the previous version update, for
+	 the readers which still use this table.  */
+      atomic_thread_fence_release ();
+
+      size_t n = 0;
+      for (Lmid_t ns = 0; ns < DL_NNS; ++ns)
+	{
+	  if (ns < GL(dl_nns))
+	    for (struct link_map *l = GL(dl_ns)[ns]._ns_loaded; l != NULL;
+		 l = l->l_next)
+	      if (!l->l_removed)
+		fill_entry (&tab->entries[n++], l);
+	  tab->ns_end[ns] = n;
+	}
+      tab->count = n;
+      tab->adds = GL(dl_load_adds);
+      sort_index (tab, n);
+    }
+
+  atomic_store_release (&GL(dl_find_object_version), version);
+}
+
+void
+_dl_find_object_wait_readers (void)
+{
+  unsigned int current = GL(dl_find_object_version) + 2;
+  void *self = THREAD_SELF;
+
+  atomic_fetch_add_relaxed (&GL(dl_phdr_readers_waiters), 1);
+  /* Either a reader which starts now sees the current version, or we
+     see its slot taken.  Either a reader which leaves its slot sees
+     that we wait, or we see the slot free.  */
+  atomic_full_barrier ();
+
+  for (size_t i = 0; i < DL_PHDR_READERS; ++i)
+    {
+      struct dl_phdr_reader *reader = &GL(dl_phdr_readers)[i];
+      while (true)
+	{
+	  unsigned int changed
+	    = atomic_load_acquire (&GL(dl_phdr_readers_changed));
+	  unsigned int state = atomic_load_acquire (&reader->state);
+	  /* Readers of the current snapshot do not see the removed
+	     objects.  Our own iteration continues on the current
+	     snapshot when we return to it.  */
+	  if (state == 0 || state == current
+	      || (state != DL_PHDR_READER_CLAIMED
+		  && atomic_load_relaxed (&reader->thread) == self))
+	    break;
+	  _dl_phdr_readers_wait (&GL(dl_phdr_readers_changed), changed);
+	}
+    }
+
+  atomic_fetch_add_relaxed (&GL(dl_phdr_readers_waiters), -1);
+}
+
+/* Look up PC in the lists of loaded objects, before the first
+   snapshot or if a table could not be allocated.  */
+static int
+find_object_locked (uintptr_t pc, struct dl_find_object *result)
+{
+  int ret = -1;
+
+  __rtld_lock_lock_recursive (GL(dl_load_write_lock));
+  for (Lmid_t ns = 0; ns < GL(dl_nns) && ret != 0; ++ns)
+    for (struct link_map *l = GL(dl_ns)[ns]._ns_loaded; l != NULL;
+	 l = l->l_next)
+      {
+	struct dl_find_object_entry entry;
+	fill_entry (&entry, l);
+	if (pc >= entry.map_start && pc < entry.map_end)
+	  {
+	    fill_result (result, &entry);
+	    ret = 0;
+	    break;
+	  }
+      }
+  __rtld_lock_unlock_recursive (GL(dl_load_write_lock));
+
+  return ret;
+}
+
+int
+_dl_find_object (void *address, struct dl_find_object *result)
+{
+  uintptr_t pc = (uintptr_t) address;
+
+  while (true)
+    {
+      unsigned int version;
+      struct dl_find_object_table *tab
+	= _dl_find_object_read_begin (&version);
+      if (tab == NULL)
+	return find_object_locked (pc, result);
+
+      struct dl_find_object_entry entry;
+      ssize_t i = _dl_find_object_search (tab, pc);
+      if (i >= 0)
+	{
+	  struct dl_find_object_entry *e = &tab->entries[i];
+	  entry.map_start = atomic_load_relaxed (&e->map_start);
+	  entry.map_end = atomic_load_relaxed (&e->map_end);
+	  entry.map = atomic_load_relaxed (&e->map);
+	  entry.eh_frame = atomic_load_relaxed (&e->eh_frame);
+#if DLFO_STRUCT_HAS_EH_DBASE
+	  entry.eh_dbase = atomic_load_relaxed (&e->eh_dbase);
+#endif
+#if DLFO_STRUCT_HAS_EH_COUNT
+	  entry.eh_count = atomic_load_relaxed (&e->eh_count);
+#endif
+	}
+
+      if (_dl_find_object_read_valid (version))
+	{
+	  if (i < 0)
+	    return -1;
+	  fill_result (result, &entry);
+	  return 0;
+	}
+    }
+}
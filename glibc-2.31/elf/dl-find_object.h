@@ -0,0 +1,126 @@
+/* Snapshots of the loaded objects for lock-free readers.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#ifndef _DL_FIND_OBJECT_H
+#define _DL_FIND_OBJECT_H 1
+
+#include <atomic.h>
+#include <dlfcn.h>
+#include <ldsodefs.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+/* A loaded object in a snapshot.  */
+struct dl_find_object_entry
+{
+  uintptr_t map_start;
+  uintptr_t map_end;
+  struct link_map *map;
+  void *eh_frame;
+#if DLFO_STRUCT_HAS_EH_DBASE
+  void *eh_dbase;
+#endif
+#if DLFO_STRUCT_HAS_EH_COUNT
+  int eh_count;
+#endif
+};
+
+/* The objects loaded at the time of an update.  The writer fills in
+   the table which is not current and then increments
+   GL(dl_find_object_version).  Readers load what they need and then
+   check that the version has not changed, see
+   _dl_find_object_read_valid.  Tables are never unmapped, because a
+   reader may still look at one which has been replaced.  */
+struct dl_find_object_table
+{
+  /* Number of elements of ENTRIES and of the index which follows
+     them.  This does not change after allocation.  */
+  size_t capacity;
+  size_t count;
+  /* GL(dl_load_adds) at the time of the update.  */
+  unsigned long long int adds;
+  /* The objects of namespace NS are the entries from NS_END[NS - 1]
+     (or 0) up to NS_END[NS], in the order of the namespace list.  */
+  size_t ns_end[DL_NNS];
+  /* Followed by CAPACITY indices of ENTRIES, sorted by map_start.  */
+  struct dl_find_object_entry entries[];
+};
+
+static inline unsigned int *
+_dl_find_object_index (struct dl_find_object_table *tab)
+{
+  return (unsigned int *) &tab->entries[tab->capacity];
+}
+
+/* Return the current table and store its version in *VERSION.  The
+   result is NULL if there is no snapshot.  */
+static inline struct dl_find_object_table *
+_dl_find_object_read_begin (unsigned int *version)
+{
+  *version = atomic_load_acquire (&GL(dl_find_object_version));
+  return atomic_load_relaxed (&GL(dl_find_object_tables)[*version & 1]);
+}
+
+/* Return true if the data loaded from the table returned by
+   _dl_find_object_read_begin for VERSION is consistent.  */
+static inline bool
+_dl_find_object_read_valid (unsigned int version)
+{
+  atomic_thread_fence_acquire ();
+  return atomic_load_relaxed (&GL(dl_find_object_version)) == version;
+}
+
+/* Return the index in TAB->entries of the object containing PC, or -1.
+   Concurrent updates of TAB may produce any result, but no access
+   outside of TAB.  */
+static inline ssize_t
+_dl_find_object_search (struct dl_find_object_table *tab, uintptr_t pc)
+{
+  size_t capacity = tab->capacity;
+  unsigned int *index = _dl_find_object_index (tab);
+  size_t count = atomic_load_relaxed (&tab->count);
+  if (count > capacity)
+    count = capacity;
+
+  /* Find the first object which starts above PC.  Objects do not
+     overlap.  The holes of objects which are not contiguous are
+     mapped without access, so other objects cannot be placed there.  */
+  size_t lo = 0;
+  size_t hi = count;
+  while (lo < hi)
+    {
+      size_t mid = lo + (hi - lo) / 2;
+      unsigned int i = atomic_load_relaxed (&index[mid]);
+      if (i >= capacity)
+	return -1;
+      if (atomic_load_relaxed (&tab->entries[i].map_start) <= pc)
+	lo = mid + 1;
+      else
+	hi = mid;
+    }
+  if (lo == 0)
+    return -1;
+
+  unsigned int i = atomic_load_relaxed (&index[lo - 1]);
+  if (i >= capacity || pc >= atomic_load_relaxed (&tab->entries[i].map_end))
+    return -1;
+  return i;
+}
+
+#endif /* dl-find_object.h */
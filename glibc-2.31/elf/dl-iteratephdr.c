@@ -21,6 +21,32 @@
 #include <ldsodefs.h>
 #include <stddef.h>
 #include <libc-lock.h>
+#include <tls.h>
+#include <dl-find_object.h>
+#include <dl-phdr-readers.h>
+
+typedef int (*phdr_callback) (struct dl_phdr_info *info, size_t size,
+			      void *data);
+
+/* Call CALLBACK for L.  */
+static int
+report_object (phdr_callback callback, void *data, struct link_map *l,
+	       unsigned long long int adds, size_t nloaded)
+{
+  struct dl_phdr_info info;
+
+  info.dlpi_addr = l->l_real->l_addr;
+  info.dlpi_name = l->l_real->l_name;
+  info.dlpi_phdr = l->l_real->l_phdr;
+  info.dlpi_phnum = l->l_real->l_phnum;
+  info.dlpi_adds = adds;
+  info.dlpi_subs = adds - nloaded;
+  info.dlpi_tls_data = NULL;
+  info.dlpi_tls_modid = l->l_real->l_tls_modid;
+  if (info.dlpi_tls_modid != 0)
+    info.dlpi_tls_data = GLRO(dl_tls_get_addr_soft) (l->l_real);
+  return callback (&info, sizeof (struct dl_phdr_info), data);
+}
 
 static void
 cancel_handler (void *arg __attribute__((unused)))
@@ -28,51 +54,54 @@ cancel_handler (void *arg __attribute__((unused)))
   __rtld_lock_unlock_recursive (GL(dl_load_write_lock));
 }
 
-int
-__dl_iterate_phdr (int (*callback) (struct dl_phdr_info *info,
-				    size_t size, void *data), void *data)
+/* Report the objects from the lists of loaded objects, holding
+   GL(dl_load_write_lock).  NS is the namespace to report, or -1 for
+   the namespace of CALLER.  If RESUME is not NULL, start after that
+   object.  */
+static int
+iterate_locked (phdr_callback callback, void *data, const void *caller,
+		Lmid_t ns, struct link_map *resume)
 {
   struct link_map *l;
-  struct dl_phdr_info info;
   int ret = 0;
 
   /* Make sure nobody modifies the list of loaded objects.  */
   __rtld_lock_lock_recursive (GL(dl_load_write_lock));
   __libc_cleanup_push (cancel_handler, NULL);
 
+  /* We have to count the total number of loaded objects.  */
+  size_t nloaded = 0;
+  for (Lmid_t cnt = 0; cnt < GL(dl_nns); ++cnt)
+    nloaded += GL(dl_ns)[cnt]._ns_nloaded;
+
   /* We have to determine the namespace of the caller since this determines
      which namespace is reported.  */
-  size_t nloaded = GL(dl_ns)[0]._ns_nloaded;
-  Lmid_t ns = 0;
+  if (ns < 0)
+    {
+      ns = 0;
 #ifdef SHARED
-  const void *caller = RETURN_ADDRESS (0);
-  for (Lmid_t cnt = GL(dl_nns) - 1; cnt > 0; --cnt)
-    for (struct link_map *l = GL(dl_ns)[cnt]._ns_loaded; l; l = l->l_next)
-      {
-	/* We have to count the total number of loaded objects.  */
-	nloaded += GL(dl_ns)[cnt]._ns_nloaded;
-
-	if (caller >= (const void *) l->l_map_start
-	    && caller < (const void *) l->l_map_end
-	    && (l->l_contiguous
-		|| _dl_addr_inside_object (l, (ElfW(Addr)) caller)))
-	  ns = cnt;
-      }
+      for (Lmid_t cnt = GL(dl_nns) - 1; cnt > 0; --cnt)
+	for (l = GL(dl_ns)[cnt]._ns_loaded; l; l = l->l_next)
+	  if (caller >= (const void *) l->l_map_start
+	      && caller < (const void *) l->l_map_end
+	      && (l->l_contiguous
+		  || _dl_addr_inside_object (l, (ElfW(Addr)) caller)))
+	    ns = cnt;
 #endif
+    }
 
-  for (l = GL(dl_ns)[ns]._ns_loaded; l != NULL; l = l->l_next)
+  l = GL(dl_ns)[ns]._ns_loaded;
+  if (resume != NULL)
+    for (struct link_map *m = l; m != NULL; m = m->l_next)
+      if (m == resume)
+	{
+	  l = m->l_next;
+	  break;
+	}
+
+  for (; l != NULL; l = l->l_next)
     {
-      info.dlpi_addr = l->l_real->l_addr;
-      info.dlpi_name = l->l_real->l_name;
-      info.dlpi_phdr = l->l_real->l_phdr;
-      info.dlpi_phnum = l->l_real->l_phnum;
-      info.dlpi_adds = GL(dl_load_adds);
-      info.dlpi_subs = GL(dl_load_adds) - nloaded;
-      info.dlpi_tls_data = NULL;
-      info.dlpi_tls_modid = l->l_real->l_tls_modid;
-      if (info.dlpi_tls_modid != 0)
-	info.dlpi_tls_data = GLRO(dl_tls_get_addr_soft) (l->l_real);
-      ret = callback (&info, sizeof (struct dl_phdr_info), data);
+      ret = report_object (callback, data, l, GL(dl_load_adds), nloaded);
       if (ret)
 	break;
     }
@@ -83,6 +112,221 @@ __dl_iterate_phdr (int (*callback) (struct dl_phdr_info *info,
 
   return ret;
 }
+
+/* Tell a dlclose waiting for readers that a slot has changed.  */
+static void
+reader_changed (void)
+{
+  atomic_full_barrier ();
+  if (atomic_load_relaxed (&GL(dl_phdr_readers_waiters)) != 0)
+    {
+      atomic_fetch_add_relaxed (&GL(dl_phdr_readers_changed), 1);
+      _dl_phdr_readers_wake (&GL(dl_phdr_readers_changed));
+    }
+}
+
+/* Take a reader slot for the calling thread.  While the thread holds
+   it, dlclose does not unmap any object in the snapshot the thread
+   started with or in a later one.  Return NULL if all slots are
+   taken.  */
+static struct dl_phdr_reader *
+reader_enter (void)
+{
+  void *self = THREAD_SELF;
+  /* Thread descriptors are at the same offset in their stacks, which
+     are aligned to pages, so hash the bits above the page offset.  */
+  uint32_t hash = ((uintptr_t) self >> 12) * 0x9e3779b1;
+  size_t start = (hash >> 16) % DL_PHDR_READERS;
+
+  for (size_t i = 0; i < DL_PHDR_READERS; ++i)
+    {
+      struct dl_phdr_reader *reader
+	= &GL(dl_phdr_readers)[(start + i) % DL_PHDR_READERS];
+      unsigned int expected = 0;
+      if (atomic_load_relaxed (&reader->state) == 0
+	  && atomic_compare_exchange_weak_acquire (&reader->state, &expected,
+						   DL_PHDR_READER_CLAIMED))
+	{
+	  atomic_store_relaxed (&reader->thread, self);
+	  /* Pairs with the barrier in _dl_find_object_wait_readers.  */
+	  atomic_full_barrier ();
+	  unsigned int version
+	    = atomic_load_acquire (&GL(dl_find_object_version));
+	  atomic_store_release (&reader->state, version + 2);
+	  reader_changed ();
+	  return reader;
+	}
+    }
+
+  return NULL;
+}
+
+static void
+reader_leave (void *arg)
+{
+  struct dl_phdr_reader *reader = arg;
+
+  atomic_store_release (&reader->state, 0);
+  reader_changed ();
+}
+
+/* Up to this many objects are copied from a snapshot at once.  */
+#define CHUNK_SIZE 16
+
+/* Objects of a namespace copied from a snapshot.  */
+struct chunk
+{
+  unsigned int version;
+  /* Position of MAPS[0] in the namespace.  */
+  size_t pos;
+  size_t count;
+  size_t nloaded;
+  unsigned long long int adds;
+  struct link_map *maps[CHUNK_SIZE];
+};
+
+/* Copy the objects of namespace NS from position POS from the current
+   snapshot to *C.  If RESUME is not NULL, start after that object
+   instead if it is still loaded.  Return false if there is no
+   snapshot.  */
+static bool
+read_chunk (struct chunk *c, Lmid_t ns, size_t pos, struct link_map *resume)
+{
+  while (true)
+    {
+      unsigned int version;
+      struct dl_find_object_table *tab
+	= _dl_find_object_read_begin (&version);
+      if (tab == NULL)
+	return false;
+
+      size_t capacity = tab->capacity;
+      size_t first = ns == 0 ? 0 : atomic_load_relaxed (&tab->ns_end[ns - 1]);
+      size_t end = atomic_load_relaxed (&tab->ns_end[ns]);
+      /* Inconsistent values are caught below, but they must not lead
+	 outside of the table.  */
+      if (end > capacity)
+	end = capacity;
+      if (first > end)
+	first = end;
+
+      c->pos = pos;
+      if (resume != NULL)
+	for (size_t i = first; i < end; ++i)
+	  if (atomic_load_relaxed (&tab->entries[i].map) == resume)
+	    {
+	      c->pos = i + 1 - first;
+	      break;
+	    }
+
+      c->count = 0;
+      for (size_t i = first + c->pos; i < end && c->count < CHUNK_SIZE; ++i)
+	c->maps[c->count++] = atomic_load_relaxed (&tab->entries[i].map);
+      c->nloaded = atomic_load_relaxed (&tab->count);
+      /* Not atomic on all targets, but checked like the rest.  */
+      c->adds = tab->adds;
+
+      if (_dl_find_object_read_valid (version))
+	{
+	  c->version = version;
+	  return true;
+	}
+    }
+}
+
+/* Return the namespace of the object containing CALLER in the current
+   snapshot, or -1 if there is no snapshot.  */
+static Lmid_t
+caller_namespace (const void *caller)
+{
+  while (true)
+    {
+      unsigned int version;
+      struct dl_find_object_table *tab
+	= _dl_find_object_read_begin (&version);
+      if (tab == NULL)
+	return -1;
+
+      struct link_map *l = NULL;
+      ssize_t i = _dl_find_object_search (tab, (uintptr_t) caller);
+      if (i >= 0)
+	l = atomic_load_relaxed (&tab->entries[i].map);
+
+      /* The reader slot keeps L from being freed.  */
+      if (_dl_find_object_read_valid (version))
+	return l == NULL ? 0 : l->l_ns;
+    }
+}
+
+int
+__dl_iterate_phdr (phdr_callback callback, void *data)
+{
+  const void *caller = NULL;
+#ifdef SHARED
+  caller = RETURN_ADDRESS (0);
+#endif
+
+  /* Before the first snapshot is published, and when the reader slots
+     are exhausted, fall back to the lists of loaded objects.  */
+  struct dl_phdr_reader *reader = NULL;
+  if (atomic_load_relaxed (&GL(dl_find_object_version)) != 0)
+    reader = reader_enter ();
+  if (reader == NULL)
+    return iterate_locked (callback, data, caller, -1, NULL);
+
+  int ret = 0;
+  bool locked = false;
+  Lmid_t ns = 0;
+  struct link_map *last = NULL;
+  __libc_cleanup_push (reader_leave, reader);
+
+#ifdef SHARED
+  if (GL(dl_nns) > 1)
+    ns = caller_namespace (caller);
+#endif
+
+  struct chunk c;
+  size_t pos = 0;
+  struct link_map *resume = NULL;
+  while (true)
+    {
+      if (ns < 0 || !read_chunk (&c, ns, pos, resume))
+	{
+	  locked = true;
+	  break;
+	}
+      if (c.count == 0)
+	break;
+
+      /* Objects loaded by the callbacks are reported if they are added
+	 after the current position, as with the lists.  When the
+	 snapshot changes, the objects not yet reported may have been
+	 unloaded, so copy them again.  */
+      resume = NULL;
+      size_t i = 0;
+      while (i < c.count)
+	{
+	  last = c.maps[i++];
+	  ret = report_object (callback, data, last, c.adds, c.nloaded);
+	  if (ret != 0)
+	    goto out;
+	  if (atomic_load_relaxed (&GL(dl_find_object_version)) != c.version)
+	    {
+	      resume = last;
+	      break;
+	    }
+	}
+      pos = c.pos + i;
+    }
+
+ out:
+  __libc_cleanup_pop (1);
+
+  if (locked)
+    ret = iterate_locked (callback, data, caller, ns, last);
+
+  return ret;
+}
 hidden_def (__dl_iterate_phdr)
 
 weak_alias (__dl_iterate_phdr, dl_iterate_phdr);
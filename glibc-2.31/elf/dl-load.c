@@ -526,6 +526,7 @@ fillin_rpath (char *rpath, struct r_search_path_elem **result, const char *sep,
 	  init_val = cp[0] != '/' ? existing : unknown;
 	  for (cnt = 0; cnt < ncapstr; ++cnt)
 	    dirp->status[cnt] = init_val;
+	  dirp->missing = NULL;
 
 	  dirp->what = what;
 	  if (__glibc_likely (where != NULL))
@@ -738,6 +739,7 @@ _dl_init_paths (const char *llp)
       assert (pelem->dirname[0] == '/');
       for (cnt = 0; cnt < ncapstr; ++cnt)
 	pelem->status[cnt] = unknown;
+      pelem->missing = NULL;
 
       pelem->next = (++idx == nsystem_dirs_len ? NULL : (pelem + round_size));
 
@@ -1749,6 +1751,77 @@ open_verify (const char *name, int fd,
   return fd;
 }
 
+/* The files which were not found in a directory of a search path, for
+   the hardware capability subdirectory with index CNT.  Another search
+   for the same file skips the directory, like one which does not
+   exist, without trying to open the file.  The entries are never
+   freed, so they are allocated from pages of their own and not with
+   malloc, which may be the minimal malloc of ld.so.  */
+struct r_missing_file
+  {
+    struct r_missing_file *next;
+    size_t cnt;
+    /* The length of NAME, including the final NUL.  */
+    size_t namelen;
+    char name[];
+  };
+
+/* The unused rest of the page for the next entries.  */
+static char *missing_file_page;
+static size_t missing_file_avail;
+
+/* Return true if NAME of NAMELEN bytes, including the final NUL, was
+   not found in DIR with the capability subdirectory CNT.  */
+static bool
+is_missing_file (const struct r_search_path_elem *dir, size_t cnt,
+		 const char *name, size_t namelen)
+{
+  for (const struct r_missing_file *m = dir->missing; m != NULL;
+       m = m->next)
+    if (m->cnt == cnt && m->namelen == namelen
+	&& memcmp (m->name, name, namelen) == 0)
+      return true;
+  return false;
+}
+
+/* Record that NAME of NAMELEN bytes, including the final NUL, is not
+   in DIR with the capability subdirectory CNT.  Relative directories
+   are not recorded, because the current directory might change.  */
+static void
+add_missing_file (struct r_search_path_elem *dir, size_t cnt,
+		  const char *name, size_t namelen)
+{
+  size_t size = ALIGN_UP (sizeof (struct r_missing_file) + namelen,
+			  __alignof__ (struct r_missing_file));
+
+  if (dir->dirname[0] != '/' || size > GLRO(dl_pagesize))
+    return;
+
+  if (size > missing_file_avail)
+    {
+      void *page = __mmap (NULL, GLRO(dl_pagesize), PROT_READ | PROT_WRITE,
+			   MAP_ANON | MAP_PRIVATE, -1, 0);
+      if (page == MAP_FAILED)
+	{
+	  /* open_path looks at the error of the failed open.  */
+	  __set_errno (ENOENT);
+	  return;
+	}
+      missing_file_page = page;
+      missing_file_avail = GLRO(dl_pagesize);
+    }
+
+  struct r_missing_file *m = (struct r_missing_file *) missing_file_page;
+  missing_file_page += size;
+  missing_file_avail -= size;
+
+  m->cnt = cnt;
+  m->namelen = namelen;
+  memcpy (m->name, name, namelen);
+  m->next = dir->missing;
+  dir->missing = m;
+}
+
 /* Try to open NAME in one of the directories in *DIRSP.
    Return the fd, or -1.  If successful, fill in *REALNAME
    with the malloc'd full directory name.  If it turns out
@@ -1799,6 +1872,15 @@ open_path (const char *name, size_t namelen, int mode,
 	  if (this_dir->status[cnt] == nonexisting)
 	    continue;
 
+	  /* Skip it as well if an earlier search did not find the
+	     file there.  */
+	  if (is_missing_file (this_dir, cnt, name, namelen))
+	    {
+	      here_any = 1;
+	      __set_errno (ENOENT);
+	      continue;
+	    }
+
 	  buflen =
 	    ((char *) __mempcpy (__mempcpy (edp, capstr[cnt].str,
 					    capstr[cnt].len),
@@ -1809,8 +1891,14 @@ open_path (const char *name, size_t namelen, int mode,
 	  if (__glibc_unlikely (GLRO(dl_debug_mask) & DL_DEBUG_LIBS))
 	    _dl_debug_printf ("  trying file=%s\n", buf);
 
+	  bool other_class = false;
 	  fd = open_verify (buf, -1, fbp, loader, whatcode, mode,
-			    found_other_class, false);
+			    &other_class, false);
+	  *found_other_class |= other_class;
+	  if (fd == -1 && errno == ENOENT && !other_class
+	      && (loader == NULL
+		  || GL(dl_ns)[loader->l_ns]._ns_loaded->l_auditing == 0))
+	    add_missing_file (this_dir, cnt, name, namelen);
 	  if (this_dir->status[cnt] == unknown)
 	    {
 	      if (fd != -1)
@@ -21,6 +21,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
+#include <sys/mman.h>
 #include <ldsodefs.h>
 #include <dl-hash.h>
 #include <dl-machine.h>
@@ -50,8 +51,10 @@ struct sym_val
 /* Statistics function.  */
 #ifdef SHARED
 # define bump_num_relocations() ++GL(dl_num_relocations)
+# define bump_num_lookup_cache_hits() ++GL(dl_num_lookup_cache_hits)
 #else
 # define bump_num_relocations() ((void) 0)
+# define bump_num_lookup_cache_hits() ((void) 0)
 #endif
 
 /* Utility function for do_lookup_x. The caller is called with undef_name,
@@ -554,6 +557,14 @@ do_lookup_x (const char *undef_name, uint_fast32_t new_hash,
 	      return 1;
 
 	    case STB_GNU_UNIQUE:;
+	      if (__glibc_unlikely ((flags & DL_LOOKUP_PREFETCH) != 0))
+		{
+		  /* The definition is not entered into the table of
+		     unique symbols, so the lookup has to be repeated.  */
+		  result->s = sym;
+		  result->m = (struct link_map *) map;
+		  return 1;
+		}
 	      do_lookup_unique (undef_name, new_hash, (struct link_map *) map,
 				result, type_class, sym, strtab, ref,
 				undef_map, flags);
@@ -575,6 +586,221 @@ skip:
 }
 
 
+/* The results of do_lookup_x for relocations are cached while objects
+   are relocated between _dl_lookup_cache_begin and _dl_lookup_cache_end.
+   The relocations of many objects refer to the same symbols, and each
+   lookup would otherwise search every object of the scope.  The result
+   only depends on the symbol name, version and type class and on the
+   scope, as long as none of the objects in the scope is removed, which
+   _dl_lookup_cache_flush handles.  The cache is only used with
+   GL(dl_load_lock) held or before other threads exist, like the
+   relocation code itself.  */
+struct lookup_cache_entry
+{
+  /* NULL if the entry is unused.  */
+  const char *name;
+  const struct r_scope_elem *scope;
+  /* NULL for lookups without version.  */
+  const char *version_name;
+  ElfW(Word) version_hash;
+  int version_hidden;
+  uint32_t hash;
+  int type_class;
+  /* RESULT.s is NULL if the symbol is not defined in SCOPE.  */
+  struct sym_val result;
+};
+
+static struct
+{
+  struct lookup_cache_entry *entries;
+  /* The number of entries, a power of two, and of those in use.  */
+  size_t size;
+  size_t used;
+  /* Set between _dl_lookup_cache_begin and _dl_lookup_cache_end.  */
+  bool active;
+} lookup_cache;
+
+/* The number of entries first allocated.  */
+#define LOOKUP_CACHE_INITIAL	1024
+
+/* Return the first slot to search for a lookup.  VERSION_HASH is zero
+   for lookups without version.  */
+static size_t
+lookup_cache_slot (uint32_t hash, const struct r_scope_elem *scope,
+		   ElfW(Word) version_hash, int type_class)
+{
+  size_t h = (hash ^ ((uintptr_t) scope >> 4) ^ type_class
+	      ^ version_hash * 0x9e3779b1);
+  return h & (lookup_cache.size - 1);
+}
+
+static bool
+lookup_cache_match (const struct lookup_cache_entry *e, const char *name,
+		    uint32_t hash, const struct r_scope_elem *scope,
+		    const struct r_found_version *version, int type_class)
+{
+  if (e->hash != hash || e->scope != scope || e->type_class != type_class)
+    return false;
+  if (version == NULL)
+    {
+      if (e->version_name != NULL)
+	return false;
+    }
+  else if (e->version_name == NULL
+	   || e->version_hash != version->hash
+	   || e->version_hidden != version->hidden
+	   || strcmp (e->version_name, version->name) != 0)
+    return false;
+  return e->name == name || strcmp (e->name, name) == 0;
+}
+
+/* Double the size of the cache, or allocate it.  Return false if there
+   is no memory.  */
+static bool
+lookup_cache_grow (void)
+{
+  size_t newsize = (lookup_cache.size == 0
+		    ? LOOKUP_CACHE_INITIAL : 2 * lookup_cache.size);
+  struct lookup_cache_entry *newentries
+    = __mmap (NULL, newsize * sizeof (struct lookup_cache_entry),
+	      PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
+  if (newentries == MAP_FAILED)
+    return false;
+
+  struct lookup_cache_entry *oldentries = lookup_cache.entries;
+  size_t oldsize = lookup_cache.size;
+  lookup_cache.entries = newentries;
+  lookup_cache.size = newsize;
+
+  for (size_t i = 0; i < oldsize; ++i)
+    if (oldentries[i].name != NULL)
+      {
+	const struct lookup_cache_entry *e = &oldentries[i];
+	size_t slot = lookup_cache_slot (e->hash, e->scope, e->version_hash,
+					 e->type_class);
+	while (newentries[slot].name != NULL)
+	  slot = (slot + 1) & (newsize - 1);
+	newentries[slot] = *e;
+      }
+
+  if (oldentries != NULL)
+    __munmap (oldentries, oldsize * sizeof (struct lookup_cache_entry));
+  return true;
+}
+
+void
+_dl_lookup_cache_flush (void)
+{
+  if (lookup_cache.used != 0)
+    {
+      memset (lookup_cache.entries, '\0',
+	      lookup_cache.size * sizeof (struct lookup_cache_entry));
+      lookup_cache.used = 0;
+    }
+}
+
+void
+_dl_lookup_cache_begin (void)
+{
+  /* A dlopen call from an IFUNC resolver starts a pass while another
+     one is active.  It loads new objects, so the results so far are
+     not valid.  */
+  _dl_lookup_cache_flush ();
+  lookup_cache.active = true;
+}
+
+void
+_dl_lookup_cache_end (void)
+{
+  lookup_cache.active = false;
+  if (lookup_cache.entries != NULL)
+    {
+      __munmap (lookup_cache.entries,
+		lookup_cache.size * sizeof (struct lookup_cache_entry));
+      lookup_cache.entries = NULL;
+      lookup_cache.size = 0;
+      lookup_cache.used = 0;
+    }
+}
+
+/* Like do_lookup_x, but use the cache if it applies.  It does not for
+   lookups which skip objects, which are not done for relocations or
+   while the symbol lookups are traced, and if a weak definition does
+   not end the search.  */
+static int
+do_lookup_cached (const char *undef_name, uint_fast32_t new_hash,
+		  unsigned long int *old_hash, const ElfW(Sym) *ref,
+		  struct sym_val *result, struct r_scope_elem *scope,
+		  size_t i, const struct r_found_version *const version,
+		  int flags, struct link_map *skip, int type_class,
+		  struct link_map *undef_map)
+{
+  if (!lookup_cache.active
+      || (flags & DL_LOOKUP_FOR_RELOCATE) == 0
+      || skip != NULL || i != 0
+      || GLRO(dl_dynamic_weak)
+      || (GLRO(dl_debug_mask) & DL_DEBUG_SYMBOLS) != 0)
+    return do_lookup_x (undef_name, new_hash, old_hash, ref, result, scope,
+			i, version, flags, skip, type_class, undef_map);
+
+  ElfW(Word) version_hash = version != NULL ? version->hash : 0;
+  size_t slot = 0;
+  if (lookup_cache.entries != NULL)
+    {
+      slot = lookup_cache_slot (new_hash, scope, version_hash, type_class);
+      while (lookup_cache.entries[slot].name != NULL)
+	{
+	  const struct lookup_cache_entry *e = &lookup_cache.entries[slot];
+	  if (lookup_cache_match (e, undef_name, new_hash, scope, version,
+				  type_class))
+	    {
+	      bump_num_lookup_cache_hits ();
+	      if (e->result.s == NULL)
+		return 0;
+	      *result = e->result;
+	      return 1;
+	    }
+	  slot = (slot + 1) & (lookup_cache.size - 1);
+	}
+    }
+
+  int res = do_lookup_x (undef_name, new_hash, old_hash, ref, result, scope,
+			 i, version, flags, skip, type_class, undef_map);
+
+  /* do_lookup_unique records the objects using a unique symbol, so it
+     has to see each lookup.  */
+  if (res < 0
+      || (res > 0
+	  && ELFW(ST_BIND) (result->s->st_info) == STB_GNU_UNIQUE))
+    return res;
+
+  /* Keep the table at most half full.  */
+  if (2 * (lookup_cache.used + 1) > lookup_cache.size)
+    {
+      if (!lookup_cache_grow ())
+	return res;
+      slot = lookup_cache_slot (new_hash, scope, version_hash, type_class);
+      while (lookup_cache.entries[slot].name != NULL)
+	slot = (slot + 1) & (lookup_cache.size - 1);
+    }
+
+  struct lookup_cache_entry *e = &lookup_cache.entries[slot];
+  e->name = undef_name;
+  e->scope = scope;
+  e->version_name = version != NULL ? version->name : NULL;
+  e->version_hash = version_hash;
+  e->version_hidden = version != NULL ? version->hidden : 0;
+  e->hash = new_hash;
+  e->type_class = type_class;
+  if (res > 0)
+    e->result = *result;
+  else
+    e->result = (struct sym_val) { NULL, NULL };
+  ++lookup_cache.used;
+  return res;
+}
+
+
 static uint_fast32_t
 dl_new_hash (const char *s)
 {
@@ -858,9 +1084,9 @@ _dl_lookup_symbol_x (const char *undef_name, struct link_map *undef_map,
 
   /* Search the relevant loaded objects for a definition.  */
   for (size_t start = i; *scope != NULL; start = 0, ++scope)
-    if (do_lookup_x (undef_name, new_hash, &old_hash, *ref,
-		     &current_value, *scope, start, version, flags,
-		     skip_map, type_class, undef_map) != 0)
+    if (do_lookup_cached (undef_name, new_hash, &old_hash, *ref,
+			  &current_value, *scope, start, version, flags,
+			  skip_map, type_class, undef_map) != 0)
       break;
 
   if (__glibc_unlikely (current_value.s == NULL))
@@ -954,6 +1180,47 @@ _dl_lookup_symbol_x (const char *undef_name, struct link_map *undef_map,
 }
 
 
+#ifdef SHARED
+/* Look up UNDEF_NAME like _dl_lookup_symbol_x for a relocation of
+   UNDEF_MAP, but without any side effects, so that several lookups can
+   run at the same time.  Return false if _dl_lookup_symbol_x must do
+   the lookup: if no definition is found, if it is a unique symbol, if
+   *REF is protected, or if the definition is in a dynamically loaded
+   object.  Otherwise store the definition in *REF and its object in
+   *MAPP.  */
+bool
+_dl_lookup_symbol_prefetch (const char *undef_name,
+			    struct link_map *undef_map,
+			    const ElfW(Sym) **ref,
+			    struct r_scope_elem *symbol_scope[],
+			    const struct r_found_version *version,
+			    int type_class, struct link_map **mapp)
+{
+  const uint_fast32_t new_hash = dl_new_hash (undef_name);
+  unsigned long int old_hash = 0xffffffff;
+  struct sym_val current_value = { NULL, NULL };
+
+  if (ELFW(ST_VISIBILITY) ((*ref)->st_other) == STV_PROTECTED)
+    return false;
+
+  for (struct r_scope_elem **scope = symbol_scope; *scope != NULL; ++scope)
+    if (do_lookup_x (undef_name, new_hash, &old_hash, *ref,
+		     &current_value, *scope, 0, version, DL_LOOKUP_PREFETCH,
+		     NULL, type_class, undef_map) != 0)
+      break;
+
+  if (current_value.s == NULL
+      || ELFW(ST_BIND) (current_value.s->st_info) == STB_GNU_UNIQUE
+      || current_value.m->l_type == lt_loaded)
+    return false;
+
+  *ref = current_value.s;
+  *mapp = current_value.m;
+  return true;
+}
+#endif
+
+
 /* Cache the location of MAP's hash table.  */
 
 void
@@ -651,6 +651,7 @@ dl_open_worker (void *a)
      them.  However, such relocation dependencies in IFUNC resolvers
      are undefined anyway, so this is not a problem.  */
 
+  _dl_lookup_cache_begin ();
   for (unsigned int i = nmaps; i-- > 0; )
     {
       l = maps[i];
@@ -687,6 +688,7 @@ dl_open_worker (void *a)
 #endif
 	_dl_relocate_object (l, l->l_scope, reloc_mode, 0);
     }
+  _dl_lookup_cache_end ();
 
   /* This only performs the memory allocations.  The actual update of
      the scopes happens below, after failure is impossible.  */
@@ -731,6 +733,10 @@ dl_open_worker (void *a)
        on memory allocation failure.  See bug 16134.  */
     update_tls_slotinfo (new);
 
+  /* Make the new objects visible to _dl_find_object and
+     dl_iterate_phdr before their initializers can throw.  */
+  _dl_find_object_update ();
+
   /* Notify the debugger all new objects have been relocated.  */
   if (relocation_in_progress)
     LIBC_PROBE (reloc_complete, 3, args->nsid, r, new);
@@ -857,6 +863,9 @@ no more namespaces available for dlmopen()"));
   /* See if an error occurred during loading.  */
   if (__glibc_unlikely (exception.errstring != NULL))
     {
+      /* The relocation of the new objects may have failed.  */
+      _dl_lookup_cache_end ();
+
       /* Remove the object from memory.  It may be in an inconsistent
 	 state if relocation failed, for example.  */
       if (args.map)
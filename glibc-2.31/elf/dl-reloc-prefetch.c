@@ -0,0 +1,350 @@
+/* Symbol lookups for the relocations at startup on helper threads.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+/* Most of the time spent relocating the objects loaded at startup goes
+   into the symbol lookups, which only read the objects.  If the
+   glibc.rtld.reloc_threads tunable is set, that many helper threads
+   and the main thread look up the symbols referenced by the
+   relocations of the objects in the global scope before they are
+   relocated, one object at a time, and store the results in a table
+   for each object.  Applying the relocations, which may call IFUNC
+   resolvers, copy data or signal errors, remains serial and in the
+   usual order; it takes the results from the tables and repeats the
+   lookups which could not be done in advance.  */
+
+#include <stdint.h>
+#include <sys/mman.h>
+#include <atomic.h>
+#include <ldsodefs.h>
+#include <dl-machine.h>
+#include <dl-helper-thread.h>
+
+#if HAVE_TUNABLES
+# define TUNABLE_NAMESPACE rtld
+# include <dl-tunables.h>
+#endif
+
+/* The memory of all tables.  */
+static struct prefetched_binding *prefetch_tables;
+static size_t prefetch_tables_size;
+
+/* The objects to work on, shared by all threads.  */
+struct prefetch_work
+{
+  struct link_map **objects;
+  unsigned int nobjects;
+  /* The index of the next object to work on.  */
+  unsigned int next;
+};
+
+/* Return the slot of the table of L for the lookup of the symbol with
+   index SYMIDX for a relocation of TYPE_CLASS.  */
+static inline unsigned int
+prefetched_slot (const struct link_map *l, unsigned int symidx,
+		 int type_class)
+{
+  unsigned int slot = (symidx * 2654435761U + type_class)
+		      & l->l_prefetched_mask;
+
+  while (l->l_prefetched[slot].symidx != 0
+	 && (l->l_prefetched[slot].symidx != symidx
+	     || l->l_prefetched[slot].type_class != type_class))
+    slot = (slot + 1) & l->l_prefetched_mask;
+  return slot;
+}
+
+/* Return the size of the range of the PLT relocations of L, which are
+   stored in *START, and set *ENTSIZE to the size of an entry.  */
+static ElfW(Addr)
+plt_relocs (struct link_map *l, ElfW(Addr) *start, size_t *entsize)
+{
+  if (l->l_info[DT_JMPREL] == NULL)
+    return 0;
+
+  *start = D_PTR (l, l_info[DT_JMPREL]);
+  *entsize = (l->l_info[DT_PLTREL]->d_un.d_val == DT_RELA
+	      ? sizeof (ElfW(Rela)) : sizeof (ElfW(Rel)));
+  return l->l_info[DT_PLTRELSZ]->d_un.d_val;
+}
+
+/* Return true if the PLT relocations of L are processed lazily.  */
+static inline bool
+lazy_plt_relocs (struct link_map *l)
+{
+  return GLRO(dl_lazy) && l->l_info[DT_BIND_NOW] == NULL;
+}
+
+/* Call FN (L, R_INFO) for each relocation of L which might refer to a
+   symbol, and return the number of relocations.  Overlapping ranges
+   are visited twice.  */
+static size_t
+scan_relocs (struct link_map *l,
+	     void (*fn) (struct link_map *, ElfW(Addr) r_info))
+{
+  static const struct
+  {
+    int tag;
+    int sztag;
+    int counttag;
+    size_t entsize;
+  } tables[] =
+    {
+      { DT_RELA, DT_RELASZ, VERSYMIDX (DT_RELACOUNT), sizeof (ElfW(Rela)) },
+      { DT_REL, DT_RELSZ, VERSYMIDX (DT_RELCOUNT), sizeof (ElfW(Rel)) },
+    };
+  ElfW(Addr) pltstart = 0;
+  size_t pltentsize = 0;
+  ElfW(Addr) pltsize = plt_relocs (l, &pltstart, &pltentsize);
+  size_t count = 0;
+
+  for (size_t t = 0; t < sizeof tables / sizeof tables[0]; ++t)
+    if (l->l_info[tables[t].tag] != NULL)
+      {
+	ElfW(Addr) start = D_PTR (l, l_info[tables[t].tag]);
+	ElfW(Addr) size = l->l_info[tables[t].sztag]->d_un.d_val;
+
+	/* The PLT relocations may follow the others.  */
+	if (pltsize != 0 && start + size == pltstart + pltsize)
+	  size -= pltsize;
+
+	/* The relative relocations come first and need no symbols.  */
+	if (l->l_info[tables[t].counttag] != NULL)
+	  {
+	    ElfW(Addr) skip = (l->l_info[tables[t].counttag]->d_un.d_val
+			       * tables[t].entsize);
+	    start += skip < size ? skip : size;
+	    size -= skip < size ? skip : size;
+	  }
+
+	for (ElfW(Addr) r = start; r < start + size; r += tables[t].entsize)
+	  {
+	    /* The r_info members of ElfW(Rel) and ElfW(Rela) are at the
+	       same place.  */
+	    if (fn != NULL)
+	      fn (l, ((const ElfW(Rel) *) r)->r_info);
+	    ++count;
+	  }
+      }
+
+  if (!lazy_plt_relocs (l))
+    for (ElfW(Addr) r = pltstart; r < pltstart + pltsize; r += pltentsize)
+      {
+	if (fn != NULL)
+	  fn (l, ((const ElfW(Rel) *) r)->r_info);
+	++count;
+      }
+
+  return count;
+}
+
+/* Look up the symbol referenced by the relocation of L with R_INFO as
+   the RESOLVE_MAP macro in elf/dl-reloc.c does, and store the result
+   in the table of L.  */
+static void
+prefetch_lookup (struct link_map *l, ElfW(Addr) r_info)
+{
+  unsigned int symidx = ELFW(R_SYM) (r_info);
+  if (symidx == STN_UNDEF)
+    return;
+
+  const ElfW(Sym) *ref = (const ElfW(Sym) *) D_PTR (l, l_info[DT_SYMTAB]);
+  ref += symidx;
+  if (ELFW(ST_BIND) (ref->st_info) == STB_LOCAL
+      || dl_symbol_visibility_binds_local_p (ref))
+    return;
+
+  int type_class = elf_machine_type_class (ELFW(R_TYPE) (r_info));
+  struct prefetched_binding *entry
+    = &l->l_prefetched[prefetched_slot (l, symidx, type_class)];
+  if (entry->symidx != 0)
+    return;
+  entry->symidx = symidx;
+  entry->type_class = type_class;
+
+  const struct r_found_version *version = NULL;
+  if (l->l_info[VERSYMIDX (DT_VERSYM)] != NULL)
+    {
+      const ElfW(Half) *versym
+	= (const void *) D_PTR (l, l_info[VERSYMIDX (DT_VERSYM)]);
+      ElfW(Half) ndx = versym[symidx] & 0x7fff;
+      if (l->l_versions[ndx].hash != 0)
+	version = &l->l_versions[ndx];
+    }
+
+  const char *strtab = (const void *) D_PTR (l, l_info[DT_STRTAB]);
+  struct link_map *map;
+  if (_dl_lookup_symbol_prefetch (strtab + ref->st_name, l, &ref,
+				  l->l_scope, version, type_class, &map))
+    {
+      entry->map = map;
+      entry->sym = ref;
+    }
+}
+
+/* The function run by all threads.  It must not use thread-local
+   storage, see _dl_helper_thread_start.  */
+static int
+prefetch_worker (void *closure)
+{
+  struct prefetch_work *work = closure;
+
+  while (1)
+    {
+      unsigned int i = atomic_fetch_add_relaxed (&work->next, 1);
+      if (i >= work->nobjects)
+	break;
+      scan_relocs (work->objects[i], prefetch_lookup);
+    }
+  return 0;
+}
+
+void
+_dl_relocate_prefetch (struct link_map *main_map)
+{
+#if HAVE_TUNABLES
+  unsigned int nthreads = TUNABLE_GET (reloc_threads, int32_t, NULL);
+#else
+  unsigned int nthreads = 0;
+#endif
+  unsigned int nlist = main_map->l_searchlist.r_nlist;
+
+  /* The bindings must be printed in the order of the relocations.  */
+  if (nthreads == 0 || nlist < 2
+      || (GLRO(dl_debug_mask)
+	  & (DL_DEBUG_SYMBOLS | DL_DEBUG_BINDINGS | DL_DEBUG_PRELINK)))
+    return;
+
+  /* Size the tables for twice the number of relocations, and sort the
+     objects by decreasing size of the tables so that the threads start
+     with the large ones.  ld.so is relocated separately.  */
+  struct link_map *objects[nlist];
+  unsigned int nobjects = 0;
+  size_t nentries = 0;
+  for (unsigned int i = 0; i < nlist; ++i)
+    {
+      struct link_map *l = main_map->l_searchlist.r_list[i];
+      if (l == &GL(dl_rtld_map) || l->l_relocated
+	  || l->l_bindcache_idx != 0)
+	continue;
+
+      size_t count = scan_relocs (l, NULL);
+      if (count == 0)
+	continue;
+      unsigned int size = 16;
+      while (size < 2 * count)
+	size *= 2;
+      l->l_prefetched_mask = size - 1;
+      nentries += size;
+
+      unsigned int j = nobjects++;
+      while (j > 0 && objects[j - 1]->l_prefetched_mask < size - 1)
+	{
+	  objects[j] = objects[j - 1];
+	  --j;
+	}
+      objects[j] = l;
+    }
+  if (nobjects < 2)
+    return;
+
+  prefetch_tables_size = nentries * sizeof (struct prefetched_binding);
+  prefetch_tables = __mmap (NULL, prefetch_tables_size,
+			    PROT_READ | PROT_WRITE,
+			    MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
+  if (prefetch_tables == MAP_FAILED)
+    {
+      prefetch_tables = NULL;
+      return;
+    }
+
+  struct prefetch_work work =
+    {
+      .objects = objects,
+      .nobjects = nobjects,
+      .next = 0
+    };
+  struct prefetched_binding *table = prefetch_tables;
+  for (unsigned int i = 0; i < nobjects; ++i)
+    {
+      objects[i]->l_prefetched = table;
+      table += objects[i]->l_prefetched_mask + 1;
+    }
+
+  if (nthreads > nobjects - 1)
+    nthreads = nobjects - 1;
+  struct dl_helper_thread threads[nthreads];
+  unsigned int started = 0;
+  while (started < nthreads
+	 && _dl_helper_thread_start (&threads[started], prefetch_worker,
+				     &work))
+    ++started;
+
+  /* Without helper threads nothing is gained.  */
+  if (started == 0)
+    {
+      _dl_relocate_prefetch_finish (main_map);
+      return;
+    }
+
+  if (__glibc_unlikely (GLRO(dl_debug_mask) & DL_DEBUG_RELOC))
+    _dl_debug_printf ("\nlooking up symbols of %u objects on %u threads\n",
+		      nobjects, started + 1);
+
+  prefetch_worker (&work);
+  for (unsigned int i = 0; i < started; ++i)
+    _dl_helper_thread_join (&threads[i]);
+}
+
+lookup_t
+_dl_prefetched_lookup (const char *undef_name, struct link_map *l,
+		       const ElfW(Sym) **ref, struct r_scope_elem *scope[],
+		       const struct r_found_version *version, int type_class)
+{
+  const ElfW(Sym) *symtab = (const void *) D_PTR (l, l_info[DT_SYMTAB]);
+  const struct prefetched_binding *entry
+    = &l->l_prefetched[prefetched_slot (l, *ref - symtab, type_class)];
+
+  if (entry->map == NULL)
+    return _dl_lookup_symbol_x (undef_name, l, ref, scope, version,
+				type_class,
+				DL_LOOKUP_ADD_DEPENDENCY
+				| DL_LOOKUP_FOR_RELOCATE, NULL);
+
+  ++GL(dl_num_relocations);
+  if (__glibc_unlikely (entry->map->l_used == 0))
+    entry->map->l_used = 1;
+  *ref = entry->sym;
+  return LOOKUP_VALUE (entry->map);
+}
+
+void
+_dl_relocate_prefetch_finish (struct link_map *main_map)
+{
+  for (unsigned int i = 0; i < main_map->l_searchlist.r_nlist; ++i)
+    {
+      struct link_map *l = main_map->l_searchlist.r_list[i];
+      l->l_prefetched = NULL;
+      l->l_prefetched_mask = 0;
+    }
+
+  if (prefetch_tables != NULL)
+    {
+      __munmap (prefetch_tables, prefetch_tables_size);
+      prefetch_tables = NULL;
+    }
+}
@@ -35,6 +35,25 @@
 # define bump_num_cache_relocations() ((void) 0)
 #endif
 
+/* Look up a symbol for a relocation of L.  The objects loaded at
+   startup may use the binding cache or the results of the lookups
+   done in advance.  */
+#ifdef SHARED
+# define RESOLVE_LOOKUP(name, l, ref, scope, version, type_class) \
+  (__glibc_unlikely ((l)->l_bindcache_idx != 0)				      \
+   ? _dl_bindcache_lookup (name, l, ref, scope, version, type_class)	      \
+   : __glibc_unlikely ((l)->l_prefetched != NULL)			      \
+   ? _dl_prefetched_lookup (name, l, ref, scope, version, type_class)	      \
+   : _dl_lookup_symbol_x (name, l, ref, scope, version, type_class,	      \
+			  DL_LOOKUP_ADD_DEPENDENCY | DL_LOOKUP_FOR_RELOCATE,  \
+			  NULL))
+#else
+# define RESOLVE_LOOKUP(name, l, ref, scope, version, type_class) \
+  _dl_lookup_symbol_x (name, l, ref, scope, version, type_class,	      \
+		       DL_LOOKUP_ADD_DEPENDENCY | DL_LOOKUP_FOR_RELOCATE,     \
+		       NULL)
+#endif
+
 
 /* We are trying to perform a static TLS relocation in MAP, but it was
    dynamically loaded.  This can only work if there is enough surplus in
@@ -242,10 +261,8 @@ _dl_relocate_object (struct link_map *l, struct r_scope_elem *scope[],
 	     const struct r_found_version *v = NULL;			      \
 	     if ((version) != NULL && (version)->hash != 0)		      \
 	       v = (version);						      \
-	     _lr = _dl_lookup_symbol_x (strtab + (*ref)->st_name, l, (ref),   \
-					scope, v, _tc,			      \
-					DL_LOOKUP_ADD_DEPENDENCY	      \
-					| DL_LOOKUP_FOR_RELOCATE, NULL);      \
+	     _lr = RESOLVE_LOOKUP (strtab + (*ref)->st_name, l, (ref),	      \
+				   scope, v, _tc);			      \
 	     l->l_lookup_cache.ret = (*ref);				      \
 	     l->l_lookup_cache.value = _lr; }))				      \
      : l)
@@ -220,6 +220,13 @@ __rtld_lock_define_initialized_recursive (, _dl_load_lock)
    that list.  */
 __rtld_lock_define_initialized_recursive (, _dl_load_write_lock)
 
+/* Snapshots of the loaded objects, see dl-find_object.c.  */
+unsigned int _dl_find_object_version;
+struct dl_find_object_table *_dl_find_object_tables[2];
+struct dl_phdr_reader _dl_phdr_readers[DL_PHDR_READERS];
+unsigned int _dl_phdr_readers_changed;
+unsigned int _dl_phdr_readers_waiters;
+
 
 #ifdef HAVE_AUX_VECTOR
 int _dl_clktck;
@@ -391,6 +398,9 @@ _dl_non_dynamic_init (void)
   /* Setup relro on the binary itself.  */
   if (_dl_main_map.l_relro_size != 0)
     _dl_protect_relro (&_dl_main_map);
+
+  /* Let _dl_find_object and dl_iterate_phdr work without a lock.  */
+  _dl_find_object_update ();
 }
 
 #ifdef DL_SYSINFO_IMPLEMENTATION
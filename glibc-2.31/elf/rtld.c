@@ -2241,6 +2241,9 @@ ERROR: '%s': cannot process note segment.\n", _dl_argv[0]);
 
       RTLD_TIMING_VAR (start);
       rtld_timer_start (&start);
+      _dl_bindcache_setup (main_map);
+      _dl_relocate_prefetch (main_map);
+      _dl_lookup_cache_begin ();
       unsigned i = main_map->l_searchlist.r_nlist;
       while (i-- > 0)
 	{
@@ -2267,6 +2270,9 @@ ERROR: '%s': cannot process note segment.\n", _dl_argv[0]);
 	  if (l->l_tls_blocksize != 0 && tls_init_tp_called)
 	    _dl_add_to_slotinfo (l, true);
 	}
+      _dl_lookup_cache_end ();
+      _dl_relocate_prefetch_finish (main_map);
+      _dl_bindcache_finish ();
       rtld_timer_stop (&relocate_time, start);
 
       /* Now enable profiling if needed.  Like the previous call,
@@ -2348,6 +2354,10 @@ ERROR: '%s': cannot process note segment.\n", _dl_argv[0]);
     }
 #endif
 
+  /* From now on, _dl_find_object and dl_iterate_phdr use snapshots
+     of the loaded objects instead of taking a lock.  */
+  _dl_find_object_update ();
+
   /* Notify the debugger all new objects are now ready to go.  We must re-get
      the address since by now the variable might be in another object.  */
   r = _dl_debug_initialize (0, LM_ID_BASE);
@@ -2608,14 +2618,23 @@ process_envvars (enum mode *modep)
 	    _dl_show_auxv ();
 	  break;
 
-#if !HAVE_TUNABLES
 	case 10:
+	  /* Where to keep the binding cache files.  */
+	  if (!__libc_enable_secure
+	      && memcmp (envline, "BIND_CACHE", 10) == 0)
+	    {
+	      if (envline[11] != '\0')
+		GLRO(dl_bindcache_dir) = &envline[11];
+	      break;
+	    }
+
+#if !HAVE_TUNABLES
 	  /* Mask for the important hardware capabilities.  */
 	  if (!__libc_enable_secure
 	      && memcmp (envline, "HWCAP_MASK", 10) == 0)
 	    GLRO(dl_hwcap_mask) = _dl_strtoul (&envline[11], NULL);
-	  break;
 #endif
+	  break;
 
 	case 11:
 	  /* Path where the binary is found.  */
@@ -2830,10 +2849,12 @@ print_statistics (const hp_timing_t *rtld_total_timep)
 
   _dl_debug_printf ("                 number of relocations: %lu\n"
 		    "      number of relocations from cache: %lu\n"
-		    "        number of relative relocations: %lu\n",
+		    "        number of relative relocations: %lu\n"
+		    "      number of lookups from the cache: %lu\n",
 		    GL(dl_num_relocations),
 		    GL(dl_num_cache_relocations),
-		    num_relative_relocations);
+		    num_relative_relocations,
+		    GL(dl_num_lookup_cache_hits));
 
 #if HP_TIMING_INLINE
   print_statistics_item ("           time needed to load objects",
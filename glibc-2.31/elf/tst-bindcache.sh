@@ -0,0 +1,55 @@
+#!/bin/sh
+# Test the binding cache of ld.so.
+# Copyright (C) 2020 Free Software Foundation, Inc.
+# This file is part of the GNU C Library.
+#
+# The GNU C Library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# The GNU C Library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with the GNU C Library; if not, see
+# <https://www.gnu.org/licenses/>.
+
+set -e
+
+rtld=$1
+test_program=$2
+test_wrapper_env=$3
+run_program_env=$4
+library_path=$5
+cache_dir=$6
+
+rm -rf "$cache_dir"
+mkdir "$cache_dir"
+
+# Run the test program with the binding cache, and check that it
+# succeeds and that ld.so reports how it used the cache.
+run ()
+{
+  echo "# [LD_BIND_CACHE=$cache_dir] [$test_program]: expecting $1"
+  ${test_wrapper_env} \
+  ${run_program_env} \
+  LD_BIND_CACHE="$cache_dir" LD_DEBUG=reloc \
+  $rtld --library-path "$library_path" $test_program \
+    > "$cache_dir/output" 2>&1 && rc=0 || rc=$?
+  grep -v "relocation processing" "$cache_dir/output" || true
+  echo "# exit status $rc"
+  test $rc -eq 0 || exit $rc
+  grep -q "$1 binding cache" "$cache_dir/output"
+}
+
+# The first run records the bindings unless some of the objects have
+# no build ID, which is necessary to recognize them.
+run recording || {
+  echo "# binding cache not recorded"
+  exit 77
+}
+# The second one uses them.
+run using
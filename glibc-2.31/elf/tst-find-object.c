@@ -0,0 +1,126 @@
+/* Test _dl_find_object and dl_iterate_phdr while objects are unloaded.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <dlfcn.h>
+#include <gnu/lib-names.h>
+#include <link.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <support/check.h>
+#include <support/xdlfcn.h>
+#include <support/xthread.h>
+
+#define MODULE "tst-lookup-cache-late1.so"
+
+/* Check that ADDRESS is in the object with the handle HANDLE.  */
+static void
+check_address (void *address, void *handle)
+{
+  struct dl_find_object dlfo;
+
+  TEST_COMPARE (_dl_find_object (address, &dlfo), 0);
+  TEST_VERIFY (dlfo.dlfo_link_map == handle);
+  TEST_VERIFY (dlfo.dlfo_map_start <= address);
+  TEST_VERIFY (address < dlfo.dlfo_map_end);
+  TEST_COMPARE (dlfo.dlfo_flags, 0);
+}
+
+static int
+count_objects (struct dl_phdr_info *info, size_t size, void *data)
+{
+  ++*(size_t *) data;
+  return 0;
+}
+
+/* Close the handle in DATA on the first call.  This must not wait for
+   the dl_iterate_phdr call of the same thread.  */
+static int
+close_module (struct dl_phdr_info *info, size_t size, void *data)
+{
+  void **handle = data;
+  if (*handle != NULL)
+    {
+      xdlclose (*handle);
+      *handle = NULL;
+    }
+  return 0;
+}
+
+static volatile bool done;
+
+/* The address of printf in libc.  &printf is the address of a PLT
+   entry of the program if it is not position-independent.  */
+static void *printf_address;
+
+static void *
+reader (void *closure)
+{
+  while (!done)
+    {
+      struct dl_find_object dlfo;
+      size_t count = 0;
+
+      TEST_VERIFY (dl_iterate_phdr (count_objects, &count) == 0);
+      TEST_VERIFY (count > 2);
+      TEST_COMPARE (_dl_find_object ((void *) &reader, &dlfo), 0);
+      TEST_COMPARE (_dl_find_object (printf_address, &dlfo), 0);
+    }
+  return NULL;
+}
+
+static int
+do_test (void)
+{
+  void *main_handle = xdlopen (NULL, RTLD_NOW);
+  check_address ((void *) &do_test, main_handle);
+  check_address ((void *) &done, main_handle);
+
+  void *libc_handle = xdlopen (LIBC_SO, RTLD_NOW | RTLD_NOLOAD);
+  printf_address = xdlsym (libc_handle, "printf");
+  check_address (printf_address, libc_handle);
+  xdlclose (libc_handle);
+
+  struct dl_find_object dlfo;
+  TEST_COMPARE (_dl_find_object (NULL, &dlfo), -1);
+
+  /* Load and unload the module while other threads look at the loaded
+     objects.  */
+  pthread_t threads[4];
+  for (int i = 0; i < 4; ++i)
+    threads[i] = xpthread_create (NULL, reader, NULL);
+  for (int i = 0; i < 200; ++i)
+    {
+      void *handle = xdlopen (MODULE, RTLD_NOW);
+      void *address = xdlsym (handle, "lookup_cache_late");
+      check_address (address, handle);
+      xdlclose (handle);
+      TEST_COMPARE (_dl_find_object (address, &dlfo), -1);
+
+      handle = xdlopen (MODULE, RTLD_NOW);
+      dl_iterate_phdr (close_module, &handle);
+      TEST_VERIFY (handle == NULL);
+    }
+  done = true;
+  for (int i = 0; i < 4; ++i)
+    xpthread_join (threads[i]);
+
+  return 0;
+}
+
+#include <support/test-driver.c>
@@ -1,5 +1,5 @@
-/* Function expf vectorized with AVX-512. Wrapper to AVX2 version.
-   Copyright (C) 2014-2020 Free Software Foundation, Inc.
+/* Module for tst-lookup-cache, which refers to a symbol defined later.
+   Copyright (C) 2020 Free Software Foundation, Inc.
    This file is part of the GNU C Library.
 
    The GNU C Library is free software; you can redistribute it and/or
@@ -16,10 +16,10 @@
    License along with the GNU C Library; if not, see
    <https://www.gnu.org/licenses/>.  */
 
-#include <sysdep.h>
-#include "svml_s_wrapper_impl.h"
+extern int lookup_cache_late;
 
-	.text
-ENTRY (_ZGVeN16v_expf)
-WRAPPER_IMPL_AVX512 _ZGVdN8v_expf
-END (_ZGVeN16v_expf)
+int
+lookup_cache_get_late (void)
+{
+  return lookup_cache_late;
+}
@@ -0,0 +1,86 @@
+/* Test the cache of symbol lookups for relocations.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+/* The test is linked with -z now against one hundred modules which
+   define the same symbols, so that ld.so resolves the same symbols
+   for each of them while it relocates the objects at startup.  Each
+   module must see the definitions in the first one.  A module loaded
+   with dlopen then refers to a symbol in a module loaded with
+   RTLD_GLOBAL, and must see the right definition after that module
+   has been replaced with another one.
+
+   With LD_DEBUG=statistics the test shows how many symbol lookups
+   were answered from the cache.  */
+
+#include <dlfcn.h>
+#include <stdio.h>
+
+#include <support/check.h>
+#include <support/xdlfcn.h>
+
+#define COUNT 100
+
+struct lookup_cache_values
+{
+  int global;
+  int weak;
+  int *missing;
+};
+
+typedef void (*getter_func) (struct lookup_cache_values *);
+
+/* Load tst-lookup-cache-late<VALUE>.so and tst-lookup-cache-use.so,
+   and check the value which the latter sees.  */
+static void
+check_late (int value)
+{
+  char name[64];
+  snprintf (name, sizeof (name), "tst-lookup-cache-late%d.so", value);
+  void *late = xdlopen (name, RTLD_NOW | RTLD_GLOBAL);
+  void *use = xdlopen ("tst-lookup-cache-use.so", RTLD_NOW);
+
+  int (*get_late) (void) = xdlsym (use, "lookup_cache_get_late");
+  TEST_COMPARE (get_late (), value);
+
+  xdlclose (use);
+  xdlclose (late);
+}
+
+static int
+do_test (void)
+{
+  for (int i = 0; i < COUNT; ++i)
+    {
+      char name[64];
+      snprintf (name, sizeof (name), "lookup_cache_get_%02d", i);
+      getter_func getter = xdlsym (RTLD_DEFAULT, name);
+
+      struct lookup_cache_values values;
+      getter (&values);
+      TEST_COMPARE (values.global, 100);
+      TEST_COMPARE (values.weak, 100);
+      TEST_VERIFY (values.missing == NULL);
+    }
+
+  check_late (1);
+  check_late (2);
+
+  return 0;
+}
+
+#include <support/test-driver.c>
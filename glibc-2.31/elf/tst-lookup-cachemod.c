@@ -0,0 +1,41 @@
+/* Module for tst-lookup-cache, linked into the test one hundred times.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+/* This file is parameterized by the macros INDEX and GETTER, which are
+   set from the Makefile.  All modules define the same symbols, so
+   that the relocations of all of them are resolved to the first
+   module, and the results of the lookups are cached.  */
+
+int lookup_cache_global = INDEX;
+int lookup_cache_weak __attribute__ ((weak)) = INDEX;
+extern int lookup_cache_missing __attribute__ ((weak));
+
+struct lookup_cache_values
+{
+  int global;
+  int weak;
+  int *missing;
+};
+
+void
+GETTER (struct lookup_cache_values *values)
+{
+  values->global = lookup_cache_global;
+  values->weak = lookup_cache_weak;
+  values->missing = &lookup_cache_missing;
+}
@@ -0,0 +1,152 @@
+/* Conversions of 8-bit character sets with the tables from iconvconfig.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <dlfcn.h>
+#include <stdint.h>
+#include <wchar.h>
+#include <gconv_int.h>
+#include <iconvconfig.h>
+
+/* The steps using the tables have the entry of the character set as
+   their data.  They convert like the modules of iconvdata/8bit-gap.c
+   and iconvdata/8bit-generic.c, from which iconvconfig read the
+   tables.  */
+
+static inline const unsigned char *
+table_pages (const struct gconvtables_entry *table)
+{
+  return (const unsigned char *) table + table->page_offset;
+}
+
+
+/* Convert from the 8-bit character set to the internal (UCS4-like)
+   format.  */
+#define DEFINE_INIT		0
+#define DEFINE_FINI		0
+#define MIN_NEEDED_FROM		1
+#define MIN_NEEDED_TO		4
+#define FROM_DIRECTION		1
+#define FROM_LOOP		from_8bit_loop
+#define TO_LOOP			from_8bit_loop /* This is not used.  */
+#define FUNCTION_NAME		__gconv_transform_8bit_internal
+#define ONE_DIRECTION		1
+
+#define MIN_NEEDED_INPUT	MIN_NEEDED_FROM
+#define MIN_NEEDED_OUTPUT	MIN_NEEDED_TO
+#define LOOPFCT			FROM_LOOP
+#define INIT_PARAMS \
+  const struct gconvtables_entry *table = step->__data
+#define BODY \
+  {									      \
+    uint32_t ch = table->to_ucs4[*inptr];				      \
+									      \
+    if (__glibc_unlikely (ch == GCONVTABLES_ILLEGAL))			      \
+      {									      \
+	/* This is an illegal character.  */				      \
+	STANDARD_FROM_LOOP_ERR_HANDLER (1);				      \
+      }									      \
+									      \
+    put32 (outptr, ch);							      \
+    outptr += 4;							      \
+    ++inptr;								      \
+  }
+#define LOOP_NEED_FLAGS
+#include <iconv/loop.c>
+#include <iconv/skeleton.c>
+
+
+/* Convert from the internal (UCS4-like) format to the 8-bit character
+   set.  */
+#define DEFINE_INIT		0
+#define DEFINE_FINI		0
+#define MIN_NEEDED_FROM		4
+#define MIN_NEEDED_TO		1
+#define FROM_DIRECTION		1
+#define FROM_LOOP		to_8bit_loop
+#define TO_LOOP			to_8bit_loop /* This is not used.  */
+#define FUNCTION_NAME		__gconv_transform_internal_8bit
+#define ONE_DIRECTION		1
+
+#define MIN_NEEDED_INPUT	MIN_NEEDED_FROM
+#define MIN_NEEDED_OUTPUT	MIN_NEEDED_TO
+#define LOOPFCT			FROM_LOOP
+#define INIT_PARAMS \
+  const struct gconvtables_entry *table = step->__data;			      \
+  const unsigned char *pages = table_pages (table)
+#define BODY \
+  {									      \
+    uint32_t ch = get32 (inptr);					      \
+    unsigned char res = '\0';						      \
+									      \
+    if (__glibc_likely (ch < 0x10000))					      \
+      res = pages[table->from_page[ch >> 8] * 256 + (ch & 0xff)];	      \
+    if (__builtin_expect (res, '\1') == '\0' && ch != 0)		      \
+      {									      \
+	UNICODE_TAG_HANDLER (ch, 4);					      \
+									      \
+	/* This is an illegal character.  */				      \
+	STANDARD_TO_LOOP_ERR_HANDLER (4);				      \
+      }									      \
+									      \
+    *outptr++ = res;							      \
+    inptr += 4;								      \
+  }
+#define LOOP_NEED_FLAGS
+#include <iconv/loop.c>
+#include <iconv/skeleton.c>
+
+
+static wint_t
+btowc_8bit (struct __gconv_step *step, unsigned char c)
+{
+  const struct gconvtables_entry *table = step->__data;
+  uint32_t ch = table->to_ucs4[c];
+
+  return ch == GCONVTABLES_ILLEGAL ? WEOF : ch;
+}
+
+
+void
+__gconv_get_8bit_trans (const struct gconvtables_entry *table, int from_8bit,
+			struct __gconv_step *step)
+{
+  if (from_8bit)
+    {
+      step->__fct = __gconv_transform_8bit_internal;
+      step->__btowc_fct = btowc_8bit;
+      step->__min_needed_from = 1;
+      step->__max_needed_from = 1;
+      step->__min_needed_to = 4;
+      step->__max_needed_to = 4;
+    }
+  else
+    {
+      step->__fct = __gconv_transform_internal_8bit;
+      step->__btowc_fct = NULL;
+      step->__min_needed_from = 4;
+      step->__max_needed_from = 4;
+      step->__min_needed_to = 1;
+      step->__max_needed_to = 1;
+    }
+  step->__init_fct = NULL;
+  step->__end_fct = NULL;
+  step->__shlib_handle = NULL;
+  step->__modname = NULL;
+  step->__data = (void *) table;
+  step->__stateful = 0;
+}
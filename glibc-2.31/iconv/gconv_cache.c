@@ -20,6 +20,7 @@
 #include <dlfcn.h>
 #include <errno.h>
 #include <fcntl.h>
+#include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
@@ -36,6 +37,40 @@ static void *gconv_cache;
 static size_t cache_size;
 static int cache_malloced;
 
+/* The tables of the 8-bit character sets, if iconvconfig wrote them
+   together with the cache.  */
+static void *gconv_tables;
+static size_t tables_size;
+
+/* The record with the steps of a transformation, which the descriptors
+   cloned from the one it was looked up for share.  */
+struct cache_steps
+{
+  /* The number of descriptors using it, protected by __gconv_lock.  */
+  unsigned int refs;
+  struct __gconv_step steps[];
+};
+
+static struct __gconv_step *
+alloc_steps (size_t nsteps)
+{
+  struct cache_steps *record;
+
+  record = malloc (sizeof (struct cache_steps)
+		   + nsteps * sizeof (struct __gconv_step));
+  if (record == NULL)
+    return NULL;
+  record->refs = 1;
+  return record->steps;
+}
+
+static inline struct cache_steps *
+steps_record (struct __gconv_step *steps)
+{
+  return (struct cache_steps *) ((char *) steps
+				 - offsetof (struct cache_steps, steps));
+}
+
 
 void *
 __gconv_get_cache (void)
@@ -44,6 +79,58 @@ __gconv_get_cache (void)
 }
 
 
+#if defined _POSIX_MAPPED_FILES && !defined STATIC_GCONV
+/* Map the tables of the 8-bit character sets if they belong to the
+   cache.  Without them the modules are loaded.  */
+static void
+load_tables (void)
+{
+  int fd;
+  struct stat64 st;
+  const struct gconvtables_header *header;
+
+  fd = __open_nocancel (GCONV_MODULES_TABLES, O_RDONLY, 0);
+  if (fd == -1)
+    return;
+
+  if (__fxstat64 (_STAT_VER, fd, &st) < 0
+      || (size_t) st.st_size < sizeof (struct gconvtables_header))
+    {
+      __close_nocancel_nostatus (fd);
+      return;
+    }
+
+  tables_size = st.st_size;
+  gconv_tables = __mmap (NULL, tables_size, PROT_READ, MAP_SHARED, fd, 0);
+  __close_nocancel_nostatus (fd);
+  if (gconv_tables == MAP_FAILED)
+    {
+      gconv_tables = NULL;
+      return;
+    }
+
+  /* The strings end before the entries, so each one is terminated.
+     The entries and the pages are checked when they are used.  */
+  header = (const struct gconvtables_header *) gconv_tables;
+  if (header->magic != GCONVTABLES_MAGIC
+      || header->cache_size != cache_size
+      || header->string_offset >= header->table_offset
+      || header->table_offset > tables_size
+      || header->table_offset % __alignof__ (struct gconvtables_entry) != 0
+      || ((const char *) gconv_tables)[header->table_offset - 1] != '\0'
+      || header->ntables > ((tables_size - header->table_offset)
+			    / sizeof (struct gconvtables_entry))
+      || header->page_offset > tables_size
+      || header->npages == 0
+      || header->npages > (tables_size - header->page_offset) / 256)
+    {
+      __munmap (gconv_tables, tables_size);
+      gconv_tables = NULL;
+    }
+}
+#endif
+
+
 int
 __gconv_load_cache (void)
 {
@@ -135,6 +222,11 @@ __gconv_load_cache (void)
       return -1;
     }
 
+#if defined _POSIX_MAPPED_FILES && !defined STATIC_GCONV
+  if (!cache_malloced)
+    load_tables ();
+#endif
+
   /* That worked.  */
   return 0;
 }
@@ -178,6 +270,89 @@ find_module_idx (const char *str, size_t *idxp)
 
 
 #ifndef STATIC_GCONV
+/* Return the tables for the module FULLNAME converting between INTERNAL
+   and another character set, or NULL.  */
+static const struct gconvtables_entry *
+find_table (const char *fullname)
+{
+  const struct gconvtables_header *header;
+  const char *strtab;
+  const struct gconvtables_entry *tables;
+  size_t lo;
+  size_t hi;
+
+  if (gconv_tables == NULL)
+    return NULL;
+
+  header = (const struct gconvtables_header *) gconv_tables;
+  strtab = (const char *) gconv_tables + header->string_offset;
+  tables = (const struct gconvtables_entry *) ((char *) gconv_tables
+					       + header->table_offset);
+
+  lo = 0;
+  hi = header->ntables;
+  while (lo < hi)
+    {
+      size_t idx = (lo + hi) / 2;
+      const struct gconvtables_entry *table = &tables[idx];
+      int cmp;
+
+      if (table->module_offset
+	  >= header->table_offset - header->string_offset)
+	return NULL;
+      cmp = strcmp (fullname, strtab + table->module_offset);
+      if (cmp < 0)
+	hi = idx;
+      else if (cmp > 0)
+	lo = idx + 1;
+      else
+	{
+	  /* The pages must be those of the file.  */
+	  if (table->charset_offset
+	      >= header->table_offset - header->string_offset
+	      || ((const char *) table + table->page_offset
+		  != (const char *) gconv_tables + header->page_offset))
+	    return NULL;
+	  for (int i = 0; i < 256; ++i)
+	    if (table->from_page[i] >= header->npages)
+	      return NULL;
+	  return table;
+	}
+    }
+
+  return NULL;
+}
+
+
+/* Fill RESULT with the conversion of the tables of FULLNAME, if there
+   are any and RESULT converts between their character set and
+   INTERNAL.  */
+static int
+find_table_step (const char *fullname, struct __gconv_step *result)
+{
+  const struct gconvtables_entry *table = find_table (fullname);
+  const char *charset;
+
+  if (table == NULL)
+    return 0;
+
+  charset = ((const char *) gconv_tables
+	     + ((const struct gconvtables_header *)
+		gconv_tables)->string_offset
+	     + table->charset_offset);
+  if (strcmp (result->__to_name, "INTERNAL") == 0
+      && __strcasecmp (result->__from_name, charset) == 0)
+    __gconv_get_8bit_trans (table, 1, result);
+  else if (strcmp (result->__from_name, "INTERNAL") == 0
+	   && __strcasecmp (result->__to_name, charset) == 0)
+    __gconv_get_8bit_trans (table, 0, result);
+  else
+    return 0;
+
+  return 1;
+}
+
+
 static int
 find_module (const char *directory, const char *filename,
 	     struct __gconv_step *result)
@@ -189,6 +364,11 @@ find_module (const char *directory, const char *filename,
 
   memcpy (__mempcpy (fullname, directory, dirlen), filename, fnamelen);
 
+  /* The 8-bit character sets need no module if iconvconfig wrote their
+     tables.  */
+  if (find_table_step (fullname, result))
+    return __GCONV_OK;
+
   result->__shlib_handle = __gconv_find_shlib (fullname);
   if (result->__shlib_handle != NULL)
     {
@@ -307,9 +487,7 @@ __gconv_lookup_cache (const char *toset, const char *fromset,
 	  int idx;
 
 	  *nsteps = extra->module_cnt;
-	  *handle = result =
-	    (struct __gconv_step *) malloc (extra->module_cnt
-					    * sizeof (struct __gconv_step));
+	  *handle = result = alloc_steps (extra->module_cnt);
 	  if (result == NULL)
 	    return __GCONV_NOMEM;
 
@@ -336,7 +514,7 @@ __gconv_lookup_cache (const char *toset, const char *fromset,
 		  if (__builtin_expect (res, __GCONV_OK) != __GCONV_OK)
 		    {
 		      /* Something went wrong.  */
-		      free (result);
+		      free (steps_record (result));
 		      goto try_internal;
 		    }
 		}
@@ -363,7 +541,7 @@ __gconv_lookup_cache (const char *toset, const char *fromset,
     return __GCONV_NOCONV;
 
   /* We will use up to two modules.  Always allocate room for two.  */
-  result = (struct __gconv_step *) malloc (2 * sizeof (struct __gconv_step));
+  result = alloc_steps (2);
   if (result == NULL)
     return __GCONV_NOMEM;
 
@@ -389,7 +567,7 @@ __gconv_lookup_cache (const char *toset, const char *fromset,
 	  if (__builtin_expect (res, __GCONV_OK) != __GCONV_OK)
 	    {
 	      /* Something went wrong.  */
-	      free (result);
+	      free (steps_record (result));
 	      return res;
 	    }
 	}
@@ -425,7 +603,7 @@ __gconv_lookup_cache (const char *toset, const char *fromset,
 	      /* Something went wrong.  */
 	      if (idx != 0)
 		__gconv_release_step (&result[0]);
-	      free (result);
+	      free (steps_record (result));
 	      return res;
 	    }
 	}
@@ -447,9 +625,22 @@ void
 __gconv_release_cache (struct __gconv_step *steps, size_t nsteps)
 {
   if (gconv_cache != NULL)
-    /* The only thing we have to deallocate is the record with the
-       steps.  */
-    free (steps);
+    {
+      /* The only thing we have to deallocate is the record with the
+	 steps, once no descriptor uses it any more.  */
+      struct cache_steps *record = steps_record (steps);
+
+      if (--record->refs == 0)
+	free (record);
+    }
+}
+
+
+void
+__gconv_share_cache (struct __gconv_step *steps)
+{
+  if (gconv_cache != NULL)
+    ++steps_record (steps)->refs;
 }
 
 
@@ -461,5 +652,8 @@ libc_freeres_fn (free_mem)
 #ifdef _POSIX_MAPPED_FILES
   else if (gconv_cache != NULL)
     __munmap (gconv_cache, cache_size);
+
+  if (gconv_tables != NULL)
+    __munmap (gconv_tables, tables_size);
 #endif
 }
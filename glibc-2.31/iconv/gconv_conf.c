@@ -17,6 +17,7 @@
    License along with the GNU C Library; if not, see
    <https://www.gnu.org/licenses/>.  */
 
+#include <array_length.h>
 #include <assert.h>
 #include <ctype.h>
 #include <errno.h>
@@ -96,6 +97,41 @@ static const char builtin_aliases[] =
 #undef BUILTIN_ALIAS
 };
 
+/* The modules linked into libc, selected with the configure option
+   --with-static-gconv-modules, and the aliases of their character sets.
+   gconv_dl.c finds the modules under these names.  */
+static struct gconv_module static_modules[] =
+{
+#define GCONV_STATIC_OBJECT(Id, Name)
+#define GCONV_STATIC_MODULE(From, To, Cost, Name) \
+  {									      \
+    .from_string = From,						      \
+    .to_string = To,							      \
+    .cost_hi = Cost,							      \
+    .cost_lo = INT_MAX,							      \
+    .module_name = GCONV_PATH "/" Name MODULE_EXT			      \
+  },
+#define GCONV_STATIC_ALIAS(From, To)
+
+#include <gconv_static.h>
+
+#undef GCONV_STATIC_MODULE
+#undef GCONV_STATIC_ALIAS
+};
+
+static const char static_aliases[] =
+{
+#define GCONV_STATIC_MODULE(From, To, Cost, Name)
+#define GCONV_STATIC_ALIAS(From, To) From "\0" To "\0"
+
+#include <gconv_static.h>
+
+  ""
+#undef GCONV_STATIC_OBJECT
+#undef GCONV_STATIC_MODULE
+#undef GCONV_STATIC_ALIAS
+};
+
 #include <libio/libioP.h>
 #define __getdelim(line, len, c, fp) _IO_getdelim (line, len, c, fp)
 
@@ -599,6 +635,31 @@ __gconv_read_conf (void)
     }
   while (*cp != '\0');
 
+  /* Add the modules linked into libc and their aliases, so that they
+     are found without any configuration file.  */
+  for (cnt = 0; cnt < array_length (static_modules); ++cnt)
+    {
+      struct gconv_alias fake_alias;
+
+      fake_alias.fromname = (char *) static_modules[cnt].from_string;
+
+      if (__tfind (&fake_alias, &__gconv_alias_db, __gconv_alias_compare)
+	  != NULL)
+	continue;
+
+      insert_module (&static_modules[cnt], 0);
+    }
+
+  cp = static_aliases;
+  while (*cp != '\0')
+    {
+      const char *from = cp;
+      const char *to = __rawmemchr (from, '\0') + 1;
+      cp = __rawmemchr (to, '\0') + 1;
+
+      add_alias2 (from, to, cp, modules);
+    }
+
   /* Restore the error number.  */
   __set_errno (save_errno);
 }
@@ -807,6 +807,27 @@ __gconv_close_transform (struct __gconv_step *steps, size_t nsteps)
 }
 
 
+/* Take another reference to the entries of the modules list.  */
+void
+__gconv_share_transform (struct __gconv_step *steps, size_t nsteps)
+{
+  size_t cnt;
+
+  /* Acquire the lock.  */
+  __libc_lock_lock (__gconv_lock);
+
+  /* The steps are in use, so the modules need not be reloaded as in
+     increment_counter.  */
+  for (cnt = 0; cnt < nsteps; ++cnt)
+    ++steps[cnt].__counter;
+
+  __gconv_share_cache (steps);
+
+  /* Release the lock.  */
+  __libc_lock_unlock (__gconv_lock);
+}
+
+
 /* Free the modules mentioned.  */
 static void
 __libc_freeres_fn_section
@@ -820,7 +841,9 @@ free_modules_db (struct gconv_module *node)
     {
       struct gconv_module *act = node;
       node = node->same;
-      if (act->module_name[0] == '/')
+      /* The entries of the builtin modules and of the modules linked
+	 into libc, whose cost_lo is INT_MAX, are not allocated.  */
+      if (act->module_name[0] == '/' && act->cost_lo != INT_MAX)
 	free (act);
     }
   while (node != NULL);
@@ -839,6 +862,10 @@ libc_freeres_fn (free_mem)
   extern void _nl_finddomain_subfreeres (void) attribute_hidden;
   _nl_finddomain_subfreeres ();
 
+  /* The descriptors kept by iconv_open use steps, too.  */
+  extern void __gconv_lru_subfreeres (void) attribute_hidden;
+  __gconv_lru_subfreeres ();
+
   if (__gconv_alias_db != NULL)
     __tdestroy (__gconv_alias_db, free);
 
@@ -17,6 +17,7 @@
    License along with the GNU C Library; if not, see
    <https://www.gnu.org/licenses/>.  */
 
+#include <array_length.h>
 #include <assert.h>
 #include <dlfcn.h>
 #include <inttypes.h>
@@ -61,6 +62,88 @@ known_compare (const void *p1, const void *p2)
   return strcmp (s1->name, s2->name);
 }
 
+
+/* The modules which are linked into libc, selected with the configure
+   option --with-static-gconv-modules.  They are found under the file
+   name of the module in any directory and are never unloaded.  */
+#define GCONV_STATIC_OBJECT(Id, Name) \
+  extern int __gconv_static_##Id (struct __gconv_step *,		      \
+				  struct __gconv_step_data *,		      \
+				  const unsigned char **,		      \
+				  const unsigned char *, unsigned char **,    \
+				  size_t *, int, int) attribute_hidden;	      \
+  extern int __gconv_static_##Id##_init (struct __gconv_step *)		      \
+    attribute_hidden;							      \
+  extern void __gconv_static_##Id##_end (struct __gconv_step *)		      \
+    attribute_hidden;							      \
+  weak_extern (__gconv_static_##Id##_init)				      \
+  weak_extern (__gconv_static_##Id##_end)
+#define GCONV_STATIC_MODULE(From, To, Cost, Name)
+#define GCONV_STATIC_ALIAS(From, To)
+
+#include <gconv_static.h>
+
+#undef GCONV_STATIC_OBJECT
+
+struct static_object
+{
+  const char *name;
+  __gconv_fct fct;
+  __gconv_init_fct init_fct;
+  __gconv_end_fct end_fct;
+};
+
+static const struct static_object static_objects[] =
+{
+#define GCONV_STATIC_OBJECT(Id, Name) \
+  { Name ".so", __gconv_static_##Id, __gconv_static_##Id##_init,	      \
+    __gconv_static_##Id##_end },
+
+#include <gconv_static.h>
+
+#undef GCONV_STATIC_OBJECT
+#undef GCONV_STATIC_MODULE
+#undef GCONV_STATIC_ALIAS
+};
+
+/* The objects returned for them, filled in on first use.  */
+static struct __gconv_loaded_object
+  static_loaded[array_length (static_objects)];
+
+/* Return the object for NAME if it names a module linked into libc,
+   otherwise NULL.  */
+static struct __gconv_loaded_object *
+find_static (const char *name)
+{
+  const char *base = strrchr (name, '/');
+  base = base == NULL ? name : base + 1;
+
+  for (size_t cnt = 0; cnt < array_length (static_objects); ++cnt)
+    if (strcmp (base, static_objects[cnt].name) == 0)
+      {
+	struct __gconv_loaded_object *obj = &static_loaded[cnt];
+
+	if (obj->name == NULL)
+	  {
+	    obj->fct = static_objects[cnt].fct;
+	    obj->init_fct = static_objects[cnt].init_fct;
+	    obj->end_fct = static_objects[cnt].end_fct;
+#ifdef PTR_MANGLE
+	    PTR_MANGLE (obj->fct);
+	    PTR_MANGLE (obj->init_fct);
+	    PTR_MANGLE (obj->end_fct);
+#endif
+	    obj->counter = 1;
+	    obj->name = static_objects[cnt].name;
+	  }
+
+	return obj;
+      }
+
+  return NULL;
+}
+
+
 /* Open the gconv database if necessary.  A non-negative return value
    means success.  */
 struct __gconv_loaded_object *
@@ -69,6 +152,12 @@ __gconv_find_shlib (const char *name)
   struct __gconv_loaded_object *found;
   void *keyp;
 
+  /* The modules linked into libc are neither loaded nor counted.  They
+     are not in the tree, so __gconv_release_shlib ignores them.  */
+  found = find_static (name);
+  if (found != NULL)
+    return found;
+
   /* Search the tree of shared objects previously requested.  Data in
      the tree are `loaded_object' structures, whose first member is a
      `const char *', the lookup key.  The search returns a pointer to
@@ -145,6 +145,17 @@ extern int __gconv_open (const char *toset, const char *fromset,
 extern int __gconv_close (__gconv_t cd)
      attribute_hidden;
 
+/* Return in *HANDLE a new descriptor for the transformation of CD, in
+   the initial state, which shares the steps of CD.  */
+extern int __gconv_clone (__gconv_t cd, __gconv_t *handle)
+     attribute_hidden;
+
+/* Like __gconv_open with no flags, but clone the descriptor from the
+   ones kept for the last pairs of character sets opened.  */
+extern int __gconv_open_cached (const char *toset, const char *fromset,
+				__gconv_t *handle)
+     attribute_hidden;
+
 /* Transform at most *INBYTESLEFT bytes from buffer starting at *INBUF
    according to rules described by CD and place up to *OUTBYTESLEFT
    bytes in buffer starting at *OUTBUF.  Return number of non-identical
@@ -203,11 +214,22 @@ extern int __gconv_close_transform (struct __gconv_step *steps,
 				    size_t nsteps)
      attribute_hidden;
 
+/* Take another reference to the steps of an open descriptor, which
+   __gconv_close_transform releases.  */
+extern void __gconv_share_transform (struct __gconv_step *steps,
+				     size_t nsteps)
+     attribute_hidden;
+
 /* Free all resources allocated for the transformation record when
    using the cache.  */
 extern void __gconv_release_cache (struct __gconv_step *steps, size_t nsteps)
      attribute_hidden;
 
+/* Take another reference to the transformation record when using the
+   cache.  */
+extern void __gconv_share_cache (struct __gconv_step *steps)
+     attribute_hidden;
+
 /* Load shared object named by NAME.  If already loaded increment reference
    count.  */
 extern struct __gconv_loaded_object *__gconv_find_shlib (const char *name)
@@ -223,6 +245,14 @@ extern void __gconv_get_builtin_trans (const char *name,
 				       struct __gconv_step *step)
      attribute_hidden;
 
+struct gconvtables_entry;
+
+/* Fill STEP with the conversion between INTERNAL and the 8-bit
+   character set of TABLE, from that character set if FROM_8BIT.  */
+extern void __gconv_get_8bit_trans (const struct gconvtables_entry *table,
+				    int from_8bit, struct __gconv_step *step)
+     attribute_hidden;
+
 /* Transliteration using the locale's data.  */
 extern int __gconv_transliterate (struct __gconv_step *step,
                                   struct __gconv_step_data *step_data,
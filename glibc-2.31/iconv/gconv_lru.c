@@ -0,0 +1,177 @@
+/* Keep the descriptors for the last conversions opened.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <libc-lock.h>
+
+#include <gconv_int.h>
+
+
+/* Opening a descriptor looks up the steps, possibly loads modules and
+   calls their initialization functions, and programs converting many
+   small pieces of text often open and close descriptors for the same
+   few pairs of character sets.  So the descriptors for the last pairs
+   opened are kept, unused, in an LRU list, and iconv_open returns a
+   clone of them, which only allocates the step data.  */
+
+/* The number of descriptors kept.  */
+#define GCONV_LRU_SIZE	8
+
+struct lru_entry
+{
+  /* The names as passed to __gconv_open, which make the key.  */
+  char *toset;
+  char *fromset;
+  __gconv_t cd;
+};
+
+/* The entries, the most recently used first.  */
+static struct lru_entry lru[GCONV_LRU_SIZE];
+static size_t lru_used;
+
+__libc_lock_define_initialized (static, lru_lock)
+
+
+/* Free the entry E and the descriptor in it.  */
+static void
+lru_free (struct lru_entry *e)
+{
+  __gconv_close (e->cd);
+  free (e->toset);
+}
+
+/* Move the entry at IDX to the front of the list.  LRU_LOCK is held.  */
+static void
+lru_touch (size_t idx)
+{
+  struct lru_entry e = lru[idx];
+
+  memmove (&lru[1], &lru[0], idx * sizeof (lru[0]));
+  lru[0] = e;
+}
+
+/* Return the index of the entry for TOSET and FROMSET or -1 if there
+   is none.  LRU_LOCK is held.  */
+static int
+lru_find (const char *toset, const char *fromset)
+{
+  for (size_t idx = 0; idx < lru_used; ++idx)
+    if (strcmp (lru[idx].toset, toset) == 0
+	&& strcmp (lru[idx].fromset, fromset) == 0)
+      return idx;
+  return -1;
+}
+
+
+int
+__gconv_open_cached (const char *toset, const char *fromset,
+		     __gconv_t *handle)
+{
+  struct lru_entry new_entry;
+  struct lru_entry old_entry;
+  bool have_old = false;
+  size_t tolen;
+  size_t fromlen;
+  int idx;
+  int res;
+
+  /* A name starting with '/' has no character set part, so
+     __gconv_open uses the character set of the locale, which depends
+     on the thread and can change.  */
+  if (toset[0] == '/' || fromset[0] == '/')
+    return __gconv_open (toset, fromset, handle, 0);
+
+  __libc_lock_lock (lru_lock);
+  idx = lru_find (toset, fromset);
+  if (idx >= 0)
+    {
+      lru_touch (idx);
+      res = __gconv_clone (lru[0].cd, handle);
+      __libc_lock_unlock (lru_lock);
+      return res;
+    }
+  __libc_lock_unlock (lru_lock);
+
+  /* Open the descriptor to keep without the lock, since this can take
+     long.  It is only cloned, so it needs no output buffers.  */
+  res = __gconv_open (toset, fromset, &new_entry.cd, 0);
+  if (res != __GCONV_OK)
+    return res;
+  for (size_t cnt = 0; cnt < new_entry.cd->__nsteps - 1; ++cnt)
+    {
+      free (new_entry.cd->__data[cnt].__outbuf);
+      new_entry.cd->__data[cnt].__outbuf = NULL;
+    }
+
+  res = __gconv_clone (new_entry.cd, handle);
+  if (res != __GCONV_OK)
+    {
+      __gconv_close (new_entry.cd);
+      return res;
+    }
+
+  /* Keep the descriptor if the names can be copied.  */
+  tolen = strlen (toset) + 1;
+  fromlen = strlen (fromset) + 1;
+  new_entry.toset = malloc (tolen + fromlen);
+  if (new_entry.toset == NULL)
+    {
+      __gconv_close (new_entry.cd);
+      return __GCONV_OK;
+    }
+  new_entry.fromset = __mempcpy (new_entry.toset, toset, tolen);
+  memcpy (new_entry.fromset, fromset, fromlen);
+
+  __libc_lock_lock (lru_lock);
+  if (lru_find (toset, fromset) >= 0)
+    {
+      /* Another thread kept one in the meantime.  */
+      old_entry = new_entry;
+      have_old = true;
+    }
+  else
+    {
+      if (lru_used == GCONV_LRU_SIZE)
+	{
+	  old_entry = lru[--lru_used];
+	  have_old = true;
+	}
+      lru[lru_used++] = new_entry;
+      lru_touch (lru_used - 1);
+    }
+  __libc_lock_unlock (lru_lock);
+
+  /* Closing the descriptor can unload modules, which is better done
+     without the lock.  */
+  if (have_old)
+    lru_free (&old_entry);
+
+  return __GCONV_OK;
+}
+
+
+/* Free all resources.  gconv_db.c calls this before it frees the
+   steps which the descriptors use.  */
+void __libc_freeres_fn_section
+__gconv_lru_subfreeres (void)
+{
+  while (lru_used > 0)
+    lru_free (&lru[--lru_used]);
+}
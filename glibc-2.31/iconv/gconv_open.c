@@ -149,10 +149,14 @@ __gconv_open (const char *toset, const char *fromset, __gconv_t *handle,
 	      result->__data[cnt].__statep = &result->__data[cnt].__state;
 
 	      /* The builtin transliteration handling only
-		 supports the internal encoding.  */
+		 supports the internal encoding, and UTF-8 for the
+		 modules which convert from it directly.  */
 	      if (translit
-		  && __strcasecmp_l (steps[cnt].__from_name,
-				     "INTERNAL", _nl_C_locobj_ptr) == 0)
+		  && (__strcasecmp_l (steps[cnt].__from_name,
+				      "INTERNAL", _nl_C_locobj_ptr) == 0
+		      || __strcasecmp_l (steps[cnt].__from_name,
+					 "ISO-10646/UTF8/",
+					 _nl_C_locobj_ptr) == 0))
 		conv_flags |= __GCONV_TRANSLIT;
 
 	      /* If this is the last step we must not allocate an
@@ -209,3 +213,59 @@ __gconv_open (const char *toset, const char *fromset, __gconv_t *handle,
   *handle = result;
   return res;
 }
+
+
+int
+__gconv_clone (__gconv_t cd, __gconv_t *handle)
+{
+  struct __gconv_step *steps = cd->__steps;
+  size_t nsteps = cd->__nsteps;
+  __gconv_t result;
+  size_t cnt;
+
+  /* Allocate room for handle.  */
+  result = (__gconv_t) malloc (sizeof (struct __gconv_info)
+			       + nsteps * sizeof (struct __gconv_step_data));
+  if (result == NULL)
+    return __GCONV_NOMEM;
+
+  result->__steps = steps;
+  result->__nsteps = nsteps;
+  memset (result->__data, '\0', nsteps * sizeof (struct __gconv_step_data));
+
+  for (cnt = 0; cnt < nsteps; ++cnt)
+    {
+      /* We use the `mbstate_t' member in DATA.  */
+      result->__data[cnt].__statep = &result->__data[cnt].__state;
+
+      /* Take the flags given to __gconv_open, but not those the steps
+	 set during the conversion, such as __GCONV_SWAP.  */
+      result->__data[cnt].__flags = (cd->__data[cnt].__flags
+				     & (__GCONV_IS_LAST
+					| __GCONV_IGNORE_ERRORS
+					| __GCONV_TRANSLIT));
+
+      if (cnt < nsteps - 1)
+	{
+	  size_t size = GCONV_NCHAR_GOAL * steps[cnt].__max_needed_to;
+
+	  result->__data[cnt].__outbuf = malloc (size);
+	  if (result->__data[cnt].__outbuf == NULL)
+	    {
+	      while (cnt-- > 0)
+		free (result->__data[cnt].__outbuf);
+	      free (result);
+	      return __GCONV_NOMEM;
+	    }
+
+	  result->__data[cnt].__outbufend =
+	    result->__data[cnt].__outbuf + size;
+	}
+    }
+
+  /* The new descriptor keeps the steps and their modules.  */
+  __gconv_share_transform (steps, nsteps);
+
+  *handle = result;
+  return __GCONV_OK;
+}
@@ -28,6 +28,7 @@
 #include <wchar.h>
 #include <sys/param.h>
 #include <gconv_int.h>
+#include <gconv_bulk.h>
 
 #define BUILTIN_ALIAS(s1, s2) /* nothing */
 #define BUILTIN_TRANSFORMATION(From, To, Cost, Name, Fct, BtowcFct, \
@@ -822,6 +823,18 @@ ucs4le_internal_loop_single (struct __gconv_step *step,
 #define MIN_NEEDED_INPUT	MIN_NEEDED_FROM
 #define MIN_NEEDED_OUTPUT	MIN_NEEDED_TO
 #define LOOPFCT			FROM_LOOP
+#define BULK_BODY \
+  {									      \
+    size_t done = gconv_bulk_ascii_to_ucs4 (inptr, outptr,		      \
+					    MIN (inend - inptr,		      \
+						 (outend - outptr) / 4));     \
+    if (done != 0)							      \
+      {									      \
+	inptr += done;							      \
+	outptr += 4 * done;						      \
+	continue;							      \
+      }									      \
+  }
 #define BODY \
   {									      \
     if (__glibc_unlikely (*inptr > '\x7f'))				      \
@@ -858,6 +871,18 @@ ucs4le_internal_loop_single (struct __gconv_step *step,
 #define MIN_NEEDED_INPUT	MIN_NEEDED_FROM
 #define MIN_NEEDED_OUTPUT	MIN_NEEDED_TO
 #define LOOPFCT			FROM_LOOP
+#define BULK_BODY \
+  {									      \
+    size_t done = gconv_bulk_ucs4_to_ascii (inptr, outptr,		      \
+					    MIN ((inend - inptr) / 4,	      \
+						 outend - outptr));	      \
+    if (done != 0)							      \
+      {									      \
+	inptr += 4 * done;						      \
+	outptr += done;							      \
+	continue;							      \
+      }									      \
+  }
 #define BODY \
   {									      \
     if (__glibc_unlikely (*((const uint32_t *) inptr) > 0x7f))		      \
@@ -893,6 +918,21 @@ ucs4le_internal_loop_single (struct __gconv_step *step,
 #define MIN_NEEDED_OUTPUT	MIN_NEEDED_TO
 #define MAX_NEEDED_OUTPUT	MAX_NEEDED_TO
 #define LOOPFCT			FROM_LOOP
+#define BULK_BODY \
+  {									      \
+    if (*((const uint32_t *) inptr) < 0x80)				      \
+      {									      \
+	size_t done = gconv_bulk_ucs4_to_ascii (inptr, outptr,		      \
+						MIN ((inend - inptr) / 4,     \
+						     outend - outptr));	      \
+	if (done != 0)							      \
+	  {								      \
+	    inptr += 4 * done;						      \
+	    outptr += done;						      \
+	    continue;							      \
+	  }								      \
+      }									      \
+  }
 #define BODY \
   {									      \
     uint32_t wc = *((const uint32_t *) inptr);				      \
@@ -941,6 +981,82 @@ ucs4le_internal_loop_single (struct __gconv_step *step,
 
 
 /* Convert from UTF-8 to the internal (UCS4-like) format.  */
+
+/* Convert the well-formed sequences of at most four bytes at the start
+   of the input, as far as there is room in the output, and return
+   whether anything was converted.  The runs of one byte sequences are
+   converted in bulk.  The sequences are checked exactly as in BODY
+   below, which handles everything else.  */
+static inline int
+__attribute ((always_inline))
+utf8_internal_bulk (const unsigned char **inptrp, const unsigned char *inend,
+		    unsigned char **outptrp, const unsigned char *outend)
+{
+  const unsigned char *inptr = *inptrp;
+  unsigned char *outptr = *outptrp;
+
+  /* Leave the last few bytes to BODY.  */
+  if (inend - inptr < 16)
+    return 0;
+
+  while (inptr < inend && outend - outptr >= 4)
+    {
+      uint32_t ch = inptr[0];
+      size_t cnt;
+
+      if (ch < 0x80)
+	{
+	  size_t done = gconv_bulk_ascii_to_ucs4 (inptr, outptr,
+						  MIN (inend - inptr,
+						       (outend - outptr) / 4));
+	  if (done != 0)
+	    {
+	      inptr += done;
+	      outptr += 4 * done;
+	      continue;
+	    }
+	  cnt = 1;
+	}
+      else if (ch >= 0xc2 && ch < 0xe0 && inend - inptr >= 2
+	       && (inptr[1] & 0xc0) == 0x80)
+	{
+	  ch = ((ch & 0x1f) << 6) | (inptr[1] & 0x3f);
+	  cnt = 2;
+	}
+      else if ((ch & 0xf0) == 0xe0 && inend - inptr >= 3
+	       && (inptr[1] & 0xc0) == 0x80 && (inptr[2] & 0xc0) == 0x80)
+	{
+	  ch = (((ch & 0x0f) << 12) | ((inptr[1] & 0x3f) << 6)
+		| (inptr[2] & 0x3f));
+	  if (ch < 0x800 || (ch >= 0xd800 && ch <= 0xdfff))
+	    break;
+	  cnt = 3;
+	}
+      else if ((ch & 0xf8) == 0xf0 && inend - inptr >= 4
+	       && (inptr[1] & 0xc0) == 0x80 && (inptr[2] & 0xc0) == 0x80
+	       && (inptr[3] & 0xc0) == 0x80)
+	{
+	  ch = (((ch & 0x07) << 18) | ((inptr[1] & 0x3f) << 12)
+		| ((inptr[2] & 0x3f) << 6) | (inptr[3] & 0x3f));
+	  if (ch < 0x10000)
+	    break;
+	  cnt = 4;
+	}
+      else
+	break;
+
+      *((uint32_t *) outptr) = ch;
+      outptr += sizeof (uint32_t);
+      inptr += cnt;
+    }
+
+  if (inptr == *inptrp)
+    return 0;
+  *inptrp = inptr;
+  *outptrp = outptr;
+  return 1;
+}
+
 #define DEFINE_INIT		0
 #define DEFINE_FINI		0
 #define MIN_NEEDED_FROM		1
@@ -956,6 +1072,11 @@ ucs4le_internal_loop_single (struct __gconv_step *step,
 #define MAX_NEEDED_INPUT	MAX_NEEDED_FROM
 #define MIN_NEEDED_OUTPUT	MIN_NEEDED_TO
 #define LOOPFCT			FROM_LOOP
+#define BULK_BODY \
+  {									      \
+    if (utf8_internal_bulk (&inptr, inend, &outptr, outend))		      \
+      continue;								      \
+  }
 #define BODY \
   {									      \
     /* Next input byte.  */						      \
@@ -1175,6 +1296,18 @@ ucs4le_internal_loop_single (struct __gconv_step *step,
 #define MIN_NEEDED_INPUT	MIN_NEEDED_FROM
 #define MIN_NEEDED_OUTPUT	MIN_NEEDED_TO
 #define LOOPFCT			FROM_LOOP
+#define BULK_BODY \
+  {									      \
+    size_t done = gconv_bulk_ucs2_to_ucs4 (inptr, outptr,		      \
+					   MIN ((inend - inptr) / 2,	      \
+						(outend - outptr) / 4), 0);   \
+    if (done != 0)							      \
+      {									      \
+	inptr += 2 * done;						      \
+	outptr += 4 * done;						      \
+	continue;							      \
+      }									      \
+  }
 #define BODY \
   {									      \
     uint16_t u1 = get16 (inptr);					      \
@@ -1209,6 +1342,18 @@ ucs4le_internal_loop_single (struct __gconv_step *step,
 #define MIN_NEEDED_INPUT	MIN_NEEDED_FROM
 #define MIN_NEEDED_OUTPUT	MIN_NEEDED_TO
 #define LOOPFCT			FROM_LOOP
+#define BULK_BODY \
+  {									      \
+    size_t done = gconv_bulk_ucs4_to_ucs2 (inptr, outptr,		      \
+					   MIN ((inend - inptr) / 4,	      \
+						(outend - outptr) / 2), 0);   \
+    if (done != 0)							      \
+      {									      \
+	inptr += 4 * done;						      \
+	outptr += 2 * done;						      \
+	continue;							      \
+      }									      \
+  }
 #define BODY \
   {									      \
     uint32_t val = *((const uint32_t *) inptr);				      \
@@ -1259,6 +1404,18 @@ ucs4le_internal_loop_single (struct __gconv_step *step,
 #define MIN_NEEDED_INPUT	MIN_NEEDED_FROM
 #define MIN_NEEDED_OUTPUT	MIN_NEEDED_TO
 #define LOOPFCT			FROM_LOOP
+#define BULK_BODY \
+  {									      \
+    size_t done = gconv_bulk_ucs2_to_ucs4 (inptr, outptr,		      \
+					   MIN ((inend - inptr) / 2,	      \
+						(outend - outptr) / 4), 1);   \
+    if (done != 0)							      \
+      {									      \
+	inptr += 2 * done;						      \
+	outptr += 4 * done;						      \
+	continue;							      \
+      }									      \
+  }
 #define BODY \
   {									      \
     uint16_t u1 = bswap_16 (get16 (inptr));				      \
@@ -1300,6 +1457,18 @@ ucs4le_internal_loop_single (struct __gconv_step *step,
 #define MIN_NEEDED_INPUT	MIN_NEEDED_FROM
 #define MIN_NEEDED_OUTPUT	MIN_NEEDED_TO
 #define LOOPFCT			FROM_LOOP
+#define BULK_BODY \
+  {									      \
+    size_t done = gconv_bulk_ucs4_to_ucs2 (inptr, outptr,		      \
+					   MIN ((inend - inptr) / 4,	      \
+						(outend - outptr) / 2), 1);   \
+    if (done != 0)							      \
+      {									      \
+	inptr += 4 * done;						      \
+	outptr += 2 * done;						      \
+	continue;							      \
+      }									      \
+  }
 #define BODY \
   {									      \
     uint32_t val = *((const uint32_t *) inptr);				      \
@@ -0,0 +1,73 @@
+# Generate gconv_static.h from gconv-modules.
+# Copyright (C) 2020 Free Software Foundation, Inc.
+# This file is part of the GNU C Library.
+
+# The GNU C Library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+
+# The GNU C Library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+# Lesser General Public License for more details.
+
+# You should have received a copy of the GNU Lesser General Public
+# License along with the GNU C Library; if not, see
+# <https://www.gnu.org/licenses/>.
+
+# The variable `modules' names the modules which are linked into libc.
+# For each of them the output has a line
+#   GCONV_STATIC_OBJECT (Id, "Name")
+# where Id is Name with all characters which cannot appear in a C
+# identifier replaced by `_', for each of their conversions a line
+#   GCONV_STATIC_MODULE ("From", "To", Cost, "Name")
+# and for each alias of a character set they convert from or to a line
+#   GCONV_STATIC_ALIAS ("Alias", "Charset")
+
+BEGIN {
+  nmodules = split (modules, names);
+  for (i = 1; i <= nmodules; ++i)
+    selected[names[i]] = 1;
+  nconv = 0;
+  naliases = 0;
+}
+
+$1 == "alias" && NF >= 3 {
+  alias_from[naliases] = $2;
+  alias_to[naliases] = $3;
+  ++naliases;
+  next;
+}
+
+$1 == "module" && NF >= 4 && ($4 in selected) {
+  conv[nconv] = sprintf ("GCONV_STATIC_MODULE (\"%s\", \"%s\", %d, \"%s\")",
+			 $2, $3, NF >= 5 ? $5 : 1, $4);
+  ++nconv;
+  charset[$2] = 1;
+  charset[$3] = 1;
+  found[$4] = 1;
+  next;
+}
+
+END {
+  print "/* This file is generated by gen-gconv-static.awk.  */";
+  for (i = 1; i <= nmodules; ++i)
+    {
+      if (! (names[i] in found))
+	{
+	  printf "%s: no conversions for module %s\n", FILENAME, names[i] \
+	    > "/dev/stderr";
+	  exit 1;
+	}
+      id = names[i];
+      gsub (/[^A-Za-z0-9]/, "_", id);
+      printf "GCONV_STATIC_OBJECT (%s, \"%s\")\n", id, names[i];
+    }
+  for (i = 0; i < nconv; ++i)
+    print conv[i];
+  for (i = 0; i < naliases; ++i)
+    if (alias_to[i] in charset)
+      printf "GCONV_STATIC_ALIAS (\"%s\", \"%s\")\n", alias_from[i], \
+	alias_to[i];
+}
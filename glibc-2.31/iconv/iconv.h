@@ -50,6 +50,16 @@ extern size_t iconv (iconv_t __cd, char **__restrict __inbuf,
    marked with __THROW.  */
 extern int iconv_close (iconv_t __cd);
 
+#ifdef __USE_GNU
+/* Allocate a descriptor for the same conversion as CD, in the initial
+   shift state.  It shares the conversion modules with CD, so this is
+   much cheaper than iconv_open, and it stays valid after CD is closed.
+   CD must not be used by another thread during the call, so the usual
+   way is to keep one descriptor as a template and clone it for each
+   thread or each text.  */
+extern iconv_t iconv_clone (iconv_t __cd) __THROW;
+#endif
+
 __END_DECLS
 
 #endif /* iconv.h */
@@ -0,0 +1,43 @@
+/* Copy a conversion descriptor.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <errno.h>
+#include <iconv.h>
+
+#include <gconv_int.h>
+
+
+iconv_t
+iconv_clone (iconv_t cd)
+{
+  __gconv_t result;
+
+  if (__glibc_unlikely (cd == (iconv_t *) -1L))
+    {
+      __set_errno (EBADF);
+      return (iconv_t) -1;
+    }
+
+  if (__gconv_clone ((__gconv_t) cd, &result) != __GCONV_OK)
+    {
+      __set_errno (ENOMEM);
+      return (iconv_t) -1;
+    }
+
+  return (iconv_t) result;
+}
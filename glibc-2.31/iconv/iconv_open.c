@@ -68,7 +68,7 @@ iconv_open (const char *tocode, const char *fromcode)
 	      ? upstr (fromcode_conv, fromcode) : fromcode_conv);
 
   __gconv_t cd;
-  int res = __gconv_open (tocode, fromcode, &cd, 0);
+  int res = __gconv_open_cached (tocode, fromcode, &cd);
 
   if (! fromcode_usealloca)
     free (fromcode_conv);
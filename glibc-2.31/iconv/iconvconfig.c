@@ -18,6 +18,7 @@
 
 #include <argp.h>
 #include <assert.h>
+#include <dlfcn.h>
 #include <error.h>
 #include <errno.h>
 #include <fcntl.h>
@@ -121,6 +122,7 @@ static char *more_help (int key, const char *text, void *input);
 /* Definitions of arguments for argp functions.  */
 #define OPT_PREFIX 300
 #define OPT_NOSTDLIB 301
+#define OPT_TABLES 302
 static const struct argp_option options[] =
 {
   { "prefix", OPT_PREFIX, N_("PATH"), 0,
@@ -130,6 +132,9 @@ Put output in FILE instead of installed location\
  (--prefix does not apply to FILE)") },
   { "nostdlib", OPT_NOSTDLIB, NULL, 0,
     N_("Do not search standard directories, only those on the command line") },
+  { "tables", OPT_TABLES, N_("FILE"), OPTION_ARG_OPTIONAL, N_("\
+Also write the tables of the 8-bit character sets, to FILE if given\
+ (--prefix does not apply to FILE)") },
   { NULL, 0, NULL, 0, NULL }
 };
 
@@ -161,6 +166,10 @@ static void generate_name_info (void);
 /* Write the output file.  */
 static int write_output (void);
 
+/* Write or remove the file with the tables of the 8-bit character
+   sets which goes with a cache of CACHE_SIZE bytes.  */
+static int write_tables (size_t cache_size);
+
 
 /* Prefix to be used for all file accesses.  */
 static const char *prefix = "";
@@ -175,6 +184,11 @@ static size_t output_file_len;
 /* If true, omit the GCONV_PATH directories and require some arguments.  */
 static bool nostdlib;
 
+/* If true, also write the tables of the 8-bit character sets, to
+   TABLES_FILE if it is not NULL.  */
+static bool tables;
+static const char *tables_file;
+
 /* Search tree of the modules we know.  */
 static void *modules;
 
@@ -297,6 +311,8 @@ main (int argc, char *argv[])
 
   if (nostdlib && remaining == argc)
     error (2, 0, _("Directory arguments required when using --nostdlib"));
+  if (tables && tables_file == NULL && output_file != NULL)
+    error (2, 0, _("--tables requires a FILE argument when using --output"));
 
   /* Initialize the string table.  */
   strtab = strtabinit ();
@@ -361,6 +377,10 @@ parse_opt (int key, char *arg, struct argp_state *state)
     case OPT_NOSTDLIB:
       nostdlib = true;
       break;
+    case OPT_TABLES:
+      tables = true;
+      tables_file = arg;
+      break;
     default:
       return ARGP_ERR_UNKNOWN;
     }
@@ -1228,6 +1248,8 @@ write_output (void)
   if ((size_t) TEMP_FAILURE_RETRY (writev (fd, iov, idx)) != total
       /* The file was created with mode 0600.  Make it world-readable.  */
       || fchmod (fd, 0644) != 0
+      /* The tables of the old cache must not be used with this one.  */
+      || write_tables (total) != 0
       /* Rename the file, possibly replacing an old one.  */
       || rename (tmpfname, output_file ?: finalname) != 0)
     {
@@ -1242,3 +1264,301 @@ write_output (void)
 
   return 0;
 }
+
+
+/* The tables of an 8-bit character set.  */
+struct table
+{
+  char *module;
+  char *charset;
+  struct gconvtables_entry entry;
+};
+
+static struct table *table_list;
+static size_t ntable_list;
+static size_t ntable_list_max;
+
+/* The pages of bytes which the tables share.  Page zero has none.  */
+static unsigned char (*page_list)[256];
+static size_t npage_list;
+static size_t npage_list_max;
+
+/* Return the index of a page with the bytes of PAGE, or -1 if there
+   are too many pages.  */
+static int
+add_page (const unsigned char *page)
+{
+  size_t i;
+
+  for (i = 0; i < npage_list; ++i)
+    if (memcmp (page_list[i], page, 256) == 0)
+      return i;
+
+  if (npage_list > UINT16_MAX)
+    return -1;
+
+  if (npage_list == npage_list_max)
+    {
+      npage_list_max += 64;
+      page_list = xrealloc (page_list, npage_list_max * 256);
+    }
+  memcpy (page_list[npage_list], page, 256);
+  return npage_list++;
+}
+
+
+/* Fill ENTRY with the tables of the module described by DESC.  Return
+   false if the file cannot represent them, which is the case if a
+   character outside the BMP or a character other than NUL has a byte,
+   or if NUL has none.  */
+static bool
+fill_entry (const struct gconv_8bit *desc, struct gconvtables_entry *entry)
+{
+  uint32_t limit = desc->from_limit;
+  unsigned char page[256];
+  uint32_t ch;
+
+  for (ch = 0; ch < 256; ++ch)
+    entry->to_ucs4[ch] = desc->to_ucs4 (ch);
+
+  if (desc->from_ucs4 (0) < 0)
+    return false;
+  for (ch = 1; ch < limit; ++ch)
+    {
+      int b = desc->from_ucs4 (ch);
+      if (b == 0 || (b > 0 && ch > 0xffff))
+	return false;
+    }
+
+  for (ch = 0; ch < 0x10000; ch += 256)
+    {
+      bool any = false;
+      int idx = 0;
+
+      for (int i = 0; i < 256; ++i)
+	{
+	  int b = ch + i < limit ? desc->from_ucs4 (ch + i) : -1;
+	  page[i] = b < 0 ? 0 : b;
+	  any |= page[i] != 0;
+	}
+
+      if (any && (idx = add_page (page)) < 0)
+	return false;
+      entry->from_page[ch >> 8] = idx;
+    }
+
+  return true;
+}
+
+
+/* Add the tables of the module of MO if it has any.  Modules which
+   cannot be loaded, as those for another architecture, are left to be
+   loaded at run time.  */
+static void
+add_table (const struct module *mo)
+{
+  size_t dirlen = strlen (mo->directory);
+  size_t namelen = strlen (mo->filename) + 1;
+  char *module = xmalloc (dirlen + namelen);
+  char path[prefix_len + dirlen + namelen];
+  char *cp;
+  void *handle;
+  const struct gconv_8bit *desc;
+  size_t i;
+
+  memcpy (mempcpy (module, mo->directory, dirlen), mo->filename, namelen);
+
+  /* Each module is listed for both of its directions.  */
+  for (i = 0; i < ntable_list; ++i)
+    if (strcmp (table_list[i].module, module) == 0)
+      {
+	free (module);
+	return;
+      }
+
+  cp = path;
+  if (module[0] == '/')
+    cp = mempcpy (cp, prefix, prefix_len);
+  strcpy (cp, module);
+
+  handle = dlopen (path, RTLD_LAZY | RTLD_LOCAL);
+  if (handle == NULL)
+    {
+      free (module);
+      return;
+    }
+
+  desc = dlsym (handle, "gconv_8bit");
+  if (desc != NULL)
+    {
+      if (ntable_list == ntable_list_max)
+	{
+	  ntable_list_max += 50;
+	  table_list = xrealloc (table_list,
+				 ntable_list_max * sizeof (struct table));
+	}
+
+      if (fill_entry (desc, &table_list[ntable_list].entry))
+	{
+	  table_list[ntable_list].module = module;
+	  table_list[ntable_list].charset = xstrdup (desc->charset);
+	  ++ntable_list;
+	  module = NULL;
+	}
+    }
+
+  dlclose (handle);
+  free (module);
+}
+
+
+static int
+table_compare (const void *p1, const void *p2)
+{
+  const struct table *t1 = (const struct table *) p1;
+  const struct table *t2 = (const struct table *) p2;
+
+  return strcmp (t1->module, t2->module);
+}
+
+
+/* Format of the tables file.
+
+   Offset   Length       Description
+   0000     4            Magic header bytes
+   0004     4            Size of the cache written with the file
+   0008     4            Offset of string table (stoff)
+   000C     4            Offset of table entries (toff)
+   0010     4            Number of table entries (tcnt)
+   0014     4            Offset of the pages of bytes (poff)
+   0018     4            Number of pages (pcnt)
+
+   stoff    ???          String table, padded to a multiple of 4 bytes
+
+   toff     1548*tcnt    Array of entries sorted by the module names
+			    module name offset
+			    character set name offset
+			    offset of the pages from the entry
+			    256 characters of the bytes
+			    256 page numbers of the blocks of the BMP
+
+   poff     256*pcnt     Pages of bytes of the characters of a block
+*/
+
+static int
+write_tables (size_t cache_size)
+{
+  char finalname[prefix_len + sizeof GCONV_MODULES_TABLES];
+  const char *name = tables_file;
+  struct gconvtables_header header;
+  struct gconvtables_entry *entries;
+  char *string_table;
+  size_t string_table_size;
+  size_t string_table_max;
+  unsigned char zero_page[256];
+  struct iovec iov[4];
+  size_t total;
+  size_t n;
+  int fd;
+
+  if (name == NULL)
+    {
+      /* The tables in the installed location go with the installed
+	 cache, which is only replaced without --output.  */
+      if (output_file != NULL)
+	return 0;
+      assert (GCONV_MODULES_TABLES[0] == '/');
+      strcpy (mempcpy (finalname, prefix, prefix_len), GCONV_MODULES_TABLES);
+      name = finalname;
+    }
+
+  if (!tables)
+    return unlink (name) != 0 && errno != ENOENT;
+
+  /* Read the tables of the modules converting between a character set
+     and INTERNAL.  */
+  memset (zero_page, '\0', sizeof (zero_page));
+  add_page (zero_page);
+  for (n = 0; n < nmodule_list; ++n)
+    for (struct module *runp = module_list[n]; runp != NULL;
+	 runp = runp->next)
+      if (runp->directory[0] != '\0'
+	  && (strcmp (runp->fromname, "INTERNAL") == 0
+	      || strcmp (runp->toname, "INTERNAL") == 0))
+	add_table (runp);
+
+  qsort (table_list, ntable_list, sizeof (struct table), table_compare);
+
+  /* Create the string table.  It starts with an empty string and ends
+     with padding, so it is never empty and the last string is
+     terminated.  */
+  string_table_max = 1;
+  for (n = 0; n < ntable_list; ++n)
+    string_table_max += (strlen (table_list[n].module)
+			 + strlen (table_list[n].charset) + 2);
+  string_table_max = (string_table_max + 3) & ~(size_t) 3;
+  string_table = xcalloc (string_table_max, 1);
+  string_table_size = 1;
+
+  memset (&header, '\0', sizeof (header));
+  header.magic = GCONVTABLES_MAGIC;
+  header.cache_size = cache_size;
+  header.string_offset = sizeof (header);
+  header.table_offset = header.string_offset + string_table_max;
+  header.ntables = ntable_list;
+  header.page_offset = (header.table_offset
+			+ ntable_list * sizeof (struct gconvtables_entry));
+  header.npages = npage_list;
+
+  entries = xmalloc (ntable_list * sizeof (struct gconvtables_entry) + 1);
+  for (n = 0; n < ntable_list; ++n)
+    {
+      size_t len;
+
+      entries[n] = table_list[n].entry;
+
+      entries[n].module_offset = string_table_size;
+      len = strlen (table_list[n].module) + 1;
+      memcpy (string_table + string_table_size, table_list[n].module, len);
+      string_table_size += len;
+
+      entries[n].charset_offset = string_table_size;
+      len = strlen (table_list[n].charset) + 1;
+      memcpy (string_table + string_table_size, table_list[n].charset, len);
+      string_table_size += len;
+
+      entries[n].page_offset = (header.page_offset - header.table_offset
+				- n * sizeof (struct gconvtables_entry));
+    }
+
+  iov[0].iov_base = &header;
+  iov[0].iov_len = sizeof (header);
+  iov[1].iov_base = string_table;
+  iov[1].iov_len = string_table_max;
+  iov[2].iov_base = entries;
+  iov[2].iov_len = ntable_list * sizeof (struct gconvtables_entry);
+  iov[3].iov_base = page_list;
+  iov[3].iov_len = npage_list * 256;
+  total = header.page_offset + iov[3].iov_len;
+
+  char tmpfname[strlen (name) + sizeof ".XXXXXX"];
+  strcpy (stpcpy (tmpfname, name), ".XXXXXX");
+  fd = mkstemp (tmpfname);
+  if (fd == -1)
+    return 1;
+
+  if ((size_t) TEMP_FAILURE_RETRY (writev (fd, iov, 4)) != total
+      || fchmod (fd, 0644) != 0
+      || rename (tmpfname, name) != 0)
+    {
+      int save_errno = errno;
+      close (fd);
+      unlink (tmpfname);
+      errno = save_errno;
+      return 1;
+    }
+
+  close (fd);
+
+  return 0;
+}
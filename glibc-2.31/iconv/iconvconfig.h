@@ -64,3 +64,60 @@ struct extra_entry
 
 
 #define GCONV_MODULES_CACHE	GCONV_DIR "/gconv-modules.cache"
+
+
+/* With --tables iconvconfig also writes the tables of the 8-bit
+   character sets to a second file, so that the conversions between
+   them and INTERNAL need not load their modules.  It has a header,
+   the strings, the entries sorted by the module file names, and the
+   pages of bytes which the entries share.  */
+struct gconvtables_header
+{
+  uint32_t magic;
+  /* The size of the cache written together with the tables, which are
+     not used with another one.  */
+  uint32_t cache_size;
+  uint32_t string_offset;
+  uint32_t table_offset;
+  uint32_t ntables;
+  uint32_t page_offset;
+  uint32_t npages;
+};
+
+struct gconvtables_entry
+{
+  /* The file name of the module with its directory and the name of the
+     character set, in the string table.  */
+  uint32_t module_offset;
+  uint32_t charset_offset;
+  /* The offset of the pages from the start of this entry.  */
+  uint32_t page_offset;
+  /* The character of each byte, or GCONVTABLES_ILLEGAL.  */
+  uint32_t to_ucs4[256];
+  /* The page with the bytes of each block of 256 characters in the BMP.
+     Page zero has none.  A zero byte for a character other than NUL
+     means that it has no byte.  */
+  uint16_t from_page[256];
+};
+
+
+#define GCONVTABLES_MAGIC	0x20200915
+
+#define GCONVTABLES_ILLEGAL	0xffffffff
+
+
+#define GCONV_MODULES_TABLES	GCONV_DIR "/gconv-modules.tables"
+
+
+/* What the modules built from the tables of 8-bit character sets
+   export as `gconv_8bit', for iconvconfig to read their tables.  */
+struct gconv_8bit
+{
+  const char *charset;
+  /* Return the character of byte CH, or GCONVTABLES_ILLEGAL.  */
+  uint32_t (*to_ucs4) (unsigned char ch);
+  /* Return the byte of character CH, or -1.  */
+  int (*from_ucs4) (uint32_t ch);
+  /* The characters from this one on have no byte.  */
+  uint32_t from_limit;
+};
@@ -38,6 +38,12 @@
      BODY		this is supposed to expand to the body of the loop.
 			The user must provide this.
 
+     BULK_BODY		optional code run before BODY in the main loop,
+			which may convert a run of characters at once
+			and `continue'.  Only the space for one character
+			has been checked.  It is not used to convert the
+			bytes of an incomplete character.
+
      EXTRA_LOOP_DECLS	extra arguments passed from conversion loop call.
 
      INIT_PARAMS	code to define and initialize variables from params.
@@ -333,6 +339,9 @@ FCTNAME (LOOPFCT) (struct __gconv_step *step,
 	 RESULT set to GCONV_INCOMPLETE_INPUT (if the size of the
 	 input characters vary in size), GCONV_ILLEGAL_INPUT, or
 	 GCONV_FULL_OUTPUT (if the output characters vary in size).  */
+#ifdef BULK_BODY
+      BULK_BODY
+#endif
       BODY
     }
 
@@ -516,6 +525,7 @@ gconv_btowc (struct __gconv_step *step, unsigned char c)
 #undef MAX_NEEDED_OUTPUT
 #undef LOOPFCT
 #undef BODY
+#undef BULK_BODY
 #undef LOOPFCT
 #undef EXTRA_LOOP_DECLS
 #undef INIT_PARAMS
@@ -0,0 +1,134 @@
+/* Test the gconv modules linked into libc.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+/* GCONV_PATH names a directory without a gconv-modules file.  Each
+   character set converted by one of the modules selected with
+   --with-static-gconv-modules must still be usable, and none of the
+   shared objects of those modules may be loaded.  */
+
+#include <errno.h>
+#include <iconv.h>
+#include <link.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <support/check.h>
+
+/* The conversions of the modules, one side of which is INTERNAL.  */
+static const struct
+{
+  const char *from;
+  const char *to;
+} conversions[] =
+{
+#define GCONV_STATIC_OBJECT(Id, Name)
+#define GCONV_STATIC_MODULE(From, To, Cost, Name) { From, To },
+#define GCONV_STATIC_ALIAS(From, To)
+#include <gconv_static.h>
+  { NULL, NULL }
+};
+
+static const char *const names[] =
+{
+#undef GCONV_STATIC_OBJECT
+#undef GCONV_STATIC_MODULE
+#define GCONV_STATIC_OBJECT(Id, Name) Name ".so",
+#define GCONV_STATIC_MODULE(From, To, Cost, Name)
+#include <gconv_static.h>
+  NULL
+};
+
+static int
+check_object (struct dl_phdr_info *info, size_t size, void *data)
+{
+  const char *base = strrchr (info->dlpi_name, '/');
+  base = base == NULL ? info->dlpi_name : base + 1;
+
+  for (size_t i = 0; names[i] != NULL; ++i)
+    if (strcmp (base, names[i]) == 0)
+      {
+	support_record_failure ();
+	printf ("error: %s was loaded\n", info->dlpi_name);
+      }
+  return 0;
+}
+
+/* Convert the LEN bytes of TEXT with CD into BUF of SIZE bytes and
+   return the length of the result, or -1 if the character set lacks
+   one of the characters.  */
+static size_t
+convert (iconv_t cd, const char *text, size_t len, char *buf, size_t size)
+{
+  char *inptr = (char *) text;
+  char *outptr = buf;
+  size_t outleft = size;
+
+  errno = 0;
+  if (iconv (cd, &inptr, &len, &outptr, &outleft) == (size_t) -1)
+    {
+      TEST_COMPARE (errno, EILSEQ);
+      return -1;
+    }
+  TEST_VERIFY_EXIT (iconv (cd, NULL, NULL, &outptr, &outleft)
+		    != (size_t) -1);
+  TEST_COMPARE (len, 0);
+  return outptr - buf;
+}
+
+static int
+do_test (void)
+{
+  /* Not all of the character sets have letters.  */
+  static const char text[] = "0123 456";
+
+  if (names[0] == NULL)
+    FAIL_UNSUPPORTED ("no gconv modules are linked into libc");
+
+  for (size_t i = 0; conversions[i].from != NULL; ++i)
+    {
+      const char *charset = conversions[i].from;
+      if (strcmp (charset, "INTERNAL") == 0)
+	charset = conversions[i].to;
+
+      iconv_t to = iconv_open (charset, "UTF-8");
+      if (to == (iconv_t) -1)
+	FAIL_EXIT1 ("iconv_open (\"%s\", \"UTF-8\"): %m", charset);
+      iconv_t from = iconv_open ("UTF-8", charset);
+      if (from == (iconv_t) -1)
+	FAIL_EXIT1 ("iconv_open (\"UTF-8\", \"%s\"): %m", charset);
+
+      char encoded[64];
+      char decoded[64];
+      size_t n = convert (to, text, strlen (text), encoded,
+			  sizeof (encoded));
+      if (n != (size_t) -1)
+	{
+	  n = convert (from, encoded, n, decoded, sizeof (decoded));
+	  TEST_COMPARE_BLOB (decoded, n, text, strlen (text));
+	}
+
+      TEST_COMPARE (iconv_close (to), 0);
+      TEST_COMPARE (iconv_close (from), 0);
+    }
+
+  dl_iterate_phdr (check_object, NULL);
+
+  return 0;
+}
+
+#include <support/test-driver.c>
@@ -0,0 +1,321 @@
+/* Test the conversion of runs of characters by the builtin converters.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <array_length.h>
+#include <errno.h>
+#include <iconv.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <support/check.h>
+
+/* The converters between UTF-8, ASCII, UCS-2 and WCHAR_T convert runs
+   of ASCII and BMP characters in blocks.  Check that the characters
+   around the blocks, errors within them and a full output buffer are
+   handled as by the conversion of single characters.  */
+
+#define MAX_CHARS 200
+
+/* Characters of each length in UTF-8.  */
+static const uint32_t samples[] = { 0xe9, 0x439, 0x20ac, 0x4e2d, 0xfffd,
+				    0x1f600, 0x10ffff };
+
+static size_t
+utf8_encode (const uint32_t *wc, size_t n, char *out)
+{
+  unsigned char *p = (unsigned char *) out;
+
+  for (size_t i = 0; i < n; i++)
+    if (wc[i] < 0x80)
+      *p++ = wc[i];
+    else if (wc[i] < 0x800)
+      {
+	*p++ = 0xc0 | (wc[i] >> 6);
+	*p++ = 0x80 | (wc[i] & 0x3f);
+      }
+    else if (wc[i] < 0x10000)
+      {
+	*p++ = 0xe0 | (wc[i] >> 12);
+	*p++ = 0x80 | ((wc[i] >> 6) & 0x3f);
+	*p++ = 0x80 | (wc[i] & 0x3f);
+      }
+    else
+      {
+	*p++ = 0xf0 | (wc[i] >> 18);
+	*p++ = 0x80 | ((wc[i] >> 12) & 0x3f);
+	*p++ = 0x80 | ((wc[i] >> 6) & 0x3f);
+	*p++ = 0x80 | (wc[i] & 0x3f);
+      }
+  return (char *) p - out;
+}
+
+/* Fill WC with N ASCII characters, with the character C at POS if C is
+   nonzero.  */
+static void
+fill (uint32_t *wc, size_t n, size_t pos, uint32_t c)
+{
+  for (size_t i = 0; i < n; i++)
+    wc[i] = 'a' + i % 26;
+  if (c != 0)
+    wc[pos] = c;
+}
+
+/* Convert INLEN bytes at IN with CD into OUT of OUTLEN bytes.  Return
+   the result of iconv and store the errno, the number of bytes read
+   and the number of bytes written.  */
+static size_t
+convert (iconv_t cd, const char *in, size_t inlen, char *out, size_t outlen,
+	 int *err, size_t *nread, size_t *nwritten)
+{
+  char *inptr = (char *) in;
+  char *outptr = out;
+  size_t inleft = inlen;
+  size_t outleft = outlen;
+
+  TEST_VERIFY (iconv (cd, NULL, NULL, NULL, NULL) == 0);
+  errno = 0;
+  size_t ret = iconv (cd, &inptr, &inleft, &outptr, &outleft);
+  *err = errno;
+  *nread = inptr - in;
+  *nwritten = outptr - out;
+  return ret;
+}
+
+static void
+test_utf8 (void)
+{
+  iconv_t from = iconv_open ("WCHAR_T", "UTF-8");
+  iconv_t to = iconv_open ("UTF-8", "WCHAR_T");
+  TEST_VERIFY_EXIT (from != (iconv_t) -1 && to != (iconv_t) -1);
+
+  uint32_t wc[MAX_CHARS];
+  wchar_t out[MAX_CHARS];
+  char in[4 * MAX_CHARS];
+  char back[4 * MAX_CHARS];
+  int err;
+  size_t nread, nwritten;
+
+  for (size_t n = 1; n <= MAX_CHARS; n += n < 40 ? 1 : 37)
+    for (size_t pos = 0; pos < n; pos++)
+      for (size_t s = 0; s <= array_length (samples); s++)
+	{
+	  uint32_t c = s == 0 ? 0 : samples[s - 1];
+	  fill (wc, n, pos, c);
+	  size_t len = utf8_encode (wc, n, in);
+
+	  /* UTF-8 to WCHAR_T and back.  */
+	  TEST_COMPARE (convert (from, in, len, (char *) out, sizeof (out),
+				 &err, &nread, &nwritten), 0);
+	  TEST_COMPARE (nread, len);
+	  TEST_COMPARE (nwritten, n * sizeof (wchar_t));
+	  for (size_t i = 0; i < n; i++)
+	    if (out[i] != (wchar_t) wc[i])
+	      FAIL ("n %zu, pos %zu, char %#x: element %zu is %#x",
+		    n, pos, c, i, (unsigned int) out[i]);
+
+	  TEST_COMPARE (convert (to, (char *) out, n * sizeof (wchar_t),
+				 back, sizeof (back), &err, &nread,
+				 &nwritten), 0);
+	  TEST_COMPARE_BLOB (back, nwritten, in, len);
+
+	  if (c == 0)
+	    {
+	      /* A byte which cannot start a character, or starts an
+		 overlong or truncated one, in a run of ASCII.  */
+	      static const char bad[][3] = { "\x80", "\xc1\xbf", "\xe0\x9f",
+					     "\xff" };
+	      for (size_t b = 0; pos + 2 < n && b < array_length (bad); b++)
+		{
+		  size_t blen = strlen (bad[b]);
+		  memcpy (in + pos, bad[b], blen);
+		  TEST_COMPARE (convert (from, in, len, (char *) out,
+					 sizeof (out), &err, &nread,
+					 &nwritten), (size_t) -1);
+		  TEST_COMPARE (err, EILSEQ);
+		  TEST_COMPARE (nread, pos);
+		  TEST_COMPARE (nwritten, pos * sizeof (wchar_t));
+		  utf8_encode (wc, n, in);
+		}
+
+	      /* An output buffer which is full at POS.  */
+	      TEST_COMPARE (convert (from, in, len, (char *) out,
+				     pos * sizeof (wchar_t), &err, &nread,
+				     &nwritten), (size_t) -1);
+	      TEST_COMPARE (err, E2BIG);
+	      TEST_COMPARE (nread, pos);
+	      TEST_COMPARE (nwritten, pos * sizeof (wchar_t));
+
+	      TEST_COMPARE (convert (to, (char *) out, n * sizeof (wchar_t),
+				     back, pos, &err, &nread, &nwritten),
+			    (size_t) -1);
+	      TEST_COMPARE (err, E2BIG);
+	      TEST_COMPARE (nread, pos * sizeof (wchar_t));
+	      TEST_COMPARE (nwritten, pos);
+	    }
+	}
+
+  TEST_VERIFY (iconv_close (from) == 0);
+  TEST_VERIFY (iconv_close (to) == 0);
+}
+
+static void
+test_ignore (void)
+{
+  iconv_t cd = iconv_open ("WCHAR_T//IGNORE", "UTF-8");
+  TEST_VERIFY_EXIT (cd != (iconv_t) -1);
+
+  char in[MAX_CHARS];
+  wchar_t out[MAX_CHARS];
+  int err;
+  size_t nread, nwritten;
+
+  for (size_t pos = 0; pos < MAX_CHARS; pos++)
+    {
+      for (size_t i = 0; i < MAX_CHARS; i++)
+	in[i] = 'a' + i % 26;
+      in[pos] = '\xff';
+
+      convert (cd, in, MAX_CHARS, (char *) out, sizeof (out), &err, &nread,
+	       &nwritten);
+      TEST_COMPARE (nread, MAX_CHARS);
+      TEST_COMPARE (nwritten, (MAX_CHARS - 1) * sizeof (wchar_t));
+      for (size_t i = 0; i < MAX_CHARS - 1; i++)
+	TEST_COMPARE (out[i], in[i < pos ? i : i + 1]);
+    }
+
+  TEST_VERIFY (iconv_close (cd) == 0);
+}
+
+static void
+test_ascii (void)
+{
+  iconv_t from = iconv_open ("WCHAR_T", "ASCII");
+  iconv_t to = iconv_open ("ASCII", "WCHAR_T");
+  TEST_VERIFY_EXIT (from != (iconv_t) -1 && to != (iconv_t) -1);
+
+  char in[MAX_CHARS];
+  wchar_t wide[MAX_CHARS];
+  char back[MAX_CHARS];
+  int err;
+  size_t nread, nwritten;
+
+  for (size_t pos = 0; pos < MAX_CHARS; pos++)
+    {
+      for (size_t i = 0; i < MAX_CHARS; i++)
+	in[i] = i % 128;
+
+      TEST_COMPARE (convert (from, in, MAX_CHARS, (char *) wide,
+			     sizeof (wide), &err, &nread, &nwritten), 0);
+      TEST_COMPARE (convert (to, (char *) wide, sizeof (wide), back,
+			     sizeof (back), &err, &nread, &nwritten), 0);
+      TEST_COMPARE_BLOB (back, nwritten, in, MAX_CHARS);
+
+      wide[pos] = 0xe9;
+      TEST_COMPARE (convert (to, (char *) wide, sizeof (wide), back,
+			     sizeof (back), &err, &nread, &nwritten),
+		    (size_t) -1);
+      TEST_COMPARE (err, EILSEQ);
+      TEST_COMPARE (nread, pos * sizeof (wchar_t));
+      TEST_COMPARE (nwritten, pos);
+
+      in[pos] = '\x80';
+      TEST_COMPARE (convert (from, in, MAX_CHARS, (char *) wide,
+			     sizeof (wide), &err, &nread, &nwritten),
+		    (size_t) -1);
+      TEST_COMPARE (err, EILSEQ);
+      TEST_COMPARE (nread, pos);
+      TEST_COMPARE (nwritten, pos * sizeof (wchar_t));
+    }
+
+  TEST_VERIFY (iconv_close (from) == 0);
+  TEST_VERIFY (iconv_close (to) == 0);
+}
+
+static void
+test_ucs2 (const char *charset, int big_endian)
+{
+  iconv_t from = iconv_open ("WCHAR_T", charset);
+  iconv_t to = iconv_open (charset, "WCHAR_T");
+  TEST_VERIFY_EXIT (from != (iconv_t) -1 && to != (iconv_t) -1);
+
+  unsigned char in[2 * MAX_CHARS];
+  wchar_t wide[MAX_CHARS];
+  unsigned char back[2 * MAX_CHARS];
+  int err;
+  size_t nread, nwritten;
+
+  for (size_t pos = 0; pos < MAX_CHARS; pos++)
+    {
+      for (size_t i = 0; i < MAX_CHARS; i++)
+	{
+	  uint16_t u = i * 331 % 0xd800;
+	  in[2 * i + !big_endian] = u >> 8;
+	  in[2 * i + big_endian] = u & 0xff;
+	}
+
+      TEST_COMPARE (convert (from, (char *) in, sizeof (in), (char *) wide,
+			     sizeof (wide), &err, &nread, &nwritten), 0);
+      for (size_t i = 0; i < MAX_CHARS; i++)
+	TEST_COMPARE (wide[i], i * 331 % 0xd800);
+      TEST_COMPARE (convert (to, (char *) wide, sizeof (wide), (char *) back,
+			     sizeof (back), &err, &nread, &nwritten), 0);
+      TEST_COMPARE_BLOB (back, nwritten, in, sizeof (in));
+
+      /* A surrogate is not valid in either direction.  */
+      in[2 * pos + !big_endian] = 0xdc;
+      TEST_COMPARE (convert (from, (char *) in, sizeof (in), (char *) wide,
+			     sizeof (wide), &err, &nread, &nwritten),
+		    (size_t) -1);
+      TEST_COMPARE (err, EILSEQ);
+      TEST_COMPARE (nread, 2 * pos);
+      TEST_COMPARE (nwritten, pos * sizeof (wchar_t));
+
+      wide[pos] = 0xdc00;
+      TEST_COMPARE (convert (to, (char *) wide, sizeof (wide), (char *) back,
+			     sizeof (back), &err, &nread, &nwritten),
+		    (size_t) -1);
+      TEST_COMPARE (err, EILSEQ);
+      TEST_COMPARE (nread, pos * sizeof (wchar_t));
+      TEST_COMPARE (nwritten, 2 * pos);
+
+      /* So is a character outside the BMP.  */
+      wide[pos] = 0x10000;
+      TEST_COMPARE (convert (to, (char *) wide, sizeof (wide), (char *) back,
+			     sizeof (back), &err, &nread, &nwritten),
+		    (size_t) -1);
+      TEST_COMPARE (err, EILSEQ);
+      TEST_COMPARE (nread, pos * sizeof (wchar_t));
+    }
+
+  TEST_VERIFY (iconv_close (from) == 0);
+  TEST_VERIFY (iconv_close (to) == 0);
+}
+
+static int
+do_test (void)
+{
+  test_utf8 ();
+  test_ignore ();
+  test_ascii ();
+  test_ucs2 ("UCS-2BE", 1);
+  test_ucs2 ("UCS-2LE", 0);
+
+  return 0;
+}
+
+#include <support/test-driver.c>
@@ -0,0 +1,157 @@
+/* Test iconv_clone and reopening descriptors kept by iconv_open.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <errno.h>
+#include <iconv.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <support/check.h>
+#include <support/xthread.h>
+
+#define NTHREADS 8
+#define NCONV 100
+
+/* Convert the string IN with CD, which must succeed unless EXPECT_ERR
+   is set, and compare the result with EXPECTED of length EXPLEN.  */
+static void
+check_conv (iconv_t cd, const char *in, const char *expected,
+	    size_t explen, int expect_err)
+{
+  char buf[64];
+  char *inptr = (char *) in;
+  size_t inleft = strlen (in);
+  char *outptr = buf;
+  size_t outleft = sizeof (buf);
+
+  size_t ret = iconv (cd, &inptr, &inleft, &outptr, &outleft);
+  if (expect_err)
+    {
+      TEST_COMPARE (ret, (size_t) -1);
+      TEST_COMPARE (errno, EILSEQ);
+    }
+  else
+    TEST_VERIFY (ret != (size_t) -1);
+  TEST_COMPARE (inleft, 0);
+  TEST_COMPARE_BLOB (buf, outptr - buf, expected, explen);
+}
+
+/* UTF-16 in the byte order of the host, which iconv writes after a
+   byte order mark.  */
+static const uint16_t bom_a[] = { 0xfeff, 'a' };
+static const uint16_t bom_a_eacute[] = { 0xfeff, 'a', 0xe9 };
+static const uint16_t b[] = { 'b' };
+
+static iconv_t template_cd;
+
+static void *
+worker (void *arg)
+{
+  for (int i = 0; i < NCONV; ++i)
+    {
+      iconv_t cd = iconv_clone (template_cd);
+      TEST_VERIFY_EXIT (cd != (iconv_t) -1);
+      check_conv (cd, "a\xc3\xa9", (const char *) bom_a_eacute,
+		  sizeof (bom_a_eacute), 0);
+      TEST_COMPARE (iconv_close (cd), 0);
+    }
+  return NULL;
+}
+
+static int
+do_test (void)
+{
+  /* A clone starts in the initial state, so it writes the byte order
+     mark again, and it works after the original is closed.  */
+  iconv_t cd = iconv_open ("UTF-16", "UTF-8");
+  TEST_VERIFY_EXIT (cd != (iconv_t) -1);
+  check_conv (cd, "a", (const char *) bom_a, sizeof (bom_a), 0);
+  check_conv (cd, "b", (const char *) b, sizeof (b), 0);
+  iconv_t clone = iconv_clone (cd);
+  TEST_VERIFY_EXIT (clone != (iconv_t) -1);
+  TEST_COMPARE (iconv_close (cd), 0);
+  check_conv (clone, "a", (const char *) bom_a, sizeof (bom_a), 0);
+  TEST_COMPARE (iconv_close (clone), 0);
+
+  /* Clones keep the error handling of the original.  */
+  cd = iconv_open ("ASCII//TRANSLIT", "UTF-8");
+  TEST_VERIFY_EXIT (cd != (iconv_t) -1);
+  clone = iconv_clone (cd);
+  TEST_VERIFY_EXIT (clone != (iconv_t) -1);
+  check_conv (clone, "\xc3\x9f", "ss", 2, 0);
+  iconv_close (clone);
+  iconv_close (cd);
+
+  cd = iconv_open ("ASCII//IGNORE", "UTF-8");
+  TEST_VERIFY_EXIT (cd != (iconv_t) -1);
+  clone = iconv_clone (cd);
+  TEST_VERIFY_EXIT (clone != (iconv_t) -1);
+  check_conv (clone, "a\xc3\xa9z", "az", 2, 1);
+  iconv_close (clone);
+  iconv_close (cd);
+
+  /* Open more pairs than iconv_open keeps, so that some are dropped,
+     and then all of them again.  */
+  static const char *const sets[] =
+    { "ISO-8859-1", "ISO-8859-2", "ISO-8859-15", "CP1252", "UTF-16LE",
+      "UTF-32LE", "UCS-2LE", "ASCII", "UTF-7", "KOI8-R" };
+  for (int round = 0; round < 3; ++round)
+    for (size_t i = 0; i < sizeof (sets) / sizeof (sets[0]); ++i)
+      {
+	cd = iconv_open (sets[i], "UTF-8");
+	TEST_VERIFY_EXIT (cd != (iconv_t) -1);
+	iconv_t back = iconv_open ("UTF-8", sets[i]);
+	TEST_VERIFY_EXIT (back != (iconv_t) -1);
+
+	char buf[32];
+	char out[32];
+	char *inptr = (char *) "glibc";
+	size_t inleft = 5;
+	char *outptr = buf;
+	size_t outleft = sizeof (buf);
+	TEST_VERIFY (iconv (cd, &inptr, &inleft, &outptr, &outleft) == 0);
+	TEST_VERIFY (iconv (cd, NULL, NULL, &outptr, &outleft) == 0);
+	inptr = buf;
+	inleft = outptr - buf;
+	outptr = out;
+	outleft = sizeof (out);
+	TEST_VERIFY (iconv (back, &inptr, &inleft, &outptr, &outleft) == 0);
+	TEST_COMPARE_BLOB (out, outptr - out, "glibc", 5);
+
+	TEST_COMPARE (iconv_close (cd), 0);
+	TEST_COMPARE (iconv_close (back), 0);
+      }
+
+  /* Threads clone a shared template.  */
+  template_cd = iconv_open ("UTF-16", "UTF-8");
+  TEST_VERIFY_EXIT (template_cd != (iconv_t) -1);
+  pthread_t threads[NTHREADS];
+  for (int i = 0; i < NTHREADS; ++i)
+    threads[i] = xpthread_create (NULL, worker, NULL);
+  for (int i = 0; i < NTHREADS; ++i)
+    xpthread_join (threads[i]);
+  iconv_close (template_cd);
+
+  errno = 0;
+  TEST_VERIFY (iconv_clone ((iconv_t) -1) == (iconv_t) -1);
+  TEST_COMPARE (errno, EBADF);
+
+  return 0;
+}
+
+#include <support/test-driver.c>
@@ -20,6 +20,7 @@
 
 #include <dlfcn.h>
 #include <stdint.h>
+#include <iconv/iconvconfig.h>
 
 struct gap
 {
@@ -113,5 +114,46 @@ struct gap
 #include <iconv/loop.c>
 
 
+/* The tables as iconvconfig --tables reads them.  It reads them from
+   the shared object, so a copy of the module linked into libc does not
+   export them.  */
+#if !IS_IN (libc)
+static uint32_t
+table_to_ucs4 (unsigned char ch)
+{
+  uint32_t res = to_ucs4[ch];
+
+  if (HAS_HOLES && res == L'\0' && NONNUL (ch))
+    return GCONVTABLES_ILLEGAL;
+  return res;
+}
+
+static int
+table_from_ucs4 (uint32_t ch)
+{
+  const struct gap *rp = from_idx;
+  unsigned char res;
+
+  if (ch >= 0xffff)
+    return -1;
+  while (ch > rp->end)
+    ++rp;
+  if (ch < rp->start
+      || ((res = from_ucs4[ch + rp->idx]) == '\0' && ch != 0))
+    return -1;
+  return res;
+}
+
+extern const struct gconv_8bit gconv_8bit;
+const struct gconv_8bit gconv_8bit =
+  {
+    .charset = CHARSET_NAME,
+    .to_ucs4 = table_to_ucs4,
+    .from_ucs4 = table_from_ucs4,
+    .from_limit = 0xffff
+  };
+#endif
+
+
 /* Now define the toplevel functions.  */
 #include <iconv/skeleton.c>
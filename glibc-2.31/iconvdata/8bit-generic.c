@@ -19,6 +19,7 @@
 
 #include <dlfcn.h>
 #include <stdint.h>
+#include <iconv/iconvconfig.h>
 
 #define FROM_LOOP		from_generic
 #define TO_LOOP			to_generic
@@ -84,5 +85,39 @@
 #include <iconv/loop.c>
 
 
+/* The tables as iconvconfig --tables reads them.  It reads them from
+   the shared object, so a copy of the module linked into libc does not
+   export them.  */
+#if !IS_IN (libc)
+static uint32_t
+table_to_ucs4 (unsigned char ch)
+{
+  uint32_t res = to_ucs4[ch];
+
+  if (HAS_HOLES && res == L'\0' && ch != '\0')
+    return GCONVTABLES_ILLEGAL;
+  return res;
+}
+
+static int
+table_from_ucs4 (uint32_t ch)
+{
+  if (ch >= sizeof (from_ucs4) / sizeof (from_ucs4[0])
+      || (from_ucs4[ch] == '\0' && ch != 0))
+    return -1;
+  return (unsigned char) from_ucs4[ch];
+}
+
+extern const struct gconv_8bit gconv_8bit;
+const struct gconv_8bit gconv_8bit =
+  {
+    .charset = CHARSET_NAME,
+    .to_ucs4 = table_to_ucs4,
+    .from_ucs4 = table_from_ucs4,
+    .from_limit = sizeof (from_ucs4) / sizeof (from_ucs4[0])
+  };
+#endif
+
+
 /* Now define the toplevel functions.  */
 #include <iconv/skeleton.c>
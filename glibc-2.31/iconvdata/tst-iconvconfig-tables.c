@@ -0,0 +1,179 @@
+/* Check the tables of the 8-bit character sets written by iconvconfig.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+/* The file named by the argument was written by iconvconfig --tables
+   for the modules of this directory, which iconv uses since GCONV_PATH
+   is set.  Compare each table with the conversions of its module: all
+   the bytes, and the characters of the blocks which have bytes, and
+   some of the others.  */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <iconv.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <iconv/iconvconfig.h>
+
+#include <support/check.h>
+#include <support/xunistd.h>
+
+/* Convert the character CH to the 8-bit character set with CD and
+   return its byte, or -1 if it has none.  */
+static int
+to_byte (iconv_t cd, uint32_t ch)
+{
+  wchar_t wc = ch;
+  char *inbuf = (char *) &wc;
+  size_t inlen = sizeof (wc);
+  unsigned char out[8];
+  char *outbuf = (char *) out;
+  size_t outlen = sizeof (out);
+
+  iconv (cd, NULL, NULL, NULL, NULL);
+  if (iconv (cd, &inbuf, &inlen, &outbuf, &outlen) == (size_t) -1)
+    {
+      TEST_COMPARE (errno, EILSEQ);
+      return -1;
+    }
+  TEST_COMPARE (sizeof (out) - outlen, 1);
+  return out[0];
+}
+
+static void
+check_table (const struct gconvtables_entry *table, const char *charset,
+	     const unsigned char *pages)
+{
+  iconv_t from = iconv_open ("WCHAR_T", charset);
+  iconv_t to = iconv_open (charset, "WCHAR_T");
+  TEST_VERIFY_EXIT (from != (iconv_t) -1);
+  TEST_VERIFY_EXIT (to != (iconv_t) -1);
+
+  for (int b = 0; b < 256; ++b)
+    {
+      char in = b;
+      char *inbuf = &in;
+      size_t inlen = 1;
+      wchar_t wc;
+      char *outbuf = (char *) &wc;
+      size_t outlen = sizeof (wc);
+
+      iconv (from, NULL, NULL, NULL, NULL);
+      if (iconv (from, &inbuf, &inlen, &outbuf, &outlen) == (size_t) -1)
+	{
+	  TEST_COMPARE (errno, EILSEQ);
+	  TEST_COMPARE (table->to_ucs4[b], GCONVTABLES_ILLEGAL);
+	}
+      else
+	TEST_COMPARE (table->to_ucs4[b], wc);
+    }
+
+  for (uint32_t block = 0; block < 256; ++block)
+    {
+      const unsigned char *page = pages + table->from_page[block] * 256;
+
+      for (uint32_t i = 0; i < 256; ++i)
+	{
+	  uint32_t ch = block * 256 + i;
+	  int expected = page[i] == 0 && ch != 0 ? -1 : page[i];
+
+	  if (table->from_page[block] == 0 && i % 61 != 0)
+	    continue;
+	  if (to_byte (to, ch) != expected)
+	    {
+	      support_record_failure ();
+	      printf ("error: %s: U+%04X should give %d\n", charset,
+		      (unsigned int) ch, expected);
+	    }
+	}
+    }
+
+  /* Nothing outside the BMP has a byte.  */
+  TEST_COMPARE (to_byte (to, 0x10000), -1);
+  TEST_COMPARE (to_byte (to, 0x1f600), -1);
+
+  iconv_close (from);
+  iconv_close (to);
+}
+
+static int
+do_test (int argc, char **argv)
+{
+  if (argc != 2)
+    FAIL_EXIT1 ("usage: %s TABLES", argv[0]);
+
+  int fd = xopen (argv[1], O_RDONLY, 0);
+  struct stat64 st;
+  xfstat (fd, &st);
+  TEST_VERIFY_EXIT ((size_t) st.st_size >= sizeof (struct gconvtables_header));
+  const char *file = xmmap (NULL, st.st_size, PROT_READ, MAP_SHARED, fd);
+  xclose (fd);
+
+  const struct gconvtables_header *header
+    = (const struct gconvtables_header *) file;
+  TEST_COMPARE (header->magic, GCONVTABLES_MAGIC);
+  TEST_VERIFY_EXIT (header->page_offset + header->npages * 256
+		    == (size_t) st.st_size);
+  TEST_COMPARE (header->page_offset,
+		header->table_offset
+		+ header->ntables * sizeof (struct gconvtables_entry));
+
+  const char *strtab = file + header->string_offset;
+  const struct gconvtables_entry *tables
+    = (const struct gconvtables_entry *) (file + header->table_offset);
+  const unsigned char *pages = (const unsigned char *) file
+			       + header->page_offset;
+
+  /* Page zero has no bytes.  */
+  for (int i = 0; i < 256; ++i)
+    TEST_COMPARE (pages[i], 0);
+
+  int seen_iso8859_2 = 0;
+  for (uint32_t n = 0; n < header->ntables; ++n)
+    {
+      const struct gconvtables_entry *table = &tables[n];
+      const char *module = strtab + table->module_offset;
+      const char *charset = strtab + table->charset_offset;
+
+      if (n > 0)
+	TEST_VERIFY (strcmp (strtab + tables[n - 1].module_offset,
+			     module) < 0);
+      TEST_VERIFY ((const char *) table + table->page_offset
+		   == (const char *) pages);
+      for (int i = 0; i < 256; ++i)
+	TEST_VERIFY_EXIT (table->from_page[i] < header->npages);
+
+      const char *slash = strrchr (module, '/');
+      if (slash != NULL && strcmp (slash, "/ISO8859-2.so") == 0)
+	seen_iso8859_2 = 1;
+
+      check_table (table, charset, pages);
+    }
+
+  /* The modules of the ISO-8859 character sets are built from tables,
+     so they must be in the file.  */
+  TEST_VERIFY (seen_iso8859_2);
+
+  xmunmap ((void *) file, st.st_size);
+  return 0;
+}
+
+#define TEST_FUNCTION_ARGV do_test
+#include <support/test-driver.c>
@@ -0,0 +1,251 @@
+/* Test the direct conversions between UTF-8 and 8bit character sets
+   or UTF-16.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <array_length.h>
+#include <errno.h>
+#include <iconv.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <support/check.h>
+
+/* UTF-8, ISO-8859-1, CP1252 and UTF-16 are converted into each other
+   in one step instead of two through the internal UCS4 format.  Check
+   that the results and the errors are those of the two steps.  */
+
+/* Convert INLEN bytes at IN from FROM to TO with a single call to
+   iconv and an output buffer of OUTSIZE bytes, and compare the
+   result with EXPECTED of EXPLEN bytes, the errno with EXP_ERRNO and
+   the number of bytes read with EXP_READ.  */
+static void
+check (const char *from, const char *to, const char *in, size_t inlen,
+       size_t outsize, const char *expected, size_t explen, int exp_errno,
+       size_t exp_read)
+{
+  char out[256];
+  char *inptr = (char *) in;
+  char *outptr = out;
+  size_t inleft = inlen;
+  size_t outleft = outsize;
+
+  TEST_VERIFY_EXIT (outsize <= sizeof (out));
+
+  iconv_t cd = iconv_open (to, from);
+  if (cd == (iconv_t) -1)
+    FAIL_EXIT1 ("iconv_open (\"%s\", \"%s\"): %m", to, from);
+
+  errno = 0;
+  size_t n = iconv (cd, &inptr, &inleft, &outptr, &outleft);
+  if (exp_errno == 0)
+    TEST_VERIFY (n != (size_t) -1);
+  else
+    {
+      TEST_COMPARE (n, (size_t) -1);
+      TEST_COMPARE (errno, exp_errno);
+    }
+  TEST_COMPARE (inptr - in, exp_read);
+  TEST_COMPARE_BLOB (out, outptr - out, expected, explen);
+
+  TEST_VERIFY (iconv_close (cd) == 0);
+}
+
+#define CHECK(from, to, in, outsize, expected, exp_errno, exp_read) \
+  check (from, to, in, sizeof (in) - 1, outsize, expected,		      \
+	 sizeof (expected) - 1, exp_errno, exp_read)
+
+/* Convert IN from UTF-8 to TO and back through WCHAR_T, which takes
+   the two steps, and check that the direct conversion gives the same
+   output and stops at the same place.  */
+static void
+compare_with_wchar (const char *to, const char *in, size_t inlen)
+{
+  char direct[1024];
+  char pivot[1024];
+  wchar_t wide[256];
+
+  iconv_t cd = iconv_open (to, "UTF-8");
+  iconv_t to_wchar = iconv_open ("WCHAR_T", "UTF-8");
+  iconv_t from_wchar = iconv_open (to, "WCHAR_T");
+  TEST_VERIFY_EXIT (cd != (iconv_t) -1);
+  TEST_VERIFY_EXIT (to_wchar != (iconv_t) -1);
+  TEST_VERIFY_EXIT (from_wchar != (iconv_t) -1);
+
+  char *inptr = (char *) in;
+  size_t inleft = inlen;
+  char *outptr = direct;
+  size_t outleft = sizeof (direct);
+  size_t n = iconv (cd, &inptr, &inleft, &outptr, &outleft);
+  int direct_errno = n == (size_t) -1 ? errno : 0;
+  size_t direct_len = outptr - direct;
+  size_t direct_read = inptr - in;
+
+  /* The input is valid UTF-8 and all of it fits into WIDE.  */
+  inptr = (char *) in;
+  inleft = inlen;
+  char *wptr = (char *) wide;
+  size_t wleft = sizeof (wide);
+  TEST_VERIFY (iconv (to_wchar, &inptr, &inleft, &wptr, &wleft) == 0);
+
+  char *wstart = (char *) wide;
+  wleft = wptr - wstart;
+  outptr = pivot;
+  outleft = sizeof (pivot);
+  n = iconv (from_wchar, &wstart, &wleft, &outptr, &outleft);
+  int pivot_errno = n == (size_t) -1 ? errno : 0;
+
+  /* Only the UTF-8 bytes of the characters converted from WCHAR_T
+     are read.  */
+  size_t nchars = (wstart - (char *) wide) / sizeof (wchar_t);
+  inptr = (char *) in;
+  for (size_t i = 0; i < nchars; i++)
+    {
+      unsigned char c = *inptr;
+      inptr += c < 0x80 ? 1 : c < 0xe0 ? 2 : c < 0xf0 ? 3 : 4;
+    }
+
+  TEST_COMPARE (direct_errno, pivot_errno);
+  TEST_COMPARE (direct_read, inptr - in);
+  TEST_COMPARE_BLOB (direct, direct_len, pivot, outptr - pivot);
+
+  TEST_VERIFY (iconv_close (cd) == 0);
+  TEST_VERIFY (iconv_close (to_wchar) == 0);
+  TEST_VERIFY (iconv_close (from_wchar) == 0);
+}
+
+static void
+test_8bit (void)
+{
+  /* A run of ASCII, which is copied in blocks, around other
+     characters.  */
+  CHECK ("UTF-8", "ISO-8859-1",
+	 "abcdefghijklmnopqrstuvwxyz caf\xc3\xa9 \xc3\xbf" "ABCDEFGHIJKLMNOP",
+	 256, "abcdefghijklmnopqrstuvwxyz caf\xe9 \xff" "ABCDEFGHIJKLMNOP",
+	 0, 51);
+  CHECK ("ISO-8859-1", "UTF-8",
+	 "abcdefghijklmnopqrstuvwxyz caf\xe9 \xff" "ABCDEFGHIJKLMNOP",
+	 256,
+	 "abcdefghijklmnopqrstuvwxyz caf\xc3\xa9 \xc3\xbf" "ABCDEFGHIJKLMNOP",
+	 0, 49);
+  CHECK ("CP1252", "UTF-8", "x\x80y\x99z", 256,
+	 "x\xe2\x82\xacy\xe2\x84\xa2z", 0, 5);
+  CHECK ("UTF-8", "CP1252", "x\xe2\x82\xacy\xe2\x84\xa2z", 256,
+	 "x\x80y\x99z", 0, 9);
+
+  /* Characters which are not in the target character set.  */
+  CHECK ("UTF-8", "ISO-8859-1", "ab\xe2\x82\xac" "cd", 256, "ab",
+	 EILSEQ, 2);
+  CHECK ("UTF-8", "CP1252", "ab\xc4\x80" "cd", 256, "ab", EILSEQ, 2);
+  CHECK ("CP1252", "UTF-8", "ab\x81" "cd", 256, "ab", EILSEQ, 2);
+
+  /* They are transliterated in UCS4 or skipped.  */
+  CHECK ("UTF-8", "ISO-8859-1//TRANSLIT",
+	 "1\xe2\x82\xac 2\xe2\x84\xa2 3\xe2\x80\xa6", 256,
+	 "1EUR 2(TM) 3...", 0, 14);
+  CHECK ("UTF-8", "CP1252//TRANSLIT", "1\xe2\x82\xac 2\xe2\x84\xa2", 256,
+	 "1\x80 2\x99", 0, 9);
+  CHECK ("UTF-8", "ISO-8859-1//IGNORE", "ab\xe2\x82\xac" "cd", 256, "abcd",
+	 EILSEQ, 7);
+
+  /* Invalid and incomplete UTF-8.  */
+  CHECK ("UTF-8", "ISO-8859-1", "ab\xc0\x80" "cd", 256, "ab", EILSEQ, 2);
+  CHECK ("UTF-8", "ISO-8859-1", "ab\xed\xa0\x80" "cd", 256, "ab",
+	 EILSEQ, 2);
+  CHECK ("UTF-8", "ISO-8859-1", "ab\xc3", 256, "ab", EINVAL, 2);
+  CHECK ("UTF-8", "ISO-8859-1//IGNORE", "ab\xff" "cd", 256, "abcd",
+	 EILSEQ, 5);
+
+  /* The output buffer is full.  */
+  CHECK ("ISO-8859-1", "UTF-8", "abc\xe9", 4, "abc", E2BIG, 3);
+  CHECK ("UTF-8", "ISO-8859-1//TRANSLIT", "ab\xe2\x82\xac", 4, "ab",
+	 E2BIG, 2);
+}
+
+static void
+test_utf16 (void)
+{
+  CHECK ("UTF-8", "UTF-16BE", "a\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80",
+	 256, "\0a\0\xe9\x20\xac\xd8\x3d\xde\x00", 0, 10);
+  CHECK ("UTF-8", "UTF-16LE", "a\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80",
+	 256, "a\0\xe9\0\xac\x20\x3d\xd8\x00\xde", 0, 10);
+  CHECK ("UTF-16BE", "UTF-8", "\0a\0\xe9\x20\xac\xd8\x3d\xde\x00", 256,
+	 "a\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80", 0, 10);
+  CHECK ("UTF-16LE", "UTF-8", "a\0\xe9\0\xac\x20\x3d\xd8\x00\xde", 256,
+	 "a\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80", 0, 10);
+
+  /* UTF-16 starts with a Byte Order Mark in the host byte order, and
+     the input may be in either.  */
+  if (BYTE_ORDER == LITTLE_ENDIAN)
+    CHECK ("UTF-8", "UTF-16", "ab", 256, "\xff\xfe" "a\0b\0", 0, 2);
+  else
+    CHECK ("UTF-8", "UTF-16", "ab", 256, "\xfe\xff\0a\0b", 0, 2);
+  CHECK ("UTF-16", "UTF-8", "\xfe\xff\0a\0b", 256, "ab", 0, 6);
+  CHECK ("UTF-16", "UTF-8", "\xff\xfe" "a\0b\0", 256, "ab", 0, 6);
+  CHECK ("UTF-8", "UTF-16", "", 256, "", 0, 0);
+
+  /* Surrogates which are not paired, and characters beyond UTF-16.  */
+  CHECK ("UTF-16BE", "UTF-8", "\0a\xdc\x00\0b", 256, "a", EILSEQ, 2);
+  CHECK ("UTF-16BE", "UTF-8", "\0a\xd8\x3d\0b", 256, "a", EILSEQ, 2);
+  CHECK ("UTF-16BE", "UTF-8", "\0a\xd8\x3d", 256, "a", EINVAL, 2);
+  CHECK ("UTF-8", "UTF-16BE", "a\xf8\x88\x80\x80\x80", 256, "\0a",
+	 EILSEQ, 1);
+  CHECK ("UTF-8", "UTF-16BE//IGNORE", "a\xf8\x88\x80\x80\x80" "b", 256,
+	 "\0a\0b", EILSEQ, 7);
+
+  CHECK ("UTF-8", "UTF-16BE", "ab\xf0\x9f\x98\x80", 7, "\0a\0b", E2BIG, 2);
+}
+
+static void
+test_compare (void)
+{
+  static const char *const charsets[] =
+    { "ISO-8859-1", "CP1252", "UTF-16LE", "UTF-16BE",
+      "ISO-8859-1//TRANSLIT", "CP1252//TRANSLIT" };
+  static const char *const pieces[] =
+    { "a", "Hello, world", "\xc3\xa9", "\xc3\xbf", "\xe2\x82\xac",
+      "\xe2\x84\xa2", "\xc5\x92", "\xe4\xb8\xad", "\xf0\x9f\x98\x80" };
+  char in[200];
+
+  srand (1);
+  for (size_t c = 0; c < array_length (charsets); c++)
+    for (int iter = 0; iter < 200; iter++)
+      {
+	size_t len = 0;
+	for (;;)
+	  {
+	    const char *p = pieces[rand () % array_length (pieces)];
+	    if (len + strlen (p) > sizeof (in))
+	      break;
+	    memcpy (in + len, p, strlen (p));
+	    len += strlen (p);
+	  }
+	compare_with_wchar (charsets[c], in, len);
+      }
+}
+
+static int
+do_test (void)
+{
+  test_8bit ();
+  test_utf16 ();
+  test_compare ();
+
+  return 0;
+}
+
+#include <support/test-driver.c>
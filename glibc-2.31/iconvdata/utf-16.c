@@ -20,6 +20,7 @@
 #include <byteswap.h>
 #include <dlfcn.h>
 #include <gconv.h>
+#include <gconv_bulk.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <stdlib.h>
@@ -197,6 +198,18 @@ gconv_end (struct __gconv_step *data)
 #define MIN_NEEDED_OUTPUT	MIN_NEEDED_FROM
 #define MAX_NEEDED_OUTPUT	MAX_NEEDED_FROM
 #define LOOPFCT			TO_LOOP
+#define BULK_BODY \
+  {									      \
+    size_t done = gconv_bulk_ucs4_to_ucs2 (inptr, outptr,		      \
+					   MIN ((inend - inptr) / 4,	      \
+						(outend - outptr) / 2), swap); \
+    if (done != 0)							      \
+      {									      \
+	inptr += 4 * done;						      \
+	outptr += 2 * done;						      \
+	continue;							      \
+      }									      \
+  }
 #define BODY \
   {									      \
     uint32_t c = get32 (inptr);						      \
@@ -277,6 +290,18 @@ gconv_end (struct __gconv_step *data)
 #define MAX_NEEDED_INPUT	MAX_NEEDED_FROM
 #define MIN_NEEDED_OUTPUT	MIN_NEEDED_TO
 #define LOOPFCT			FROM_LOOP
+#define BULK_BODY \
+  {									      \
+    size_t done = gconv_bulk_ucs2_to_ucs4 (inptr, outptr,		      \
+					   MIN ((inend - inptr) / 2,	      \
+						(outend - outptr) / 4), swap); \
+    if (done != 0)							      \
+      {									      \
+	inptr += 2 * done;						      \
+	outptr += 4 * done;						      \
+	continue;							      \
+      }									      \
+  }
 #define BODY \
   {									      \
     uint16_t u1 = get16 (inptr);					      \
@@ -0,0 +1,385 @@
+/* Direct conversion between UTF-8 and ISO-8859-1 or CP1252.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <dlfcn.h>
+#include <gconv.h>
+#include <gconv_bulk.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/param.h>
+#include "utf8-direct.h"
+
+struct gap
+{
+  uint16_t start;
+  uint16_t end;
+  int32_t idx;
+};
+
+/* The tables of CP1252, as used by 8bit-gap.c.  ISO-8859-1 maps the
+   bytes to the first 256 characters and needs none.  */
+#include <cp1252.h>
+
+
+/* Definitions used in the body of the `gconv' function.  */
+#define FROM_LOOP		from_8bit_loop
+#define TO_LOOP			to_8bit_loop
+#define DEFINE_INIT		0
+#define DEFINE_FINI		0
+#define MIN_NEEDED_FROM		1
+#define MIN_NEEDED_TO		1
+#define MAX_NEEDED_TO		6
+#define ONE_DIRECTION		0
+#define FROM_DIRECTION		(dir == from_8bit)
+#define PREPARE_LOOP \
+  enum direction dir = ((struct utf8_8bit_data *) step->__data)->dir;	      \
+  const uint32_t *table = ((struct utf8_8bit_data *) step->__data)->table;
+#define EXTRA_LOOP_ARGS		, table
+
+
+/* Direction of the transformation.  */
+enum direction
+{
+  illegal_dir,
+  to_8bit,
+  from_8bit
+};
+
+struct utf8_8bit_data
+{
+  enum direction dir;
+  /* The table from the 8bit character set to UCS4, or NULL for
+     ISO-8859-1.  */
+  const uint32_t *table;
+};
+
+
+extern int gconv_init (struct __gconv_step *step);
+int
+gconv_init (struct __gconv_step *step)
+{
+  /* Determine which direction.  */
+  struct utf8_8bit_data *new_data;
+  enum direction dir = illegal_dir;
+  const char *charset = NULL;
+  const uint32_t *table = NULL;
+
+  if (__strcasecmp (step->__to_name, "ISO-10646/UTF8/") == 0)
+    {
+      dir = from_8bit;
+      charset = step->__from_name;
+    }
+  else if (__strcasecmp (step->__from_name, "ISO-10646/UTF8/") == 0)
+    {
+      dir = to_8bit;
+      charset = step->__to_name;
+    }
+
+  if (dir == illegal_dir)
+    return __GCONV_NOCONV;
+  if (__strcasecmp (charset, "CP1252//") == 0)
+    table = to_ucs4;
+  else if (__strcasecmp (charset, "ISO-8859-1//") != 0)
+    return __GCONV_NOCONV;
+
+  new_data = (struct utf8_8bit_data *) malloc (sizeof (*new_data));
+  if (new_data == NULL)
+    return __GCONV_NOMEM;
+
+  new_data->dir = dir;
+  new_data->table = table;
+  step->__data = new_data;
+
+  if (dir == from_8bit)
+    {
+      step->__min_needed_from = MIN_NEEDED_FROM;
+      step->__max_needed_from = MIN_NEEDED_FROM;
+      step->__min_needed_to = MIN_NEEDED_TO;
+      step->__max_needed_to = MAX_NEEDED_TO;
+    }
+  else
+    {
+      step->__min_needed_from = MIN_NEEDED_TO;
+      step->__max_needed_from = MAX_NEEDED_TO;
+      step->__min_needed_to = MIN_NEEDED_FROM;
+      step->__max_needed_to = MIN_NEEDED_FROM;
+    }
+
+  step->__stateful = 0;
+
+  return __GCONV_OK;
+}
+
+
+extern void gconv_end (struct __gconv_step *data);
+void
+gconv_end (struct __gconv_step *data)
+{
+  free (data->__data);
+}
+
+
+/* Return the byte for CH in the character set with TABLE, or -1 if
+   there is none.  */
+static inline int
+ucs4_to_8bit (const uint32_t *table, uint32_t ch)
+{
+  if (ch < 0x80)
+    return ch;
+
+  if (table == NULL)
+    return ch <= 0xff ? (int) ch : -1;
+
+  const struct gap *rp = from_idx;
+  unsigned char res;
+
+  if (ch >= 0xffff)
+    return -1;
+  while (ch > rp->end)
+    ++rp;
+  if (ch < rp->start || (res = from_ucs4[ch + rp->idx]) == '\0')
+    return -1;
+  return res;
+}
+
+/* Convert UCS4 to the 8bit character set, for the transliteration.  */
+static int
+ucs4_to_8bit_fct (struct __gconv_step *step, struct __gconv_step_data *data,
+		  const unsigned char **inptrp, const unsigned char *inend,
+		  unsigned char **outbufstart, size_t *irreversible,
+		  int do_flush, int consume_incomplete)
+{
+  const uint32_t *table = ((struct utf8_8bit_data *) step->__data)->table;
+  const unsigned char *inptr = *inptrp;
+  unsigned char *outptr = *outbufstart;
+  int result = __GCONV_EMPTY_INPUT;
+
+  while (inptr + 4 <= inend)
+    {
+      uint32_t ch;
+      memcpy (&ch, inptr, sizeof (ch));
+      int res = ucs4_to_8bit (table, ch);
+
+      if (res < 0)
+	{
+	  result = __GCONV_ILLEGAL_INPUT;
+	  break;
+	}
+      if (outptr >= data->__outbufend)
+	{
+	  result = __GCONV_FULL_OUTPUT;
+	  break;
+	}
+
+      *outptr++ = res;
+      inptr += 4;
+    }
+
+  *inptrp = inptr;
+  *outbufstart = outptr;
+  return result;
+}
+
+
+/* Convert from the 8bit character set with TABLE to UTF-8 at *INPTRP
+   and *OUTPTRP as long as the input is ASCII, which is copied in
+   blocks, or defined characters, and return whether anything was
+   converted.  BODY below handles everything else.  */
+static inline int
+__attribute ((always_inline))
+from_8bit_bulk (const uint32_t *table, const unsigned char **inptrp,
+		const unsigned char *inend, unsigned char **outptrp,
+		const unsigned char *outend)
+{
+  const unsigned char *inptr = *inptrp;
+  unsigned char *outptr = *outptrp;
+
+  while (inptr < inend && outend - outptr >= 4)
+    {
+      uint32_t ch = *inptr;
+
+      if (ch < 0x80)
+	{
+	  size_t done = gconv_bulk_ascii_copy (inptr, outptr,
+					       MIN (inend - inptr,
+						    outend - outptr));
+	  if (done != 0)
+	    {
+	      inptr += done;
+	      outptr += done;
+	      continue;
+	    }
+	}
+      else if (table != NULL)
+	{
+	  ch = table[ch];
+	  if (ch == L'\0')
+	    break;
+	}
+
+      outptr = utf8_direct_put (outptr, ch);
+      ++inptr;
+    }
+
+  if (inptr == *inptrp)
+    return 0;
+  *inptrp = inptr;
+  *outptrp = outptr;
+  return 1;
+}
+
+/* Likewise from UTF-8 to the 8bit character set, for well-formed
+   sequences of characters which it has.  */
+static inline int
+__attribute ((always_inline))
+to_8bit_bulk (const uint32_t *table, const unsigned char **inptrp,
+	      const unsigned char *inend, unsigned char **outptrp,
+	      const unsigned char *outend)
+{
+  const unsigned char *inptr = *inptrp;
+  unsigned char *outptr = *outptrp;
+
+  /* Leave the last few bytes to BODY.  */
+  if (inend - inptr < 16)
+    return 0;
+
+  while (inptr < inend && outptr < outend)
+    {
+      uint32_t ch;
+
+      if (*inptr < 0x80)
+	{
+	  size_t done = gconv_bulk_ascii_copy (inptr, outptr,
+					       MIN (inend - inptr,
+						    outend - outptr));
+	  if (done != 0)
+	    {
+	      inptr += done;
+	      outptr += done;
+	      continue;
+	    }
+	}
+
+      int cnt = utf8_direct_decode (inptr, inend, &ch);
+      if (cnt <= 0)
+	break;
+      int res = ucs4_to_8bit (table, ch);
+      if (res < 0)
+	break;
+
+      *outptr++ = res;
+      inptr += cnt;
+    }
+
+  if (inptr == *inptrp)
+    return 0;
+  *inptrp = inptr;
+  *outptrp = outptr;
+  return 1;
+}
+
+
+/* Convert from the 8bit character set to UTF-8.  */
+#define MIN_NEEDED_INPUT	MIN_NEEDED_FROM
+#define MIN_NEEDED_OUTPUT	MIN_NEEDED_TO
+#define MAX_NEEDED_OUTPUT	MAX_NEEDED_TO
+#define LOOPFCT			FROM_LOOP
+#define BULK_BODY \
+  {									      \
+    if (from_8bit_bulk (table, &inptr, inend, &outptr, outend))		      \
+      continue;								      \
+  }
+#define BODY \
+  {									      \
+    uint32_t ch = *inptr;						      \
+									      \
+    if (ch >= 0x80 && table != NULL)					      \
+      {									      \
+	ch = table[ch];							      \
+	if (__glibc_unlikely (ch == L'\0'))				      \
+	  {								      \
+	    /* This is an illegal character.  */			      \
+	    STANDARD_FROM_LOOP_ERR_HANDLER (1);				      \
+	  }								      \
+      }									      \
+									      \
+    if (__glibc_unlikely (outptr + utf8_direct_length (ch) > outend))	      \
+      {									      \
+	/* Overflow in the output buffer.  */				      \
+	result = __GCONV_FULL_OUTPUT;					      \
+	break;								      \
+      }									      \
+									      \
+    outptr = utf8_direct_put (outptr, ch);				      \
+    ++inptr;								      \
+  }
+#define LOOP_NEED_FLAGS
+#define EXTRA_LOOP_DECLS \
+	, const uint32_t *table
+#include <iconv/loop.c>
+
+
+/* Convert from UTF-8 to the 8bit character set.  */
+#define MIN_NEEDED_INPUT	MIN_NEEDED_TO
+#define MAX_NEEDED_INPUT	MAX_NEEDED_TO
+#define MIN_NEEDED_OUTPUT	MIN_NEEDED_FROM
+#define LOOPFCT			TO_LOOP
+#define BULK_BODY \
+  {									      \
+    if (to_8bit_bulk (table, &inptr, inend, &outptr, outend))		      \
+      continue;								      \
+  }
+#define BODY \
+  {									      \
+    uint32_t ch;							      \
+    int cnt = utf8_direct_decode (inptr, inend, &ch);			      \
+									      \
+    if (__glibc_unlikely (cnt <= 0))					      \
+      {									      \
+	if (cnt == 0)							      \
+	  {								      \
+	    /* We don't have enough input for another complete input	      \
+	       character.  */						      \
+	    result = __GCONV_INCOMPLETE_INPUT;				      \
+	    break;							      \
+	  }								      \
+									      \
+	STANDARD_FROM_LOOP_ERR_HANDLER (-cnt);				      \
+      }									      \
+									      \
+    int res = ucs4_to_8bit (table, ch);					      \
+    if (__glibc_unlikely (res < 0))					      \
+      {									      \
+	UNICODE_TAG_HANDLER (ch, cnt);					      \
+									      \
+	/* We have an illegal character.  */				      \
+	UTF8_DIRECT_TO_ERR_HANDLER (ch, cnt, ucs4_to_8bit_fct);		      \
+      }									      \
+									      \
+    *outptr++ = res;							      \
+    inptr += cnt;							      \
+  }
+#define LOOP_NEED_FLAGS
+#define EXTRA_LOOP_DECLS \
+	, const uint32_t *table
+#include <iconv/loop.c>
+
+
+/* Now define the toplevel functions.  */
+#include <iconv/skeleton.c>
@@ -0,0 +1,263 @@
+/* Helpers for the direct conversions from and to UTF-8.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#ifndef _UTF8_DIRECT_H
+#define _UTF8_DIRECT_H	1
+
+#include <gconv.h>
+#include <iconv/gconv_int.h>
+#include <stdint.h>
+
+/* The modules using these helpers convert between UTF-8 and another
+   character set in one step instead of two through the internal UCS4
+   format, and must behave like the two steps: the UTF-8 input is
+   checked exactly as in gconv_simple.c, and the characters which
+   cannot be represented are transliterated in UCS4.  */
+
+/* Decode the UTF-8 sequence at INPTR.  Return its length and store the
+   character in *CHP, or return 0 if the input ends in a sequence which
+   is correct so far, or minus the number of bytes to skip if the
+   sequence is ill-formed.  */
+static inline int
+__attribute ((always_inline))
+utf8_direct_decode (const unsigned char *inptr, const unsigned char *inend,
+		    uint32_t *chp)
+{
+  uint32_t ch = inptr[0];
+  int cnt;
+  int i;
+
+  if (ch < 0x80)
+    {
+      *chp = ch;
+      return 1;
+    }
+
+  if (ch >= 0xc2 && ch < 0xe0)
+    {
+      /* We expect two bytes.  The first byte cannot be 0xc0 or 0xc1,
+	 otherwise the wide character could have been represented
+	 using a single byte.  */
+      cnt = 2;
+      ch &= 0x1f;
+    }
+  else if ((ch & 0xf0) == 0xe0)
+    {
+      cnt = 3;
+      ch &= 0x0f;
+    }
+  else if ((ch & 0xf8) == 0xf0)
+    {
+      cnt = 4;
+      ch &= 0x07;
+    }
+  else if ((ch & 0xfc) == 0xf8)
+    {
+      cnt = 5;
+      ch &= 0x03;
+    }
+  else if ((ch & 0xfe) == 0xfc)
+    {
+      cnt = 6;
+      ch &= 0x01;
+    }
+  else
+    {
+      /* Search the end of this ill-formed UTF-8 character.  This is
+	 the next byte with (x & 0xc0) != 0x80.  */
+      i = 0;
+      do
+	++i;
+      while (inptr + i < inend && (inptr[i] & 0xc0) == 0x80 && i < 5);
+      return -i;
+    }
+
+  if (__glibc_unlikely (inptr + cnt > inend))
+    {
+      /* We don't have enough input.  But before we report that check
+	 that all the bytes are correct.  */
+      for (i = 1; inptr + i < inend; ++i)
+	if ((inptr[i] & 0xc0) != 0x80)
+	  return -i;
+      return 0;
+    }
+
+  for (i = 1; i < cnt; ++i)
+    {
+      uint32_t byte = inptr[i];
+
+      if ((byte & 0xc0) != 0x80)
+	/* This is an illegal encoding.  */
+	return -i;
+
+      ch <<= 6;
+      ch |= byte & 0x3f;
+    }
+
+  /* If cnt > 2 and ch < 2^(5*cnt-4), the wide character ch could have
+     been represented with fewer than cnt bytes.  Do not accept UTF-16
+     surrogates either.  */
+  if ((cnt > 2 && (ch >> (5 * cnt - 4)) == 0)
+      || (ch >= 0xd800 && ch <= 0xdfff))
+    return -cnt;
+
+  *chp = ch;
+  return cnt;
+}
+
+/* Return the length of the UTF-8 sequence for WC, which is a Unicode
+   character and not a surrogate.  */
+static inline int
+utf8_direct_length (uint32_t wc)
+{
+  return wc < 0x80 ? 1 : wc < 0x800 ? 2 : wc < 0x10000 ? 3 : 4;
+}
+
+/* Store the UTF-8 sequence for WC at OUTPTR, which has room for it, and
+   return the pointer past it.  */
+static inline unsigned char *
+utf8_direct_put (unsigned char *outptr, uint32_t wc)
+{
+  if (wc < 0x80)
+    *outptr++ = wc;
+  else if (wc < 0x800)
+    {
+      *outptr++ = 0xc0 | (wc >> 6);
+      *outptr++ = 0x80 | (wc & 0x3f);
+    }
+  else if (wc < 0x10000)
+    {
+      *outptr++ = 0xe0 | (wc >> 12);
+      *outptr++ = 0x80 | ((wc >> 6) & 0x3f);
+      *outptr++ = 0x80 | (wc & 0x3f);
+    }
+  else
+    {
+      *outptr++ = 0xf0 | (wc >> 18);
+      *outptr++ = 0x80 | ((wc >> 12) & 0x3f);
+      *outptr++ = 0x80 | ((wc >> 6) & 0x3f);
+      *outptr++ = 0x80 | (wc & 0x3f);
+    }
+  return outptr;
+}
+
+/* The number of characters handed to __gconv_transliterate, which is
+   more than the longest sequence in the locales' tables.  */
+#define UTF8_DIRECT_TRANSLIT_WINDOW	8
+
+/* Transliterate the character CH of CNT bytes at *INPTRP, which cannot
+   be represented in the target character set.  __gconv_transliterate
+   only handles UCS4 input, which it converts with the function of
+   STEP, so decode the next few characters too and pass it a copy of
+   STEP with UCS4_FCT, which converts from UCS4 to the target character
+   set.  Then skip the bytes of the characters it consumed.  The return
+   value is that of __gconv_transliterate.  */
+static int
+utf8_direct_transliterate (struct __gconv_step *step,
+			   struct __gconv_step_data *step_data,
+			   __gconv_fct ucs4_fct, uint32_t ch, int cnt,
+			   const unsigned char **inptrp,
+			   const unsigned char *inend,
+			   unsigned char **outptrp, size_t *irreversible)
+{
+  uint32_t window[UTF8_DIRECT_TRANSLIT_WINDOW] = { ch };
+  unsigned char len[UTF8_DIRECT_TRANSLIT_WINDOW] = { cnt };
+  const unsigned char *inptr = *inptrp + cnt;
+  size_t n = 1;
+  int at_end = 0;
+
+  while (n < UTF8_DIRECT_TRANSLIT_WINDOW)
+    {
+      if (inptr == inend)
+	{
+	  at_end = 1;
+	  break;
+	}
+
+      cnt = utf8_direct_decode (inptr, inend, &window[n]);
+      if (cnt <= 0)
+	{
+	  at_end = cnt == 0;
+	  break;
+	}
+      len[n++] = cnt;
+      inptr += cnt;
+    }
+
+  struct __gconv_step ucs4_step = *step;
+  ucs4_step.__fct = ucs4_fct;
+  ucs4_step.__shlib_handle = NULL;
+
+  const unsigned char *winptr = (const unsigned char *) window;
+  int result = __gconv_transliterate (&ucs4_step, step_data, winptr,
+				      &winptr,
+				      (const unsigned char *) &window[n],
+				      outptrp, irreversible);
+
+  /* A prefix of a sequence in the tables only matches if the input
+     really ends there.  */
+  if (result == __GCONV_INCOMPLETE_INPUT && !at_end)
+    result = __GCONV_ILLEGAL_INPUT;
+
+  for (size_t i = 0; i < (size_t) (winptr - (const unsigned char *) window)
+			 / sizeof (uint32_t); ++i)
+    *inptrp += len[i];
+
+  return result;
+}
+
+/* Error handling in the loops from UTF-8 for Character, which takes
+   Incr bytes and cannot be represented, like
+   STANDARD_TO_LOOP_ERR_HANDLER in loop.c.  Fct is the UCS4 conversion
+   function for utf8_direct_transliterate.  */
+#define UTF8_DIRECT_TO_ERR_HANDLER(Character, Incr, Fct) \
+  {									      \
+    result = __GCONV_ILLEGAL_INPUT;					      \
+									      \
+    if (irreversible == NULL)						      \
+      break;								      \
+									      \
+    /* First try the transliteration methods.  */			      \
+    if ((step_data->__flags & __GCONV_TRANSLIT) != 0)			      \
+      result = utf8_direct_transliterate (step, step_data, Fct,		      \
+					  (Character), (Incr), &inptr,	      \
+					  inend, &outptr, irreversible);      \
+									      \
+    /* If any of them recognized the input continue with the loop.  */	      \
+    if (result != __GCONV_ILLEGAL_INPUT)				      \
+      {									      \
+	if (__glibc_unlikely (result == __GCONV_FULL_OUTPUT		      \
+			      || result == __GCONV_INCOMPLETE_INPUT))	      \
+	  break;							      \
+									      \
+	continue;							      \
+      }									      \
+									      \
+    /* Next see whether we have to ignore the error.  If not, stop.  */	      \
+    if (! ignore_errors_p ())						      \
+      break;								      \
+									      \
+    /* When we come here it means we ignore the character.  */		      \
+    ++*irreversible;							      \
+    inptr += Incr;							      \
+    /* But we keep result == __GCONV_ILLEGAL_INPUT, because of the constraint \
+       that "iconv -c" must give the same exitcode as "iconv".  */	      \
+    continue;								      \
+  }
+
+#endif /* utf8-direct.h */
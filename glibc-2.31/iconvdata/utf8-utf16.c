@@ -0,0 +1,491 @@
+/* Direct conversion between UTF-8 and UTF-16.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <byteswap.h>
+#include <dlfcn.h>
+#include <gconv.h>
+#include <gconv_bulk.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/param.h>
+#include "utf8-direct.h"
+
+/* This is the Byte Order Mark character (BOM).  */
+#define BOM	0xfeff
+/* And in the other byte order.  */
+#define BOM_OE	0xfffe
+
+
+/* Definitions used in the body of the `gconv' function.  The byte
+   order marks are handled as in utf-16.c.  */
+#define FROM_LOOP		from_utf16_loop
+#define TO_LOOP			to_utf16_loop
+#define DEFINE_INIT		0
+#define DEFINE_FINI		0
+#define MIN_NEEDED_FROM		2
+#define MAX_NEEDED_FROM		4
+#define MIN_NEEDED_TO		1
+#define MAX_NEEDED_TO		6
+#define ONE_DIRECTION		0
+#define FROM_DIRECTION		(dir == from_utf16)
+#define PREPARE_LOOP \
+  enum direction dir = ((struct utf16_data *) step->__data)->dir;	      \
+  enum variant var = ((struct utf16_data *) step->__data)->var;		      \
+  if (__glibc_unlikely (data->__invocation_counter == 0))		      \
+    {									      \
+      if (var == UTF_16)						      \
+	{								      \
+	  if (FROM_DIRECTION)						      \
+	    {								      \
+	      /* We have to find out which byte order the file is	      \
+		 encoded in.  */					      \
+	      if (inptr + 2 > inend)					      \
+		return (inptr == inend					      \
+			? __GCONV_EMPTY_INPUT : __GCONV_INCOMPLETE_INPUT);    \
+									      \
+	      if (get16u (inptr) == BOM)				      \
+		/* Simply ignore the BOM character.  */			      \
+		*inptrp = inptr += 2;					      \
+	      else if (get16u (inptr) == BOM_OE)			      \
+		{							      \
+		  data->__flags |= __GCONV_SWAP;			      \
+		  *inptrp = inptr += 2;					      \
+		}							      \
+	    }								      \
+	  else if (!FROM_DIRECTION && !data->__internal_use)		      \
+	    {								      \
+	      /* Emit the Byte Order Mark with the first character, as	      \
+		 the conversion from UCS4 does when it is the second	      \
+		 step.  Until there is one, leave the input to the next	      \
+		 call or report the error.  */				      \
+	      uint32_t c;						      \
+	      int cnt = (inptr == inend					      \
+			 ? 0 : utf8_direct_decode (inptr, inend, &c));	      \
+	      if (cnt == 0)						      \
+		return (inptr == inend					      \
+			? __GCONV_EMPTY_INPUT : __GCONV_INCOMPLETE_INPUT);    \
+	      if (cnt < 0 && (data->__flags & __GCONV_IGNORE_ERRORS) == 0)    \
+		return __GCONV_ILLEGAL_INPUT;				      \
+	      if (__glibc_unlikely (outbuf + 2 > outend))		      \
+		return __GCONV_FULL_OUTPUT;				      \
+									      \
+	      put16u (outbuf, BOM);					      \
+	      outbuf += 2;						      \
+	    }								      \
+	}								      \
+      else if ((var == UTF_16LE && BYTE_ORDER == BIG_ENDIAN)		      \
+	       || (var == UTF_16BE && BYTE_ORDER == LITTLE_ENDIAN))	      \
+	data->__flags |= __GCONV_SWAP;					      \
+    }									      \
+  const int swap = data->__flags & __GCONV_SWAP;
+#define EXTRA_LOOP_ARGS		, swap
+
+
+/* Direction of the transformation.  */
+enum direction
+{
+  illegal_dir,
+  to_utf16,
+  from_utf16
+};
+
+enum variant
+{
+  illegal_var,
+  UTF_16,
+  UTF_16LE,
+  UTF_16BE
+};
+
+struct utf16_data
+{
+  enum direction dir;
+  enum variant var;
+};
+
+
+extern int gconv_init (struct __gconv_step *step);
+int
+gconv_init (struct __gconv_step *step)
+{
+  /* Determine which direction.  */
+  struct utf16_data *new_data;
+  enum direction dir = illegal_dir;
+  enum variant var = illegal_var;
+  const char *charset = NULL;
+
+  if (__strcasecmp (step->__to_name, "ISO-10646/UTF8/") == 0)
+    {
+      dir = from_utf16;
+      charset = step->__from_name;
+    }
+  else if (__strcasecmp (step->__from_name, "ISO-10646/UTF8/") == 0)
+    {
+      dir = to_utf16;
+      charset = step->__to_name;
+    }
+
+  if (dir == illegal_dir)
+    return __GCONV_NOCONV;
+  if (__strcasecmp (charset, "UTF-16//") == 0)
+    var = UTF_16;
+  else if (__strcasecmp (charset, "UTF-16BE//") == 0)
+    var = UTF_16BE;
+  else if (__strcasecmp (charset, "UTF-16LE//") == 0)
+    var = UTF_16LE;
+  else
+    return __GCONV_NOCONV;
+
+  new_data = (struct utf16_data *) malloc (sizeof (struct utf16_data));
+  if (new_data == NULL)
+    return __GCONV_NOMEM;
+
+  new_data->dir = dir;
+  new_data->var = var;
+  step->__data = new_data;
+
+  if (dir == from_utf16)
+    {
+      step->__min_needed_from = MIN_NEEDED_FROM;
+      step->__max_needed_from = MAX_NEEDED_FROM;
+      step->__min_needed_to = MIN_NEEDED_TO;
+      step->__max_needed_to = MAX_NEEDED_TO;
+    }
+  else
+    {
+      step->__min_needed_from = MIN_NEEDED_TO;
+      step->__max_needed_from = MAX_NEEDED_TO;
+      step->__min_needed_to = MIN_NEEDED_FROM;
+      step->__max_needed_to = MAX_NEEDED_FROM;
+    }
+
+  step->__stateful = 0;
+
+  return __GCONV_OK;
+}
+
+
+extern void gconv_end (struct __gconv_step *data);
+void
+gconv_end (struct __gconv_step *data)
+{
+  free (data->__data);
+}
+
+
+/* Convert UCS4 to UTF-16, for the transliteration.  */
+static int
+ucs4_to_utf16_fct (struct __gconv_step *step, struct __gconv_step_data *data,
+		   const unsigned char **inptrp, const unsigned char *inend,
+		   unsigned char **outbufstart, size_t *irreversible,
+		   int do_flush, int consume_incomplete)
+{
+  const int swap = data->__flags & __GCONV_SWAP;
+  const unsigned char *inptr = *inptrp;
+  unsigned char *outptr = *outbufstart;
+  int result = __GCONV_EMPTY_INPUT;
+
+  while (inptr + 4 <= inend)
+    {
+      uint32_t ch;
+      uint16_t u[2];
+      size_t n = 1;
+
+      memcpy (&ch, inptr, sizeof (ch));
+      if ((ch >= 0xd800 && ch < 0xe000) || ch >= 0x110000)
+	{
+	  result = __GCONV_ILLEGAL_INPUT;
+	  break;
+	}
+      if (ch >= 0x10000)
+	{
+	  u[0] = 0xd7c0 + (ch >> 10);
+	  u[1] = 0xdc00 + (ch & 0x3ff);
+	  n = 2;
+	}
+      else
+	u[0] = ch;
+      if (outptr + 2 * n > data->__outbufend)
+	{
+	  result = __GCONV_FULL_OUTPUT;
+	  break;
+	}
+
+      for (size_t i = 0; i < n; ++i)
+	{
+	  uint16_t w = swap ? bswap_16 (u[i]) : u[i];
+	  memcpy (outptr, &w, sizeof (w));
+	  outptr += 2;
+	}
+      inptr += 4;
+    }
+
+  *inptrp = inptr;
+  *outbufstart = outptr;
+  return result;
+}
+
+
+/* Convert from UTF-8 to UTF-16 at *INPTRP and *OUTPTRP as long as the
+   input is ASCII, which is converted in blocks, or well-formed
+   sequences of characters below 0x110000, and return whether anything
+   was converted.  BODY below handles everything else.  */
+static inline int
+__attribute ((always_inline))
+utf8_utf16_bulk (const unsigned char **inptrp, const unsigned char *inend,
+		 unsigned char **outptrp, const unsigned char *outend,
+		 int swap)
+{
+  const unsigned char *inptr = *inptrp;
+  unsigned char *outptr = *outptrp;
+
+  /* Leave the last few bytes to BODY.  */
+  if (inend - inptr < 16)
+    return 0;
+
+  while (inptr < inend && outend - outptr >= 4)
+    {
+      uint32_t ch;
+      uint16_t u;
+
+      if (*inptr < 0x80)
+	{
+	  size_t done = gconv_bulk_ascii_to_ucs2 (inptr, outptr,
+						  MIN (inend - inptr,
+						       (outend - outptr) / 2),
+						  swap);
+	  if (done != 0)
+	    {
+	      inptr += done;
+	      outptr += 2 * done;
+	      continue;
+	    }
+	}
+
+      int cnt = utf8_direct_decode (inptr, inend, &ch);
+      if (cnt <= 0 || ch >= 0x110000)
+	break;
+
+      if (ch >= 0x10000)
+	{
+	  u = 0xd7c0 + (ch >> 10);
+	  u = swap ? bswap_16 (u) : u;
+	  memcpy (outptr, &u, sizeof (u));
+	  outptr += 2;
+	  ch = 0xdc00 + (ch & 0x3ff);
+	}
+      u = swap ? bswap_16 (ch) : ch;
+      memcpy (outptr, &u, sizeof (u));
+      outptr += 2;
+      inptr += cnt;
+    }
+
+  if (inptr == *inptrp)
+    return 0;
+  *inptrp = inptr;
+  *outptrp = outptr;
+  return 1;
+}
+
+/* Likewise from UTF-16 to UTF-8, for characters which are not
+   surrogates and correct surrogate pairs.  */
+static inline int
+__attribute ((always_inline))
+utf16_utf8_bulk (const unsigned char **inptrp, const unsigned char *inend,
+		 unsigned char **outptrp, const unsigned char *outend,
+		 int swap)
+{
+  const unsigned char *inptr = *inptrp;
+  unsigned char *outptr = *outptrp;
+
+  while (inend - inptr >= 4 && outend - outptr >= 4)
+    {
+      uint16_t u;
+      uint32_t ch;
+
+      memcpy (&u, inptr, sizeof (u));
+      ch = swap ? bswap_16 (u) : u;
+      if (ch < 0x80)
+	{
+	  size_t done = gconv_bulk_ucs2_to_ascii (inptr, outptr,
+						  MIN ((inend - inptr) / 2,
+						       outend - outptr),
+						  swap);
+	  if (done != 0)
+	    {
+	      inptr += 2 * done;
+	      outptr += done;
+	      continue;
+	    }
+	}
+
+      if (ch >= 0xd800 && ch <= 0xdfff)
+	{
+	  memcpy (&u, inptr + 2, sizeof (u));
+	  u = swap ? bswap_16 (u) : u;
+	  if (ch >= 0xdc00 || u < 0xdc00 || u > 0xdfff)
+	    break;
+	  ch = ((ch - 0xd7c0) << 10) + (u - 0xdc00);
+	  inptr += 2;
+	}
+      outptr = utf8_direct_put (outptr, ch);
+      inptr += 2;
+    }
+
+  if (inptr == *inptrp)
+    return 0;
+  *inptrp = inptr;
+  *outptrp = outptr;
+  return 1;
+}
+
+
+/* Convert from UTF-8 to UTF-16.  */
+#define MIN_NEEDED_INPUT	MIN_NEEDED_TO
+#define MAX_NEEDED_INPUT	MAX_NEEDED_TO
+#define MIN_NEEDED_OUTPUT	MIN_NEEDED_FROM
+#define MAX_NEEDED_OUTPUT	MAX_NEEDED_FROM
+#define LOOPFCT			TO_LOOP
+#define BULK_BODY \
+  {									      \
+    if (utf8_utf16_bulk (&inptr, inend, &outptr, outend, swap))		      \
+      continue;								      \
+  }
+#define BODY \
+  {									      \
+    uint32_t c;								      \
+    int cnt = utf8_direct_decode (inptr, inend, &c);			      \
+									      \
+    if (__glibc_unlikely (cnt <= 0))					      \
+      {									      \
+	if (cnt == 0)							      \
+	  {								      \
+	    /* We don't have enough input for another complete input	      \
+	       character.  */						      \
+	    result = __GCONV_INCOMPLETE_INPUT;				      \
+	    break;							      \
+	  }								      \
+									      \
+	STANDARD_FROM_LOOP_ERR_HANDLER (-cnt);				      \
+      }									      \
+									      \
+    if (__glibc_unlikely (c >= 0x10000))				      \
+      {									      \
+	if (__glibc_unlikely (c >= 0x110000))				      \
+	  {								      \
+	    UTF8_DIRECT_TO_ERR_HANDLER (c, cnt, ucs4_to_utf16_fct);	      \
+	  }								      \
+									      \
+	/* Generate a surrogate character.  */				      \
+	if (__glibc_unlikely (outptr + 4 > outend))			      \
+	  {								      \
+	    /* Overflow in the output buffer.  */			      \
+	    result = __GCONV_FULL_OUTPUT;				      \
+	    break;							      \
+	  }								      \
+									      \
+	uint16_t u1 = 0xd7c0 + (c >> 10);				      \
+	uint16_t u2 = 0xdc00 + (c & 0x3ff);				      \
+	put16 (outptr, swap ? bswap_16 (u1) : u1);			      \
+	outptr += 2;							      \
+	put16 (outptr, swap ? bswap_16 (u2) : u2);			      \
+      }									      \
+    else								      \
+      put16 (outptr, swap ? bswap_16 (c) : c);				      \
+    outptr += 2;							      \
+    inptr += cnt;							      \
+  }
+#define LOOP_NEED_FLAGS
+#define EXTRA_LOOP_DECLS \
+	, int swap
+#include <iconv/loop.c>
+
+
+/* Convert from UTF-16 to UTF-8.  */
+#define MIN_NEEDED_INPUT	MIN_NEEDED_FROM
+#define MAX_NEEDED_INPUT	MAX_NEEDED_FROM
+#define MIN_NEEDED_OUTPUT	MIN_NEEDED_TO
+#define MAX_NEEDED_OUTPUT	MAX_NEEDED_TO
+#define LOOPFCT			FROM_LOOP
+#define BULK_BODY \
+  {									      \
+    if (utf16_utf8_bulk (&inptr, inend, &outptr, outend, swap))		      \
+      continue;								      \
+  }
+#define BODY \
+  {									      \
+    uint32_t c = get16 (inptr);						      \
+    size_t cnt = 2;							      \
+									      \
+    if (swap)								      \
+      c = bswap_16 (c);							      \
+									      \
+    if (__glibc_unlikely (c >= 0xd800 && c <= 0xdfff))			      \
+      {									      \
+	uint16_t u2;							      \
+									      \
+	if (__glibc_unlikely (c >= 0xdc00))				      \
+	  {								      \
+	    /* This is no valid first word for a surrogate.  */		      \
+	    STANDARD_FROM_LOOP_ERR_HANDLER (2);				      \
+	  }								      \
+									      \
+	/* It's a surrogate character.  At least the first word says	      \
+	   it is.  */							      \
+	if (__glibc_unlikely (inptr + 4 > inend))			      \
+	  {								      \
+	    /* We don't have enough input for another complete input	      \
+	       character.  */						      \
+	    result = __GCONV_INCOMPLETE_INPUT;				      \
+	    break;							      \
+	  }								      \
+									      \
+	u2 = get16 (inptr + 2);						      \
+	if (swap)							      \
+	  u2 = bswap_16 (u2);						      \
+	if (__builtin_expect (u2 < 0xdc00, 0)				      \
+	    || __builtin_expect (u2 > 0xdfff, 0))			      \
+	  {								      \
+	    /* This is no valid second word for a surrogate.  */	      \
+	    STANDARD_FROM_LOOP_ERR_HANDLER (2);				      \
+	  }								      \
+									      \
+	c = ((c - 0xd7c0) << 10) + (u2 - 0xdc00);			      \
+	cnt = 4;							      \
+      }									      \
+									      \
+    if (__glibc_unlikely (outptr + utf8_direct_length (c) > outend))	      \
+      {									      \
+	/* Overflow in the output buffer.  */				      \
+	result = __GCONV_FULL_OUTPUT;					      \
+	break;								      \
+      }									      \
+									      \
+    outptr = utf8_direct_put (outptr, c);				      \
+    inptr += cnt;							      \
+  }
+#define LOOP_NEED_FLAGS
+#define EXTRA_LOOP_DECLS \
+	, int swap
+#include <iconv/loop.c>
+
+
+/* Now define the toplevel functions.  */
+#include <iconv/skeleton.c>
@@ -296,6 +296,24 @@ struct link_map
       const ElfW(Sym) *ret;
     } l_lookup_cache;
 
+    /* Position of the object in the global scope plus one while the
+       binding cache is used at startup, otherwise zero.  */
+    unsigned int l_bindcache_idx;
+
+    /* Results of the symbol lookups for the relocation of the object
+       done in advance at startup, see elf/dl-reloc-prefetch.c.  The
+       table has l_prefetched_mask + 1 entries.  */
+    struct prefetched_binding
+    {
+      /* Index of the referencing symbol, zero for an unused entry.  */
+      unsigned int symidx;
+      int type_class;
+      /* The definition, or NULL if the lookup has to be repeated.  */
+      struct link_map *map;
+      const ElfW(Sym) *sym;
+    } *l_prefetched;
+    unsigned int l_prefetched_mask;
+
     /* Thread-local storage related info.  */
 
     /* Start of the initialization image.  */
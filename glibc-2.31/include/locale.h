@@ -3,6 +3,8 @@
 
 #ifndef _ISOMAC
 extern __typeof (uselocale) __uselocale;
+extern __typeof (duplocale) __duplocale;
+extern __typeof (freelocale) __freelocale;
 
 libc_hidden_proto (setlocale)
 libc_hidden_proto (__uselocale)
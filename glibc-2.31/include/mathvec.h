@@ -0,0 +1 @@
+#include <mathvec/mathvec.h>
@@ -66,6 +66,21 @@ extern int __seed48_r (unsigned short int __seed16v[3],
 		       struct drand48_data *__buffer) attribute_hidden;
 extern int __lcong48_r (unsigned short int __param[7],
 			struct drand48_data *__buffer) attribute_hidden;
+extern int __random64_seed_r (struct random64_data *__buf) attribute_hidden;
+extern __typeof (random64_fill_r) __random64_fill_r;
+libc_hidden_proto (__random64_fill_r)
+extern __typeof (random64_fill_double_r) __random64_fill_double_r;
+libc_hidden_proto (__random64_fill_double_r)
+extern __typeof (arc4random) __arc4random;
+libc_hidden_proto (__arc4random)
+extern __typeof (arc4random_buf) __arc4random_buf;
+libc_hidden_proto (__arc4random_buf)
+extern __typeof (arc4random_uniform) __arc4random_uniform;
+libc_hidden_proto (__arc4random_uniform)
+/* Reset the arc4random state of the calling thread in the child after
+   fork, and release it on thread exit.  */
+extern void __arc4random_fork_subprocess (void) attribute_hidden;
+extern void __arc4random_thread_freeres (void) attribute_hidden;
 
 /* Internal function to compute next state of the generator.  */
 extern int __drand48_iterate (unsigned short int __xsubi[3],
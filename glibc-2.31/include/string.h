@@ -62,6 +62,9 @@ void __strerror_thread_freeres (void) attribute_hidden;
 #ifndef _ISOMAC
 extern __typeof (strcoll_l) __strcoll_l;
 extern __typeof (strxfrm_l) __strxfrm_l;
+extern __typeof (strxfrm_array) __strxfrm_array;
+extern __typeof (strxfrm_array_l) __strxfrm_array_l;
+extern __typeof (strxfrm_array_bound_l) __strxfrm_array_bound_l;
 extern __typeof (strcasecmp_l) __strcasecmp_l;
 extern __typeof (strncasecmp_l) __strncasecmp_l;
 
@@ -104,6 +107,8 @@ libc_hidden_proto (__basename)
 libc_hidden_proto (strcoll)
 libc_hidden_proto (__strcoll_l)
 libc_hidden_proto (__strxfrm_l)
+libc_hidden_proto (__strxfrm_array_l)
+libc_hidden_proto (__strxfrm_array_bound_l)
 libc_hidden_proto (__strtok_r)
 extern char *__strsep_g (char **__stringp, const char *__delim);
 libc_hidden_proto (__strsep_g)
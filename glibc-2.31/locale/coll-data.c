@@ -0,0 +1,268 @@
+/* Data computed from LC_COLLATE for strcoll and strxfrm.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <libc-lock.h>
+#include "localeinfo.h"
+
+/* Used if there is no memory for the data: the ASCII characters need
+   the full collation algorithm and the size of the results of strxfrm
+   is not known.  */
+static const struct lc_collate_data unknown;
+
+__libc_rwlock_define (extern, __libc_setlocale_lock attribute_hidden)
+
+
+/* Fill the weights of the ASCII characters in DATA from the tables of
+   CURRENT, which has NRULES levels.  Return false if they cannot be
+   used.  */
+static bool
+fill_ascii (struct lc_collate_ascii *data,
+	    const struct __locale_data *current, uint_fast32_t nrules)
+{
+  const unsigned char *rulesets = (const unsigned char *)
+    current->values[_NL_ITEM_INDEX (_NL_COLLATE_RULESETS)].string;
+  const int32_t *table = (const int32_t *)
+    current->values[_NL_ITEM_INDEX (_NL_COLLATE_TABLEMB)].string;
+  const unsigned char *weights = (const unsigned char *)
+    current->values[_NL_ITEM_INDEX (_NL_COLLATE_WEIGHTMB)].string;
+
+  if (nrules > COLL_ASCII_MAXRULES)
+    return false;
+
+  /* The NUL byte ends the strings and has no weights.  */
+  data->rule[0] = 0;
+  for (uint_fast32_t pass = 0; pass < nrules; ++pass)
+    {
+      data->len[pass][0] = 0;
+      data->idx[pass][0] = 0;
+    }
+
+  for (int ch = 1; ch < 0x80; ++ch)
+    {
+      /* A negative value means that a contraction or a multibyte
+	 character starts with the byte.  */
+      int32_t i = table[ch];
+      if (i < 0)
+	return false;
+
+      unsigned char rule = i >> 24;
+      int32_t idx = i & 0xffffff;
+      for (uint_fast32_t pass = 0; pass < nrules; ++pass)
+	{
+	  int flags = rulesets[rule * nrules + pass];
+	  if ((flags & sort_forward) == 0 || (flags & sort_backward) != 0)
+	    return false;
+
+	  data->len[pass][ch] = weights[idx++];
+	  data->idx[pass][ch] = idx;
+	  idx += data->len[pass][ch];
+	}
+      data->rule[ch] = rule;
+    }
+
+  data->usable = 1;
+  return true;
+}
+
+
+/* Bounds of the multibyte collation tables, and what has been found in
+   them so far.  */
+struct xfrm_scan
+{
+  uint_fast32_t nrules;
+  const unsigned char *weights;
+  const unsigned char *weights_end;
+  size_t factor;
+  int maxrule;
+};
+
+/* Account for the collating element of NBYTES bytes whose weights and
+   rule are given by the value IDX from the tables.  Return false if
+   IDX lies outside of the weights.  */
+static bool
+scan_element (struct xfrm_scan *scan, size_t nbytes, int32_t idx)
+{
+  const unsigned char *cp = scan->weights + (idx & 0xffffff);
+  size_t total = 0;
+
+  for (uint_fast32_t pass = 0; pass < scan->nrules; ++pass)
+    {
+      if (cp >= scan->weights_end)
+	return false;
+      total += *cp;
+      cp += 1 + *cp;
+    }
+
+  total = (total + nbytes - 1) / nbytes;
+  if (total > scan->factor)
+    scan->factor = total;
+  if ((idx >> 24) > scan->maxrule)
+    scan->maxrule = idx >> 24;
+  return true;
+}
+
+/* Return an upper bound of the number of bytes strxfrm stores for each
+   byte of a string in CURRENT, which has NRULES levels, besides the
+   level separators, or zero if the tables do not have the expected
+   layout.
+
+   Each collating element, which has at least one byte, contributes
+   its weights at each level.  At a level with `position' it also
+   contributes the UTF-8 encoding of the number of characters since
+   the last element with weights, which is never longer than that
+   number, so all of them together are not longer than the string.  */
+static size_t
+xfrm_factor (const struct __locale_data *current, uint_fast32_t nrules)
+{
+  const unsigned char *rulesets = (const unsigned char *)
+    current->values[_NL_ITEM_INDEX (_NL_COLLATE_RULESETS)].string;
+  const int32_t *table = (const int32_t *)
+    current->values[_NL_ITEM_INDEX (_NL_COLLATE_TABLEMB)].string;
+  const unsigned char *weights = (const unsigned char *)
+    current->values[_NL_ITEM_INDEX (_NL_COLLATE_WEIGHTMB)].string;
+  const unsigned char *extra = (const unsigned char *)
+    current->values[_NL_ITEM_INDEX (_NL_COLLATE_EXTRAMB)].string;
+  const int32_t *indirect = (const int32_t *)
+    current->values[_NL_ITEM_INDEX (_NL_COLLATE_INDIRECTMB)].string;
+  const char *end = current->filedata + current->filesize;
+
+  /* localedef stores the weights, the extra table and the indirect
+     table one after the other, so each one ends where the next one
+     starts.  */
+  if (! (weights < extra && extra <= (const unsigned char *) indirect
+	 && (const char *) indirect <= end))
+    return 0;
+
+  struct xfrm_scan scan =
+    {
+      .nrules = nrules,
+      .weights = weights,
+      .weights_end = extra,
+      .factor = 0,
+      .maxrule = 0
+    };
+
+  for (int ch = 1; ch < 256; ++ch)
+    {
+      int32_t i = table[ch];
+      if (i >= 0)
+	{
+	  if (!scan_element (&scan, 1, i))
+	    return 0;
+	  continue;
+	}
+
+      /* Walk the list of sequences starting with the byte, up to the
+	 entry for the single byte which ends it, as findidx does.  */
+      const unsigned char *cp = extra - i;
+      while (1)
+	{
+	  if (cp + sizeof (int32_t) + 1 > (const unsigned char *) indirect)
+	    return 0;
+	  i = *(const int32_t *) cp;
+	  cp += sizeof (int32_t);
+	  size_t nhere = *cp++;
+
+	  if (i >= 0)
+	    {
+	      if (!scan_element (&scan, 1 + nhere, i))
+		return 0;
+	      if (nhere == 0)
+		break;
+
+	      cp += nhere;
+	      if (!LOCFILE_ALIGNED_P (1 + nhere))
+		cp += LOCFILE_ALIGN - (1 + nhere) % LOCFILE_ALIGN;
+	    }
+	  else
+	    {
+	      /* A range of sequences which differ in their last byte.  */
+	      if (nhere == 0
+		  || cp + 2 * nhere > (const unsigned char *) indirect
+		  || cp[2 * nhere - 1] < cp[nhere - 1])
+		return 0;
+	      size_t count = cp[2 * nhere - 1] - cp[nhere - 1] + 1;
+	      if ((const char *) (indirect - i + count) > end)
+		return 0;
+	      for (size_t k = 0; k < count; ++k)
+		if (!scan_element (&scan, 1 + nhere, indirect[-i + k]))
+		  return 0;
+
+	      cp += 2 * nhere;
+	      if (!LOCFILE_ALIGNED_P (1 + 2 * nhere))
+		cp += LOCFILE_ALIGN - (1 + 2 * nhere) % LOCFILE_ALIGN;
+	    }
+	}
+    }
+
+  /* Add a byte per character for each level which has `position' in
+     one of the rules.  */
+  for (uint_fast32_t pass = 0; pass < nrules; ++pass)
+    for (int rule = 0; rule <= scan.maxrule; ++rule)
+      if ((rulesets[rule * nrules + pass] & sort_position) != 0)
+	{
+	  ++scan.factor;
+	  break;
+	}
+
+  return scan.factor;
+}
+
+
+void
+_nl_load_collate_data (struct __locale_data *current)
+{
+  __libc_rwlock_wrlock (__libc_setlocale_lock);
+
+  if (current->private.collate == NULL)
+    {
+      const struct lc_collate_data *result = &unknown;
+      uint_fast32_t nrules =
+	current->values[_NL_ITEM_INDEX (_NL_COLLATE_NRULES)].word;
+
+      struct lc_collate_data *data = calloc (1, sizeof *data);
+      if (data != NULL)
+	{
+	  fill_ascii (&data->ascii, current, nrules);
+	  data->xfrm_factor = xfrm_factor (current, nrules);
+	  result = data;
+	}
+
+      current->private.collate = result;
+      current->private.cleanup = &_nl_cleanup_collate;
+    }
+
+  __libc_rwlock_unlock (__libc_setlocale_lock);
+}
+
+
+void
+_nl_cleanup_collate (struct __locale_data *locale)
+{
+  const struct lc_collate_data *const data = locale->private.collate;
+  if (data != NULL)
+    {
+      locale->private.collate = NULL;
+      locale->private.cleanup = NULL;
+
+      if (data != &unknown)
+	free ((struct lc_collate_data *) data);
+    }
+}
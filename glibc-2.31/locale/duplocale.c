@@ -19,6 +19,7 @@
 
 #include <locale.h>
 #include <libc-lock.h>
+#include <stdbool.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -43,11 +44,20 @@ __duplocale (locale_t dataset)
   locale_t result;
   int cnt;
   size_t names_len = 0;
+  /* The lock is needed to read the global locale and to change the
+     usage counts, but a copy of another locale with only permanent
+     data, such as that from the locale archive, changes no count.  */
+  bool need_lock = dataset == &_nl_global_locale;
 
   /* Calculate the total space we need to store all the names.  */
   for (cnt = 0; cnt < __LC_LAST; ++cnt)
-    if (cnt != LC_ALL && dataset->__names[cnt] != _nl_C_name)
-      names_len += strlen (dataset->__names[cnt]) + 1;
+    if (cnt != LC_ALL)
+      {
+	if (dataset->__names[cnt] != _nl_C_name)
+	  names_len += strlen (dataset->__names[cnt]) + 1;
+	if (!_nl_locale_data_permanent (dataset->__locales[cnt], cnt))
+	  need_lock = true;
+      }
 
   /* Get memory.  */
   result = malloc (sizeof (struct __locale_struct) + names_len);
@@ -57,7 +67,8 @@ __duplocale (locale_t dataset)
       char *namep = (char *) (result + 1);
 
       /* We modify global data (the usage counts).  */
-      __libc_rwlock_wrlock (__libc_setlocale_lock);
+      if (need_lock)
+	__libc_rwlock_wrlock (__libc_setlocale_lock);
 
       for (cnt = 0; cnt < __LC_LAST; ++cnt)
 	if (cnt != LC_ALL)
@@ -81,7 +92,8 @@ __duplocale (locale_t dataset)
       result->__ctype_toupper = dataset->__ctype_toupper;
 
       /* It's done.  */
-      __libc_rwlock_unlock (__libc_setlocale_lock);
+      if (need_lock)
+	__libc_rwlock_unlock (__libc_setlocale_lock);
     }
 
   return result;
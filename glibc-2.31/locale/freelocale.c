@@ -37,16 +37,27 @@ __freelocale (locale_t dataset)
   if (dataset == _nl_C_locobj_ptr)
     return;
 
-  /* We modify global data (the usage counts).  */
-  __libc_rwlock_wrlock (__libc_setlocale_lock);
-
+  /* A locale with only permanent data, such as that from the locale
+     archive, has no usage counts to change.  */
   for (cnt = 0; cnt < __LC_LAST; ++cnt)
-    if (cnt != LC_ALL && dataset->__locales[cnt]->usage_count != UNDELETABLE)
-      /* We can remove the data.  */
-      _nl_remove_locale (cnt, dataset->__locales[cnt]);
+    if (cnt != LC_ALL
+	&& !_nl_locale_data_permanent (dataset->__locales[cnt], cnt))
+      break;
+
+  if (cnt < __LC_LAST)
+    {
+      /* We modify global data (the usage counts).  */
+      __libc_rwlock_wrlock (__libc_setlocale_lock);
+
+      for (cnt = 0; cnt < __LC_LAST; ++cnt)
+	if (cnt != LC_ALL
+	    && dataset->__locales[cnt]->usage_count != UNDELETABLE)
+	  /* We can remove the data.  */
+	  _nl_remove_locale (cnt, dataset->__locales[cnt]);
 
-  /* It's done.  */
-  __libc_rwlock_unlock (__libc_setlocale_lock);
+      /* It's done.  */
+      __libc_rwlock_unlock (__libc_setlocale_lock);
+    }
 
   /* Free the locale_t handle itself.  */
   free (dataset);
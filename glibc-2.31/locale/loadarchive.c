@@ -80,12 +80,22 @@ static struct archmapped *archmapped;
 static struct archmapped headmap;
 static struct stat64 archive_stat; /* stat of archive when header mapped.  */
 
-/* Record of locales that we have already loaded from the archive.  */
+/* Record of locales that we have already found in the archive.  The
+   data of a category is only internalized when it is first asked for,
+   as many programs use only a few of the categories of a locale.  */
 struct locale_in_archive
 {
   struct locale_in_archive *next;
   char *name;
+  /* The categories whose data has been internalized.  */
+  unsigned int loaded;
   struct __locale_data *data[__LC_LAST];
+  /* Where the data of each category is mapped.  */
+  struct
+  {
+    const void *addr;
+    size_t len;
+  } files[__LC_LAST];
 };
 static struct locale_in_archive *archloaded;
 
@@ -124,6 +134,42 @@ calculate_head_size (const struct locarhead *h)
 }
 
 
+/* Return the internalized data of CATEGORY of LIA, internalizing it
+   if that has not been done yet.  */
+static struct __locale_data *
+archive_category (struct locale_in_archive *lia, int category)
+{
+  if ((lia->loaded & (1 << category)) == 0)
+    {
+      struct __locale_data *data
+	= _nl_intern_locale_data (category, lia->files[category].addr,
+				  lia->files[category].len);
+      if (__glibc_likely (data != NULL))
+	{
+	  /* _nl_intern_locale_data leaves us these fields to initialize.  */
+	  data->alloc = ld_archive;
+	  data->name = lia->name;
+
+	  /* We do this instead of bumping the count each time we return
+	     this data because the mappings stay around forever anyway
+	     and we might as well hold on to a little more memory and not
+	     have to rebuild it on the next lookup of the same thing.
+	     If we were to maintain the usage_count normally and let the
+	     structures be freed, we would have to remove the elements
+	     from archloaded too.  */
+	  data->usage_count = UNDELETABLE;
+	}
+
+      /* If the data is bogus, the null pointer is kept so that it is
+	 not examined again.  */
+      lia->data[category] = data;
+      lia->loaded |= 1 << category;
+    }
+
+  return lia->data[category];
+}
+
+
 /* Find the locale *NAMEP in the locale archive, and return the
    internalized data structure for its CATEGORY data.  If this locale has
    already been loaded from the archive, just returns the existing data
@@ -139,6 +185,7 @@ _nl_load_locale_from_archive (int category, const char **namep)
     size_t len;
   } results[__LC_LAST];
   struct locale_in_archive *lia;
+  struct locale_in_archive **liap;
   struct locarhead *head;
   struct namehashent *namehashtab;
   struct locrecent *locrec;
@@ -155,12 +202,19 @@ _nl_load_locale_from_archive (int category, const char **namep)
 
   /* Check if we have already loaded this locale from the archive.
      If we previously loaded the locale but found bogons in the data,
-     then we will have stored a null pointer to return here.  */
-  for (lia = archloaded; lia != NULL; lia = lia->next)
+     then we will have stored a null pointer to return here.  The
+     locale found is moved to the front of the list, as programs
+     switching between many locales tend to ask for the categories of
+     one locale after the other.  */
+  for (liap = &archloaded; (lia = *liap) != NULL; liap = &lia->next)
     if (name == lia->name || !strcmp (name, lia->name))
       {
+	*liap = lia->next;
+	lia->next = archloaded;
+	archloaded = lia;
+
 	*namep = lia->name;
-	return lia->data[category];
+	return archive_category (lia, category);
       }
 
   {
@@ -455,9 +509,9 @@ _nl_load_locale_from_archive (int category, const char **namep)
   fd = -1;
 
   /* We succeeded in mapping all the necessary regions of the archive.
-     Now we need the expected data structures to point into the data.  */
+     The data of the categories is internalized when it is needed.  */
 
-  lia = malloc (sizeof *lia);
+  lia = calloc (1, sizeof *lia);
   if (__glibc_unlikely (lia == NULL))
     return NULL;
 
@@ -474,28 +528,12 @@ _nl_load_locale_from_archive (int category, const char **namep)
   for (cnt = 0; cnt < __LC_LAST; ++cnt)
     if (cnt != LC_ALL)
       {
-	lia->data[cnt] = _nl_intern_locale_data (cnt,
-						 results[cnt].addr,
-						 results[cnt].len);
-	if (__glibc_likely (lia->data[cnt] != NULL))
-	  {
-	    /* _nl_intern_locale_data leaves us these fields to initialize.  */
-	    lia->data[cnt]->alloc = ld_archive;
-	    lia->data[cnt]->name = lia->name;
-
-	    /* We do this instead of bumping the count each time we return
-	       this data because the mappings stay around forever anyway
-	       and we might as well hold on to a little more memory and not
-	       have to rebuild it on the next lookup of the same thing.
-	       If we were to maintain the usage_count normally and let the
-	       structures be freed, we would have to remove the elements
-	       from archloaded too.  */
-	    lia->data[cnt]->usage_count = UNDELETABLE;
-	  }
+	lia->files[cnt].addr = results[cnt].addr;
+	lia->files[cnt].len = results[cnt].len;
       }
 
   *namep = lia->name;
-  return lia->data[category];
+  return archive_category (lia, category);
 }
 
 void __libc_freeres_fn_section
@@ -69,6 +69,7 @@ struct __locale_data
       void *data;
       struct lc_time_data *time;
       const struct gconv_fcts *ctype;
+      const struct lc_collate_data *collate;
     };
   } private;
 
@@ -167,6 +168,39 @@ struct lc_time_data
 };
 
 
+/* Maximum number of levels of the locales for which the weights of
+   the ASCII characters are precomputed.  */
+#define COLL_ASCII_MAXRULES 4
+
+/* The weights of the ASCII characters from LC_COLLATE.  */
+struct lc_collate_ascii
+{
+  /* Nonzero if each ASCII character is a collating element of its own
+     which is sorted forward at all levels, so that the tables below
+     can replace the lookups of the multibyte collation tables.  */
+  int usable;
+
+  /* The rule of each character.  */
+  unsigned char rule[128];
+  /* The number of weights of each character at each level, and the
+     index of the first one in the multibyte weight table.  */
+  unsigned char len[COLL_ASCII_MAXRULES][128];
+  int32_t idx[COLL_ASCII_MAXRULES][128];
+};
+
+/* Structure caching computed data about information from LC_COLLATE.
+   The `private.collate' member of `struct __locale_data' points to this.  */
+struct lc_collate_data
+{
+  struct lc_collate_ascii ascii;
+
+  /* An upper bound of the number of bytes strxfrm stores for each byte
+     of a string, besides the level separators and the null byte, or
+     zero if it is not known.  */
+  size_t xfrm_factor;
+};
+
+
 /* LC_CTYPE specific:
    Hardwired indices for standard wide character translation mappings.  */
 enum
@@ -355,6 +389,16 @@ extern void _nl_unload_locale (struct __locale_data *locale) attribute_hidden;
 extern void _nl_remove_locale (int locale, struct __locale_data *data)
      attribute_hidden;
 
+/* Return nonzero if DATA, the data of CATEGORY in a locale in use, is
+   never unloaded, which is the case for the data of the C locale and
+   the data from the locale archive.  Its usage count is UNDELETABLE
+   from the start, so this needs no lock.  */
+static inline int
+_nl_locale_data_permanent (const struct __locale_data *data, int category)
+{
+  return data->alloc == ld_archive || data == _nl_C_locobj.__locales[category];
+}
+
 /* Find the locale *NAMEP in the locale archive, and return the
    internalized data structure for its CATEGORY data.  If this locale has
    already been loaded from the archive, just returns the existing data
@@ -409,8 +453,23 @@ extern int _nl_parse_alt_digit (const char **strp,
 /* Postload processing.  */
 extern void _nl_postload_ctype (void);
 
+/* Compute the cached data for LC_COLLATE.  */
+extern void _nl_load_collate_data (struct __locale_data *lc_collate)
+     attribute_hidden;
+
+/* Return the cached data for LC_COLLATE, which must have at least one
+   rule.  */
+static inline const struct lc_collate_data *
+_nl_get_collate_data (struct __locale_data *lc_collate)
+{
+  if (__glibc_unlikely (lc_collate->private.collate == NULL))
+    _nl_load_collate_data (lc_collate);
+  return lc_collate->private.collate;
+}
+
 /* Functions used for the `private.cleanup' hook.  */
 extern void _nl_cleanup_time (struct __locale_data *) attribute_hidden;
+extern void _nl_cleanup_collate (struct __locale_data *) attribute_hidden;
 
 
 #endif	/* localeinfo.h */
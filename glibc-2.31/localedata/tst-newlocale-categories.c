@@ -0,0 +1,133 @@
+/* Test newlocale with single categories and duplocale in threads.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+/* Locales from the archive have the data of each category read when
+   it is first asked for, and are copied and freed without the locale
+   lock.  Check that locales built one category at a time have the
+   right data, also while other threads copy and create locales.  */
+
+#include <langinfo.h>
+#include <locale.h>
+#include <string.h>
+
+#include <support/check.h>
+#include <support/xthread.h>
+
+#define NTHREADS 8
+
+/* An item of each category, whose value in the locales tested is not
+   that of the C locale.  */
+static const struct
+{
+  int category;
+  int mask;
+  nl_item item;
+} items[] =
+  {
+    { LC_CTYPE, LC_CTYPE_MASK, CODESET },
+    { LC_NUMERIC, LC_NUMERIC_MASK, RADIXCHAR },
+    { LC_TIME, LC_TIME_MASK, DAY_1 },
+    { LC_MONETARY, LC_MONETARY_MASK, CRNCYSTR },
+    { LC_MESSAGES, LC_MESSAGES_MASK, YESEXPR },
+  };
+
+static const char *const locales[] =
+  { "de_DE.UTF-8", "fr_FR.UTF-8", "ja_JP.EUC-JP" };
+
+static locale_t c_locale;
+
+/* Check that L has the data of FULL for the categories in MASK and
+   that of the C locale for the others.  */
+static void
+check_items (locale_t l, int mask, locale_t full)
+{
+  for (size_t i = 0; i < sizeof (items) / sizeof (items[0]); ++i)
+    {
+      locale_t expected = (mask & items[i].mask) != 0 ? full : c_locale;
+      TEST_COMPARE_STRING (nl_langinfo_l (items[i].item, l),
+			   nl_langinfo_l (items[i].item, expected));
+    }
+}
+
+static void *
+thread_func (void *closure)
+{
+  locale_t full = closure;
+  for (int i = 0; i < 1000; ++i)
+    {
+      locale_t copy = duplocale (full);
+      TEST_VERIFY_EXIT (copy != (locale_t) 0);
+      check_items (copy, LC_ALL_MASK, full);
+      freelocale (copy);
+
+      size_t n = i % (sizeof (locales) / sizeof (locales[0]));
+      locale_t l = newlocale (items[i % 5].mask, locales[n], (locale_t) 0);
+      TEST_VERIFY_EXIT (l != (locale_t) 0);
+      freelocale (l);
+    }
+  return NULL;
+}
+
+static int
+do_test (void)
+{
+  c_locale = newlocale (LC_ALL_MASK, "C", (locale_t) 0);
+  TEST_VERIFY_EXIT (c_locale != (locale_t) 0);
+
+  for (size_t n = 0; n < sizeof (locales) / sizeof (locales[0]); ++n)
+    {
+      /* Each category on its own, before the others were asked for.  */
+      locale_t single[sizeof (items) / sizeof (items[0])];
+      for (size_t i = 0; i < sizeof (items) / sizeof (items[0]); ++i)
+	{
+	  single[i] = newlocale (items[i].mask, locales[n], (locale_t) 0);
+	  TEST_VERIFY_EXIT (single[i] != (locale_t) 0);
+	}
+
+      locale_t full = newlocale (LC_ALL_MASK, locales[n], (locale_t) 0);
+      TEST_VERIFY_EXIT (full != (locale_t) 0);
+      for (size_t i = 0; i < sizeof (items) / sizeof (items[0]); ++i)
+	check_items (single[i], items[i].mask, full);
+
+      /* The categories added one at a time.  */
+      locale_t l = (locale_t) 0;
+      int mask = 0;
+      for (size_t i = 0; i < sizeof (items) / sizeof (items[0]); ++i)
+	{
+	  mask |= items[i].mask;
+	  l = newlocale (items[i].mask, locales[n], l);
+	  TEST_VERIFY_EXIT (l != (locale_t) 0);
+	  check_items (l, mask, full);
+	}
+      freelocale (l);
+
+      pthread_t threads[NTHREADS];
+      for (int i = 0; i < NTHREADS; ++i)
+	threads[i] = xpthread_create (NULL, thread_func, full);
+      for (int i = 0; i < NTHREADS; ++i)
+	xpthread_join (threads[i]);
+
+      for (size_t i = 0; i < sizeof (items) / sizeof (items[0]); ++i)
+	freelocale (single[i]);
+      freelocale (full);
+    }
+
+  return 0;
+}
+
+#include <support/test-driver.c>
@@ -20,6 +20,7 @@
 #include <malloc-internal.h>
 #include <resolv/resolv-internal.h>
 #include <rpc/rpc.h>
+#include <stdlib.h>
 #include <string.h>
 
 /* Thread shutdown function.  Note that this function must be called
@@ -32,6 +33,7 @@ __libc_thread_freeres (void)
   call_function_static_weak (__rpc_thread_destroy);
   call_function_static_weak (__res_thread_freeres);
   call_function_static_weak (__strerror_thread_freeres);
+  call_function_static_weak (__arc4random_thread_freeres);
 
   /* This should come last because it shuts down malloc for this
      thread and the other shutdown functions might well call free.  */
@@ -0,0 +1,81 @@
+/* Math functions applied to arrays.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#ifndef	_MATHVEC_H
+#define	_MATHVEC_H	1
+
+#include <features.h>
+
+#define	__need_size_t
+#include <stddef.h>
+
+__BEGIN_DECLS
+
+/* Each function stores FUNC (IN[I]), or FUNC (X[I], Y[I]), in OUT[I]
+   for I from 0 to N - 1, using the vector variants of FUNC in libmvec
+   for the widest vector unit of the processor.  The results are the
+   ones of the vector variants, within a few ulps of the scalar
+   function and only accurate in round-to-nearest mode.  OUT may be the
+   same array as an input, but must not overlap it otherwise.  No
+   alignment is required.  */
+
+extern void vsin (double *__out, const double *__in, size_t __n) __THROW;
+extern void vcos (double *__out, const double *__in, size_t __n) __THROW;
+extern void vtan (double *__out, const double *__in, size_t __n) __THROW;
+extern void vatan (double *__out, const double *__in, size_t __n) __THROW;
+extern void vatan2 (double *__out, const double *__y, const double *__x,
+		     size_t __n) __THROW;
+extern void vexp (double *__out, const double *__in, size_t __n) __THROW;
+extern void vexp2 (double *__out, const double *__in, size_t __n) __THROW;
+extern void vexpm1 (double *__out, const double *__in, size_t __n) __THROW;
+extern void vlog (double *__out, const double *__in, size_t __n) __THROW;
+extern void vlog2 (double *__out, const double *__in, size_t __n) __THROW;
+extern void vlog10 (double *__out, const double *__in, size_t __n) __THROW;
+extern void vlog1p (double *__out, const double *__in, size_t __n) __THROW;
+extern void vsinh (double *__out, const double *__in, size_t __n) __THROW;
+extern void vcosh (double *__out, const double *__in, size_t __n) __THROW;
+extern void vtanh (double *__out, const double *__in, size_t __n) __THROW;
+extern void vcbrt (double *__out, const double *__in, size_t __n) __THROW;
+extern void verf (double *__out, const double *__in, size_t __n) __THROW;
+extern void vpow (double *__out, const double *__x, const double *__y,
+		  size_t __n) __THROW;
+
+extern void vsinf (float *__out, const float *__in, size_t __n) __THROW;
+extern void vcosf (float *__out, const float *__in, size_t __n) __THROW;
+extern void vtanf (float *__out, const float *__in, size_t __n) __THROW;
+extern void vatanf (float *__out, const float *__in, size_t __n) __THROW;
+extern void vatan2f (float *__out, const float *__y, const float *__x,
+		    size_t __n) __THROW;
+extern void vexpf (float *__out, const float *__in, size_t __n) __THROW;
+extern void vexp2f (float *__out, const float *__in, size_t __n) __THROW;
+extern void vexpm1f (float *__out, const float *__in, size_t __n) __THROW;
+extern void vlogf (float *__out, const float *__in, size_t __n) __THROW;
+extern void vlog2f (float *__out, const float *__in, size_t __n) __THROW;
+extern void vlog10f (float *__out, const float *__in, size_t __n) __THROW;
+extern void vlog1pf (float *__out, const float *__in, size_t __n) __THROW;
+extern void vsinhf (float *__out, const float *__in, size_t __n) __THROW;
+extern void vcoshf (float *__out, const float *__in, size_t __n) __THROW;
+extern void vtanhf (float *__out, const float *__in, size_t __n) __THROW;
+extern void vcbrtf (float *__out, const float *__in, size_t __n) __THROW;
+extern void verff (float *__out, const float *__in, size_t __n) __THROW;
+extern void vpowf (float *__out, const float *__x, const float *__y,
+		   size_t __n) __THROW;
+
+__END_DECLS
+
+#endif /* mathvec.h */
@@ -0,0 +1,244 @@
+/* Sort an array using several threads.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/sysinfo.h>
+#include "pthreadP.h"
+
+/* The array is cut into one run per thread and the runs are sorted
+   concurrently with qsort_r.  The sorted runs are then merged pairwise
+   into a scratch array of the same size, going back and forth between
+   the two, until a single run is left.  Each merge round is split into
+   about one piece of equal output size per thread, using a binary
+   search for the split points (the "merge path"), so that all threads
+   stay busy up to the last round.  */
+
+/* Arrays with fewer elements are sorted with qsort_r in the calling
+   thread, as thread creation would dominate.  */
+#define PARALLEL_THRESHOLD 65536
+
+/* Upper bound on the number of threads, which also bounds the number
+   of tasks per phase.  */
+#define MAX_THREADS 256
+
+struct sort_param
+{
+  size_t size;
+  __compar_d_fn_t cmp;
+  void *arg;
+};
+
+/* One unit of work: either sort NA elements at A, or produce the output
+   elements [K_BEGIN, K_END) of the merge of runs A and B into OUT.  */
+struct sort_task
+{
+  const struct sort_param *p;
+  char *a;
+  size_t na;
+  char *b;
+  size_t nb;
+  char *out;
+  size_t k_begin;
+  size_t k_end;
+};
+
+/* Return the number of elements of A among the first K elements of the
+   merge of A and B.  On ties, elements of A go first.  */
+static size_t
+merge_split (const struct sort_param *p, const char *a, size_t na,
+	     const char *b, size_t nb, size_t k)
+{
+  size_t lo = k > nb ? k - nb : 0;
+  size_t hi = k < na ? k : na;
+  while (lo < hi)
+    {
+      size_t i = lo + (hi - lo) / 2;
+      size_t j = k - i;
+      if (p->cmp (a + i * p->size, b + (j - 1) * p->size, p->arg) <= 0)
+	lo = i + 1;
+      else
+	hi = i;
+    }
+  return lo;
+}
+
+static void
+merge_task (const struct sort_task *t)
+{
+  const struct sort_param *p = t->p;
+  const size_t size = p->size;
+  size_t i = merge_split (p, t->a, t->na, t->b, t->nb, t->k_begin);
+  size_t j = t->k_begin - i;
+  size_t i_end = merge_split (p, t->a, t->na, t->b, t->nb, t->k_end);
+  size_t j_end = t->k_end - i_end;
+  const char *a = t->a + i * size;
+  const char *b = t->b + j * size;
+  char *out = t->out + t->k_begin * size;
+
+  while (i < i_end && j < j_end)
+    {
+      if (p->cmp (a, b, p->arg) <= 0)
+	{
+	  out = __mempcpy (out, a, size);
+	  a += size;
+	  i++;
+	}
+      else
+	{
+	  out = __mempcpy (out, b, size);
+	  b += size;
+	  j++;
+	}
+    }
+  out = __mempcpy (out, a, (i_end - i) * size);
+  memcpy (out, b, (j_end - j) * size);
+}
+
+static void *
+sort_worker (void *closure)
+{
+  struct sort_task *t = closure;
+  if (t->b == NULL)
+    qsort_r (t->a, t->na, t->p->size, t->p->cmp, t->p->arg);
+  else
+    merge_task (t);
+  return NULL;
+}
+
+/* Run the NTASKS tasks at TASKS, one per thread.  The first task runs
+   in the calling thread, and so do the tasks for which no thread could
+   be created.  */
+static void
+run_tasks (struct sort_task *tasks, size_t ntasks)
+{
+  pthread_t threads[MAX_THREADS];
+  bool started[MAX_THREADS];
+
+  /* The tasks are on the stack of the calling thread, so it must not
+     be cancelled, in __pthread_join or in the comparison function,
+     before all threads have been joined.  */
+  int oldstate;
+  __pthread_setcancelstate (PTHREAD_CANCEL_DISABLE, &oldstate);
+
+  for (size_t i = 1; i < ntasks; i++)
+    started[i] = __pthread_create_2_1 (&threads[i], NULL, sort_worker,
+				       &tasks[i]) == 0;
+
+  sort_worker (&tasks[0]);
+
+  for (size_t i = 1; i < ntasks; i++)
+    if (started[i])
+      __pthread_join (threads[i], NULL);
+    else
+      sort_worker (&tasks[i]);
+
+  __pthread_setcancelstate (oldstate, NULL);
+}
+
+void
+pthread_qsort_np (void *base, size_t nmemb, size_t size,
+		  __compar_d_fn_t cmp, void *arg, unsigned int nthreads)
+{
+  if (nthreads == 0)
+    nthreads = get_nprocs ();
+  if (nthreads > MAX_THREADS)
+    nthreads = MAX_THREADS;
+  if (nthreads > nmemb / (PARALLEL_THRESHOLD / 2))
+    nthreads = nmemb / (PARALLEL_THRESHOLD / 2);
+
+  char *tmp = NULL;
+  if (nthreads > 1 && nmemb >= PARALLEL_THRESHOLD
+      && size <= SIZE_MAX / nmemb)
+    {
+      int save = errno;
+      tmp = malloc (nmemb * size);
+      __set_errno (save);
+    }
+  if (tmp == NULL)
+    {
+      qsort_r (base, nmemb, size, cmp, arg);
+      return;
+    }
+
+  const struct sort_param p = { .size = size, .cmp = cmp, .arg = arg };
+  struct sort_task tasks[MAX_THREADS];
+
+  /* The runs are described by their start offsets, in elements.  */
+  size_t runs[MAX_THREADS + 1];
+  size_t nruns = nthreads;
+  for (size_t r = 0; r <= nruns; r++)
+    runs[r] = (nmemb / nruns) * r + (r < nmemb % nruns ? r : nmemb % nruns);
+
+  for (size_t r = 0; r < nruns; r++)
+    tasks[r] = (struct sort_task)
+      {
+	.p = &p,
+	.a = (char *) base + runs[r] * size,
+	.na = runs[r + 1] - runs[r]
+      };
+  run_tasks (tasks, nruns);
+
+  char *src = base;
+  char *dst = tmp;
+  while (nruns > 1)
+    {
+      size_t npairs = (nruns + 1) / 2;
+      size_t pieces = nthreads / npairs;
+      if (pieces == 0)
+	pieces = 1;
+
+      size_t ntasks = 0;
+      for (size_t r = 0; r < nruns; r += 2)
+	{
+	  size_t na = runs[r + 1] - runs[r];
+	  size_t nb = r + 1 < nruns ? runs[r + 2] - runs[r + 1] : 0;
+	  size_t n = na + nb;
+	  for (size_t k = 0; k < pieces; k++)
+	    tasks[ntasks++] = (struct sort_task)
+	      {
+		.p = &p,
+		.a = src + runs[r] * size,
+		.na = na,
+		.b = src + (runs[r] + na) * size,
+		.nb = nb,
+		.out = dst + runs[r] * size,
+		.k_begin = n / pieces * k,
+		.k_end = k + 1 == pieces ? n : n / pieces * (k + 1)
+	      };
+	}
+      run_tasks (tasks, ntasks);
+
+      /* Every other run boundary disappears.  */
+      size_t nr = 0;
+      for (size_t r = 0; r < nruns; r += 2)
+	runs[nr++] = runs[r];
+      runs[nr] = nmemb;
+      nruns = nr;
+
+      char *t = src;
+      src = dst;
+      dst = t;
+    }
+
+  if (src != base)
+    memcpy (base, src, nmemb * size);
+  free (tmp);
+}
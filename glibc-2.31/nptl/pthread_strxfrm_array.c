@@ -0,0 +1,188 @@
+/* Transform arrays of strings into sort keys using several threads.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <locale.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/sysinfo.h>
+#include "pthreadP.h"
+
+/* The strings are cut into one run per thread.  Each run gets a region
+   of KEYS as large as strxfrm_array_bound says its keys can be, the
+   threads transform their runs into their regions concurrently, and
+   the keys are then moved down to follow each other.  */
+
+/* Arrays with fewer strings are transformed in the calling thread, as
+   thread creation would dominate.  */
+#define PARALLEL_THRESHOLD 16384
+
+/* Upper bound on the number of threads.  */
+#define MAX_THREADS 256
+
+struct xfrm_task
+{
+  /* The locale of the calling thread, as an object.  */
+  locale_t locale;
+  const char *const *srcs;
+  size_t n;
+  size_t *offsets;
+  char *keys;
+  size_t size;
+  /* The size of the keys of the run.  */
+  size_t used;
+};
+
+static void *
+xfrm_worker (void *closure)
+{
+  struct xfrm_task *t = closure;
+
+  /* This is strxfrm_array, but the offset after the last key is not
+     stored, as that is the first offset of the next run.  */
+  size_t used = 0;
+  size_t room = t->size;
+  for (size_t i = 0; i < t->n; ++i)
+    {
+      size_t len = __strxfrm_l (room != 0 ? t->keys + used : NULL,
+				t->srcs[i], room, t->locale);
+      if (len < room)
+	room -= len + 1;
+      else
+	room = 0;
+
+      t->offsets[i] = used;
+      used += len + 1;
+    }
+
+  t->used = used;
+  return NULL;
+}
+
+/* Transform the keys with the threads described by the first NTHREADS
+   tasks.  Return false if they have to be redone in one piece.  */
+static bool
+run_tasks (struct xfrm_task *tasks, size_t nthreads)
+{
+  pthread_t threads[MAX_THREADS];
+  bool started[MAX_THREADS];
+
+  /* The tasks are on the stack of the calling thread, so it must not
+     be cancelled in __pthread_join before all threads have been
+     joined.  */
+  int oldstate;
+  __pthread_setcancelstate (PTHREAD_CANCEL_DISABLE, &oldstate);
+
+  for (size_t r = 1; r < nthreads; r++)
+    started[r] = __pthread_create_2_1 (&threads[r], NULL, xfrm_worker,
+				       &tasks[r]) == 0;
+
+  xfrm_worker (&tasks[0]);
+
+  for (size_t r = 1; r < nthreads; r++)
+    if (started[r])
+      __pthread_join (threads[r], NULL);
+    else
+      xfrm_worker (&tasks[r]);
+
+  __pthread_setcancelstate (oldstate, NULL);
+
+  /* The bound is not expected to be too small, but if it was the keys
+     are redone in one piece.  */
+  for (size_t r = 0; r < nthreads; r++)
+    if (tasks[r].used > tasks[r].size)
+      return false;
+  return true;
+}
+
+size_t
+pthread_strxfrm_array_np (char *keys, size_t size, const char *const *srcs,
+			  size_t n, size_t *offsets, unsigned int nthreads)
+{
+  if (nthreads == 0)
+    nthreads = get_nprocs ();
+  if (nthreads > MAX_THREADS)
+    nthreads = MAX_THREADS;
+  if (nthreads > n / (PARALLEL_THRESHOLD / 2))
+    nthreads = n / (PARALLEL_THRESHOLD / 2);
+  if (nthreads <= 1)
+    return __strxfrm_array (keys, size, srcs, n, offsets);
+
+  /* The threads use the locale of the calling thread, which the _l
+     functions need as an object.  */
+  locale_t locale = __uselocale ((locale_t) 0);
+  locale_t copy = (locale_t) 0;
+  if (locale == LC_GLOBAL_LOCALE)
+    {
+      copy = __duplocale (locale);
+      if (copy == (locale_t) 0)
+	return __strxfrm_array (keys, size, srcs, n, offsets);
+      locale = copy;
+    }
+
+  struct xfrm_task tasks[MAX_THREADS];
+  size_t start = 0;
+  size_t total = 0;
+  bool done = true;
+  for (size_t r = 0; r < nthreads; r++)
+    {
+      size_t count = n / nthreads + (r < n % nthreads);
+      size_t bound = __strxfrm_array_bound_l (srcs + start, count, locale);
+
+      /* If the regions do not fit the keys may not fit either, and
+	 only the calling thread can tell where they stop.  */
+      if (bound > size - total)
+	{
+	  done = false;
+	  break;
+	}
+
+      tasks[r] = (struct xfrm_task)
+	{
+	  .locale = locale,
+	  .srcs = srcs + start,
+	  .n = count,
+	  .offsets = offsets + start,
+	  .keys = keys + total,
+	  .size = bound
+	};
+      start += count;
+      total += bound;
+    }
+
+  if (done)
+    done = run_tasks (tasks, nthreads);
+  if (copy != (locale_t) 0)
+    __freelocale (copy);
+  if (!done)
+    return __strxfrm_array (keys, size, srcs, n, offsets);
+
+  size_t used = 0;
+  for (size_t r = 0; r < nthreads; r++)
+    {
+      if (r > 0)
+	{
+	  memmove (keys + used, tasks[r].keys, tasks[r].used);
+	  for (size_t i = 0; i < tasks[r].n; ++i)
+	    tasks[r].offsets[i] += used;
+	}
+      used += tasks[r].used;
+    }
+
+  offsets[n] = used;
+  return used;
+}
@@ -0,0 +1,87 @@
+/* Test pthread_qsort_np.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <support/check.h>
+#include <support/support.h>
+
+/* The comparison function gets the element size as argument, to check
+   that it is passed along to every thread.  */
+static int
+compare (const void *a, const void *b, void *arg)
+{
+  TEST_VERIFY_EXIT (arg != NULL);
+  size_t size = *(const size_t *) arg;
+  int r = memcmp (a, b, sizeof (uint32_t));
+  if (r != 0)
+    return r;
+  /* Break ties on the rest of the element, so that the result is
+     unique and can be compared against qsort_r.  */
+  return memcmp (a, b, size);
+}
+
+static void
+do_one_test (size_t nmemb, size_t size, unsigned int nthreads,
+	     unsigned int distinct)
+{
+  unsigned char *array = xmalloc (nmemb * size + 1);
+  unsigned char *expected = xmalloc (nmemb * size + 1);
+
+  for (size_t i = 0; i < nmemb * size; i++)
+    array[i] = random () % distinct;
+  memcpy (expected, array, nmemb * size);
+
+  qsort_r (expected, nmemb, size, compare, &size);
+  pthread_qsort_np (array, nmemb, size, compare, &size, nthreads);
+
+  if (memcmp (array, expected, nmemb * size) != 0)
+    {
+      support_record_failure ();
+      printf ("error: %zu x %zu, %u threads: result differs from qsort_r\n",
+	      nmemb, size, nthreads);
+    }
+
+  free (expected);
+  free (array);
+}
+
+static int
+do_test (void)
+{
+  static const size_t nmembs[] = { 0, 1, 1000, 65535, 65536, 200003 };
+  static const size_t sizes[] = { 4, 8, 24 };
+  static const unsigned int threads[] = { 0, 1, 2, 3, 4, 7, 16 };
+
+  for (size_t n = 0; n < sizeof (nmembs) / sizeof (nmembs[0]); n++)
+    for (size_t s = 0; s < sizeof (sizes) / sizeof (sizes[0]); s++)
+      for (size_t t = 0; t < sizeof (threads) / sizeof (threads[0]); t++)
+	{
+	  do_one_test (nmembs[n], sizes[s], threads[t], 256);
+	  /* Many duplicates.  */
+	  do_one_test (nmembs[n], sizes[s], threads[t], 2);
+	}
+
+  return 0;
+}
+
+#define TIMEOUT 60
+#include <support/test-driver.c>
@@ -0,0 +1,108 @@
+/* Test pthread_strxfrm_array_np.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <locale.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <support/check.h>
+#include <support/support.h>
+
+#define MAXLEN 30
+
+/* Compare the keys from NTHREADS threads for the N strings at SRCS with
+   those of strxfrm_array, with enough room and with less.  */
+static void
+check (const char *const *srcs, size_t n, unsigned int nthreads)
+{
+  size_t bound = strxfrm_array_bound (srcs, n);
+  char *expected = xmalloc (bound);
+  char *keys = xmalloc (bound);
+  size_t *expected_offsets = xmalloc ((n + 1) * sizeof (size_t));
+  size_t *offsets = xmalloc ((n + 1) * sizeof (size_t));
+
+  size_t total = strxfrm_array (expected, bound, srcs, n, expected_offsets);
+  TEST_COMPARE (pthread_strxfrm_array_np (keys, bound, srcs, n, offsets,
+					  nthreads), total);
+  TEST_COMPARE_BLOB (offsets, (n + 1) * sizeof (size_t), expected_offsets,
+		     (n + 1) * sizeof (size_t));
+  TEST_COMPARE_BLOB (keys, total, expected, total);
+
+  /* Exactly the room the keys need, which is usually less than the
+     bound and so done by the calling thread.  */
+  memset (keys, '\0', bound);
+  TEST_COMPARE (pthread_strxfrm_array_np (keys, total, srcs, n, offsets,
+					  nthreads), total);
+  TEST_COMPARE_BLOB (keys, total, expected, total);
+
+  /* Too little room.  */
+  TEST_COMPARE (pthread_strxfrm_array_np (keys, total / 2, srcs, n, offsets,
+					  nthreads), total);
+  TEST_COMPARE_BLOB (offsets, (n + 1) * sizeof (size_t), expected_offsets,
+		     (n + 1) * sizeof (size_t));
+
+  free (offsets);
+  free (expected_offsets);
+  free (keys);
+  free (expected);
+}
+
+static int
+do_test (void)
+{
+  static const char chars[] = "aAbBcChHzZ09 -.,\xc3\xa9\xc3\x85\xc3\x9f\xff";
+  const size_t n = 100000;
+  char *text = xmalloc (n * (MAXLEN + 1));
+  const char **srcs = xmalloc (n * sizeof (char *));
+
+  srandom (1);
+  for (size_t i = 0; i < n; ++i)
+    {
+      char *s = text + i * (MAXLEN + 1);
+      size_t len = random () % MAXLEN;
+      for (size_t j = 0; j < len; ++j)
+	s[j] = chars[random () % (sizeof (chars) - 1)];
+      s[len] = '\0';
+      srcs[i] = s;
+    }
+
+  if (setlocale (LC_ALL, "de_DE.UTF-8") == NULL)
+    FAIL_EXIT1 ("setlocale (LC_ALL, \"de_DE.UTF-8\") failed");
+
+  static const size_t counts[] = { 0, 1, 100, 16383, 16384, 50000, 100000 };
+  static const unsigned int threads[] = { 0, 1, 2, 3, 8, 300 };
+  for (size_t c = 0; c < sizeof (counts) / sizeof (counts[0]); ++c)
+    for (size_t t = 0; t < sizeof (threads) / sizeof (threads[0]); ++t)
+      check (srcs, counts[c], threads[t]);
+
+  /* The worker threads use the locale of the calling thread, not the
+     global one.  */
+  setlocale (LC_ALL, "C");
+  locale_t loc = newlocale (LC_ALL_MASK, "cs_CZ.UTF-8", (locale_t) 0);
+  TEST_VERIFY_EXIT (loc != (locale_t) 0);
+  uselocale (loc);
+  check (srcs, n, 4);
+  uselocale (LC_GLOBAL_LOCALE);
+  freelocale (loc);
+
+  free (srcs);
+  free (text);
+  return 0;
+}
+
+#include <support/test-driver.c>
@@ -0,0 +1,238 @@
+/* Pseudo-random number generator based on ChaCha20.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <array_length.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <not-cancel.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/param.h>
+#include "chacha20.h"
+
+/* Every thread has its own generator, so that no locking is needed.
+   The generator produces CHACHA20_BUFSIZE bytes of keystream at a time.
+   The first CHACHA20_KEY_SIZE bytes replace the key and the rest is
+   handed out and cleared as it is used, so that neither the state nor
+   the buffer allow reconstructing earlier output ("fast key erasure").
+   The key is mixed with fresh kernel entropy when the generator is
+   created, after fork, and every ARC4RANDOM_RESEED_SIZE bytes.  */
+
+#define ARC4RANDOM_RESEED_SIZE (16 * 1024 * 1024)
+
+/* Requests of at least this size are written directly to the caller's
+   buffer, in pieces of at most ARC4RANDOM_BULK_SIZE bytes, after each of
+   which the key is replaced.  */
+#define ARC4RANDOM_BULK_SIZE (64 * 1024)
+
+struct arc4random_state
+{
+  uint32_t key[CHACHA20_KEY_SIZE / sizeof (uint32_t)];
+  /* Number of unused bytes at the end of BUF.  */
+  size_t have;
+  /* Number of bytes to produce before the next reseed.  */
+  size_t count;
+  uint8_t buf[CHACHA20_BUFSIZE];
+};
+
+static __thread struct arc4random_state *arc4random_state
+  attribute_tls_model_ie;
+
+/* Fill P with N bytes of kernel entropy.  */
+static void
+arc4random_getentropy (void *p, size_t n)
+{
+  char *buf = p;
+  int save = errno;
+
+  while (n > 0)
+    {
+      ssize_t r = __getrandom_nocancel (buf, n, 0);
+      if (r > 0)
+	{
+	  buf += r;
+	  n -= r;
+	}
+      else if (r < 0 && errno == EINTR)
+	continue;
+      else
+	break;
+    }
+
+  /* Fall back to the device if the system call is not available.  */
+  if (n > 0)
+    {
+      int fd = __open64_nocancel ("/dev/urandom", O_RDONLY | O_CLOEXEC);
+      if (fd >= 0)
+	{
+	  while (n > 0)
+	    {
+	      ssize_t r = __read_nocancel (fd, buf, n);
+	      if (r > 0)
+		{
+		  buf += r;
+		  n -= r;
+		}
+	      else if (r < 0 && errno == EINTR)
+		continue;
+	      else
+		break;
+	    }
+	  __close_nocancel_nostatus (fd);
+	}
+    }
+
+  if (n > 0)
+    __libc_fatal ("Fatal glibc error: cannot get entropy for arc4random\n");
+
+  __set_errno (save);
+}
+
+/* Produce the next buffer of keystream and replace the key.  */
+static void
+arc4random_refill (struct arc4random_state *state)
+{
+  if (state->count == 0)
+    {
+      uint32_t entropy[CHACHA20_KEY_SIZE / sizeof (uint32_t)];
+      arc4random_getentropy (entropy, sizeof (entropy));
+      for (size_t i = 0; i < array_length (entropy); i++)
+	state->key[i] ^= entropy[i];
+      explicit_bzero (entropy, sizeof (entropy));
+      state->count = ARC4RANDOM_RESEED_SIZE;
+    }
+
+  __chacha20_blocks (state->buf, state->key, 0);
+  memcpy (state->key, state->buf, CHACHA20_KEY_SIZE);
+  memset (state->buf, 0, CHACHA20_KEY_SIZE);
+  state->have = CHACHA20_BUFSIZE - CHACHA20_KEY_SIZE;
+  state->count -= MIN (state->count, state->have);
+}
+
+/* Return the state of the calling thread, or NULL if it could not be
+   allocated.  */
+static struct arc4random_state *
+arc4random_get_state (void)
+{
+  struct arc4random_state *state = arc4random_state;
+  if (__glibc_likely (state != NULL))
+    return state;
+
+  int save = errno;
+  state = malloc (sizeof (*state));
+  __set_errno (save);
+  if (state == NULL)
+    return NULL;
+
+  memset (state->key, 0, sizeof (state->key));
+  state->have = 0;
+  state->count = 0;
+  arc4random_state = state;
+  return state;
+}
+
+void
+__arc4random_buf (void *p, size_t n)
+{
+  struct arc4random_state *state = arc4random_get_state ();
+  if (__glibc_unlikely (state == NULL))
+    {
+      /* Without memory for the state, fall back to the kernel.  */
+      arc4random_getentropy (p, n);
+      return;
+    }
+
+  uint8_t *buf = p;
+  while (n > 0)
+    {
+      if (state->have > 0)
+	{
+	  size_t m = MIN (n, state->have);
+	  uint8_t *src = state->buf + CHACHA20_BUFSIZE - state->have;
+	  buf = __mempcpy (buf, src, m);
+	  memset (src, 0, m);
+	  state->have -= m;
+	  n -= m;
+	}
+      else if (n >= CHACHA20_BUFSIZE && state->count != 0)
+	{
+	  /* Block numbers 0 to CHACHA20_LANES - 1 are used by the next
+	     refill, which replaces the key before anything else is
+	     produced.  A new state, and the state after fork, has no
+	     count left, so the refill below seeds the key before it is
+	     used here.  */
+	  size_t m = MIN (n, ARC4RANDOM_BULK_SIZE);
+	  m -= m % CHACHA20_BUFSIZE;
+	  for (uint64_t counter = CHACHA20_LANES;
+	       counter < CHACHA20_LANES + m / CHACHA20_BLOCK_SIZE;
+	       counter += CHACHA20_LANES)
+	    {
+	      __chacha20_blocks (buf, state->key, counter);
+	      buf += CHACHA20_BUFSIZE;
+	    }
+	  n -= m;
+	  state->count -= MIN (state->count, m);
+	  arc4random_refill (state);
+	}
+      else
+	arc4random_refill (state);
+    }
+}
+libc_hidden_def (__arc4random_buf)
+weak_alias (__arc4random_buf, arc4random_buf)
+
+uint32_t
+__arc4random (void)
+{
+  uint32_t r;
+  __arc4random_buf (&r, sizeof (r));
+  return r;
+}
+libc_hidden_def (__arc4random)
+weak_alias (__arc4random, arc4random)
+
+/* Called in the child after fork.  Only the calling thread survives,
+   and its generator must not repeat the output of the parent.  */
+void
+__arc4random_fork_subprocess (void)
+{
+  struct arc4random_state *state = arc4random_state;
+  if (state != NULL)
+    {
+      /* The next request reseeds the key with entropy only, so the
+	 child does not share the keystream of the parent.  */
+      explicit_bzero (state->key, sizeof (state->key));
+      explicit_bzero (state->buf, sizeof (state->buf));
+      state->have = 0;
+      state->count = 0;
+    }
+}
+
+/* Called on thread exit.  */
+void
+__arc4random_thread_freeres (void)
+{
+  struct arc4random_state *state = arc4random_state;
+  if (state != NULL)
+    {
+      explicit_bzero (state, sizeof (*state));
+      free (state);
+      arc4random_state = NULL;
+    }
+}
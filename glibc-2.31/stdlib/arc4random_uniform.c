@@ -0,0 +1,48 @@
+/* Random number in a range based on arc4random.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <stdint.h>
+#include <stdlib.h>
+
+/* Return a uniformly distributed number in [0, N), using the method of
+   Daniel Lemire, Fast Random Integer Generation in an Interval, ACM
+   TOMACS 29 (2019): the high half of the 64-bit product of a random
+   number and N is uniform once the products whose low half falls below
+   2^32 mod N are rejected.  The division is only needed in the rare
+   case that a rejection is possible.  */
+uint32_t
+__arc4random_uniform (uint32_t n)
+{
+  if (n <= 1)
+    return 0;
+
+  uint64_t m = (uint64_t) __arc4random () * n;
+  uint32_t l = m;
+  if (l < n)
+    {
+      uint32_t t = -n % n;
+      while (l < t)
+	{
+	  m = (uint64_t) __arc4random () * n;
+	  l = m;
+	}
+    }
+  return m >> 32;
+}
+libc_hidden_def (__arc4random_uniform)
+weak_alias (__arc4random_uniform, arc4random_uniform)
@@ -0,0 +1,64 @@
+/* Branch-free lower bound search for the bsearch variants.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#ifndef _BSEARCH_LB_H
+#define _BSEARCH_LB_H
+
+#include <stddef.h>
+#include <stdlib.h>
+
+/* The search keeps a window of N elements starting at BASE that
+   contains the lower bound of the key, and halves it at every step by
+   moving BASE to the middle if the middle element is smaller than the
+   key.  The window size sequence does not depend on the comparison
+   results, so the only data dependent operation is the selection of
+   the new BASE, which compilers turn into a conditional move.
+
+   Both possible middle elements of the next step are prefetched, so
+   the memory access of the next step overlaps with the current
+   comparison.  */
+
+static __always_inline const char *
+bsearch_lb_step (const void *key, const char *base, size_t half,
+		 size_t next_half, size_t size, __compar_fn_t compar)
+{
+  const char *mid = base + half * size;
+  __builtin_prefetch (base + next_half * size);
+  __builtin_prefetch (mid + next_half * size);
+  return compar (key, mid) > 0 ? mid : base;
+}
+
+/* Return the first element of the sorted array of NMEMB elements at
+   BASE that compares equal to KEY, or NULL.  */
+static __always_inline void *
+bsearch_lb_finish (const void *key, const char *base, const char *p,
+		   size_t nmemb, size_t size, __compar_fn_t compar)
+{
+  int c = compar (key, p);
+  if (c == 0)
+    return (void *) p;
+  if (c < 0)
+    return NULL;
+  /* The lower bound is the element following P.  */
+  p += size;
+  if (p < base + nmemb * size && compar (key, p) == 0)
+    return (void *) p;
+  return NULL;
+}
+
+#endif /* bsearch-lb.h */
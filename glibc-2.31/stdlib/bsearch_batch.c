@@ -0,0 +1,73 @@
+/* Binary search for many keys at once.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <stdlib.h>
+#include "bsearch-lb.h"
+
+/* Number of keys searched in lockstep.  The branch-free search visits
+   the same number of levels for every key, so the searches of a group
+   can be interleaved level by level.  The prefetches issued for one key
+   then complete while the other keys of the group are compared, which
+   hides most of the cache miss latency on large tables.  */
+#define BATCH_SIZE 16
+
+size_t
+bsearch_batch (const void *keys, size_t nkeys, size_t keysize,
+	       const void *base, size_t nmemb, size_t size,
+	       __compar_fn_t compar, void **results)
+{
+  const char *key = keys;
+  size_t found = 0;
+
+  if (nmemb == 0)
+    {
+      for (size_t i = 0; i < nkeys; i++)
+	results[i] = NULL;
+      return 0;
+    }
+
+  for (size_t i = 0; i < nkeys; i += BATCH_SIZE)
+    {
+      const char *p[BATCH_SIZE];
+      size_t batch = nkeys - i < BATCH_SIZE ? nkeys - i : BATCH_SIZE;
+
+      for (size_t j = 0; j < batch; j++)
+	p[j] = base;
+
+      size_t n = nmemb;
+      while (n > 1)
+	{
+	  size_t half = n / 2;
+	  n -= half;
+	  for (size_t j = 0; j < batch; j++)
+	    p[j] = bsearch_lb_step (key + j * keysize, p[j], half, n / 2,
+				    size, compar);
+	}
+
+      for (size_t j = 0; j < batch; j++)
+	{
+	  results[i + j] = bsearch_lb_finish (key + j * keysize, base, p[j],
+					      nmemb, size, compar);
+	  found += results[i + j] != NULL;
+	}
+
+      key += batch * keysize;
+    }
+
+  return found;
+}
@@ -0,0 +1,39 @@
+/* Branch-free binary search returning the first match.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <stdlib.h>
+#include "bsearch-lb.h"
+
+void *
+bsearch_first (const void *key, const void *base, size_t nmemb, size_t size,
+	       __compar_fn_t compar)
+{
+  if (nmemb == 0)
+    return NULL;
+
+  const char *p = base;
+  size_t n = nmemb;
+  while (n > 1)
+    {
+      size_t half = n / 2;
+      n -= half;
+      p = bsearch_lb_step (key, p, half, n / 2, size, compar);
+    }
+
+  return bsearch_lb_finish (key, base, p, nmemb, size, compar);
+}
@@ -0,0 +1,108 @@
+/* ChaCha20 block function for arc4random.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <endian.h>
+#include <stdint.h>
+#include <string.h>
+#include "chacha20.h"
+
+#ifndef CHACHA20_BLOCKS
+# define CHACHA20_BLOCKS __chacha20_blocks
+#endif
+
+/* The state of all blocks is kept in structure of arrays form: each
+   state word is a vector holding that word for every block, so every
+   operation of the rounds is a single vector operation.  The generic
+   vector extensions are lowered to SSE2 or AVX2 instructions as
+   available.  See D. J. Bernstein, ChaCha, a variant of Salsa20 (2008),
+   and RFC 8439 for the test vectors.  */
+
+typedef uint32_t vec_t __attribute__ ((vector_size (CHACHA20_LANES * 4)));
+
+/* A macro rather than a function, as passing 32-byte vectors by value
+   changes the ABI depending on whether AVX is enabled.  */
+#define ROTL(x, k) (((x) << (k)) | ((x) >> (32 - (k))))
+
+static __always_inline void
+quarter_round (vec_t x[16], int a, int b, int c, int d)
+{
+  x[a] += x[b];
+  x[d] ^= x[a];
+  x[d] = ROTL (x[d], 16);
+  x[c] += x[d];
+  x[b] ^= x[c];
+  x[b] = ROTL (x[b], 12);
+  x[a] += x[b];
+  x[d] ^= x[a];
+  x[d] = ROTL (x[d], 8);
+  x[c] += x[d];
+  x[b] ^= x[c];
+  x[b] = ROTL (x[b], 7);
+}
+
+void
+CHACHA20_BLOCKS (uint8_t *dst, const uint32_t *key, uint64_t counter)
+{
+  /* "expand 32-byte k".  */
+  static const uint32_t constants[4] =
+    {
+      0x61707865, 0x3320646e, 0x79622d32, 0x6b206574
+    };
+  vec_t in[16];
+  vec_t x[16];
+
+  for (int w = 0; w < 4; w++)
+    in[w] = constants[w] - (vec_t) { };
+  for (int w = 0; w < 8; w++)
+    in[4 + w] = key[w] - (vec_t) { };
+  for (int l = 0; l < CHACHA20_LANES; l++)
+    {
+      in[12][l] = (uint32_t) (counter + l);
+      in[13][l] = (uint32_t) ((counter + l) >> 32);
+    }
+  in[14] = in[15] = (vec_t) { };
+
+  for (int w = 0; w < 16; w++)
+    x[w] = in[w];
+
+  for (int i = 0; i < 10; i++)
+    {
+      quarter_round (x, 0, 4, 8, 12);
+      quarter_round (x, 1, 5, 9, 13);
+      quarter_round (x, 2, 6, 10, 14);
+      quarter_round (x, 3, 7, 11, 15);
+      quarter_round (x, 0, 5, 10, 15);
+      quarter_round (x, 1, 6, 11, 12);
+      quarter_round (x, 2, 7, 8, 13);
+      quarter_round (x, 3, 4, 9, 14);
+    }
+
+  for (int w = 0; w < 16; w++)
+    x[w] += in[w];
+
+  /* Transpose the words to the block layout.  */
+  for (int l = 0; l < CHACHA20_LANES; l++)
+    for (int w = 0; w < 16; w++)
+      {
+	uint32_t v = x[w][l];
+#if __BYTE_ORDER == __BIG_ENDIAN
+	v = __builtin_bswap32 (v);
+#endif
+	memcpy (dst + l * CHACHA20_BLOCK_SIZE + w * 4, &v, sizeof (v));
+      }
+}
@@ -0,0 +1,40 @@
+/* ChaCha20 block function for arc4random.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#ifndef _CHACHA20_H
+#define _CHACHA20_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Number of 64-byte blocks computed by one call of __chacha20_blocks.
+   The blocks are computed in parallel, one per 32-bit vector lane of an
+   AVX2 register.  */
+#define CHACHA20_LANES 8
+#define CHACHA20_BLOCK_SIZE 64
+#define CHACHA20_BUFSIZE (CHACHA20_LANES * CHACHA20_BLOCK_SIZE)
+#define CHACHA20_KEY_SIZE 32
+
+/* Store the CHACHA20_LANES consecutive ChaCha20 keystream blocks for
+   KEY and the block numbers COUNTER, COUNTER + 1, ... to DST.  The
+   nonce is zero, and the 64-bit block number uses words 12 and 13 of
+   the state as in the original ChaCha definition.  */
+extern void __chacha20_blocks (uint8_t *dst, const uint32_t *key,
+			       uint64_t counter) attribute_hidden;
+
+#endif /* chacha20.h */
@@ -0,0 +1,83 @@
+/* Search tables stored in Eytzinger (breadth-first) order.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* The Eytzinger layout stores an implicit binary search tree: the root
+   is element 1 and the children of element K are 2K and 2K + 1, where
+   element K is at index K - 1 of the array.  The first levels of the
+   tree share a few cache lines, and the descendants of an element
+   several levels down are adjacent, so they can be prefetched with a
+   single request.  See: Paul-Virak Khuong and Pat Morin, Array Layouts
+   for Comparison-Based Searching, ACM JEA 22 (2017).  */
+
+/* Number of levels below the current node whose descendants are
+   prefetched.  The 16 descendants four levels down are adjacent.  */
+#define PREFETCH_LEVELS 4
+
+/* Copy the sorted elements starting at index I of SRC to the subtree
+   rooted at K of DST, in order.  Return the index of the next element
+   of SRC.  The recursion depth is the height of the tree.  */
+static size_t
+layout_subtree (char *dst, const char *src, size_t i, size_t k,
+		size_t nmemb, size_t size)
+{
+  if (k <= nmemb)
+    {
+      i = layout_subtree (dst, src, i, 2 * k, nmemb, size);
+      memcpy (dst + (k - 1) * size, src + i * size, size);
+      i = layout_subtree (dst, src, i + 1, 2 * k + 1, nmemb, size);
+    }
+  return i;
+}
+
+void
+eytzinger_layout (void *dst, const void *src, size_t nmemb, size_t size)
+{
+  layout_subtree (dst, src, 0, 1, nmemb, size);
+}
+
+void *
+eytzinger_search (const void *key, const void *base, size_t nmemb,
+		  size_t size, __compar_fn_t compar)
+{
+  const char *b = base;
+  size_t k = 1;
+
+  /* Walk down the tree without branching on the comparison result:
+     every step appends the direction taken to the bits of K.  */
+  while (k <= nmemb)
+    {
+      size_t d = k << PREFETCH_LEVELS;
+      if (d <= nmemb)
+	__builtin_prefetch (b + (d - 1) * size);
+      k = 2 * k + (compar (key, b + (k - 1) * size) > 0);
+    }
+
+  /* The last left turn was at the lower bound of KEY: strip the right
+     turns taken after it and the left turn itself.  K is zero if all
+     the elements are smaller than KEY.  */
+  k >>= __builtin_ctzl (~k) + 1;
+  if (k == 0)
+    return NULL;
+
+  const char *p = b + (k - 1) * size;
+  return compar (key, p) == 0 ? (void *) p : NULL;
+}
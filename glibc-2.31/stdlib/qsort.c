@@ -18,232 +18,564 @@
 
 /* If you consider tuning this algorithm, you should consult first:
    Engineering a sort function; Jon Bentley and M. Douglas McIlroy;
-   Software - Practice and Experience; Vol. 23 (11), 1249-1265, 1993.  */
+   Software - Practice and Experience; Vol. 23 (11), 1249-1265, 1993,
+   and Pattern-defeating Quicksort; Orson R. L. Peters; 2021
+   (arXiv:2106.05123).  The block partitioning scheme follows
+   BlockQuicksort: Avoiding Branch Mispredictions in Quicksort; Stefan
+   Edelkamp and Armin Weiss; ESA 2016.  */
 
-#include <alloca.h>
 #include <limits.h>
+#include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
-/* Byte-wise swap two items of size SIZE. */
-#define SWAP(a, b, size)						      \
-  do									      \
-    {									      \
-      size_t __size = (size);						      \
-      char *__a = (a), *__b = (b);					      \
-      do								      \
-	{								      \
-	  char __tmp = *__a;						      \
-	  *__a++ = *__b;						      \
-	  *__b++ = __tmp;						      \
-	} while (--__size > 0);						      \
-    } while (0)
-
-/* Discontinue quicksort algorithm when partition gets below this size.
-   This particular magic number was chosen to work best on a Sun 4/260. */
-#define MAX_THRESH 4
+/* Swap SIZE bytes between addresses A and B.  The word sized variants
+   are used when the element size and the array base allow it, which
+   covers the common int, long, double and pointer cases as well as
+   16 byte records such as (key, payload) pairs.  */
+
+enum swap_type_t
+  {
+    SWAP_WORDS_32,
+    SWAP_WORDS_64,
+    SWAP_WORDS_128,
+    SWAP_BYTES
+  };
+
+typedef uint32_t __attribute__ ((__may_alias__)) u32_alias_t;
+typedef uint64_t __attribute__ ((__may_alias__)) u64_alias_t;
+
+static void
+swap_bytes (void *a, void *b, size_t n)
+{
+  /* Use multiple small memcpys with constant size to enable inlining
+     on most targets.  */
+  enum { SWAP_GENERIC_SIZE = 32 };
+  unsigned char tmp[SWAP_GENERIC_SIZE];
+  while (n > SWAP_GENERIC_SIZE)
+    {
+      memcpy (tmp, a, SWAP_GENERIC_SIZE);
+      a = __mempcpy (a, b, SWAP_GENERIC_SIZE);
+      b = __mempcpy (b, tmp, SWAP_GENERIC_SIZE);
+      n -= SWAP_GENERIC_SIZE;
+    }
+  while (n > 0)
+    {
+      unsigned char t = ((unsigned char *) a)[--n];
+      ((unsigned char *) a)[n] = ((unsigned char *) b)[n];
+      ((unsigned char *) b)[n] = t;
+    }
+}
+
+static inline __attribute__ ((always_inline)) void
+do_swap (void *a, void *b, size_t size, enum swap_type_t swap_type)
+{
+  if (swap_type == SWAP_WORDS_64)
+    {
+      uint64_t t = *(u64_alias_t *) a;
+      *(u64_alias_t *) a = *(u64_alias_t *) b;
+      *(u64_alias_t *) b = t;
+    }
+  else if (swap_type == SWAP_WORDS_32)
+    {
+      uint32_t t = *(u32_alias_t *) a;
+      *(u32_alias_t *) a = *(u32_alias_t *) b;
+      *(u32_alias_t *) b = t;
+    }
+  else if (swap_type == SWAP_WORDS_128)
+    {
+      uint64_t t0 = ((u64_alias_t *) a)[0];
+      uint64_t t1 = ((u64_alias_t *) a)[1];
+      ((u64_alias_t *) a)[0] = ((u64_alias_t *) b)[0];
+      ((u64_alias_t *) a)[1] = ((u64_alias_t *) b)[1];
+      ((u64_alias_t *) b)[0] = t0;
+      ((u64_alias_t *) b)[1] = t1;
+    }
+  else
+    swap_bytes (a, b, size);
+}
+
+/* Return true if elements can be copied using word loads and stores.
+   The SIZE and BASE must be a multiple of the ALIGN.  */
+static inline bool
+is_aligned (const void *base, size_t size, size_t align)
+{
+  return (((uintptr_t) base | size) & (align - 1)) == 0;
+}
+
+static enum swap_type_t
+get_swap_type (void *const pbase, size_t size)
+{
+  if (size == sizeof (uint32_t)
+      && is_aligned (pbase, size, __alignof__ (uint32_t)))
+    return SWAP_WORDS_32;
+  if (size == sizeof (uint64_t)
+      && is_aligned (pbase, size, __alignof__ (uint64_t)))
+    return SWAP_WORDS_64;
+  if (size == 2 * sizeof (uint64_t)
+      && is_aligned (pbase, size, __alignof__ (uint64_t)))
+    return SWAP_WORDS_128;
+  return SWAP_BYTES;
+}
+
+/* Partitions below this size are sorted with insertion sort.  */
+#define INSERTION_SORT_THRESHOLD 24
+
+/* Partitions above this size use the pseudomedian of nine as pivot.  */
+#define NINTHER_THRESHOLD 128
+
+/* Give up on the optimistic insertion sort of an already partitioned
+   range once it has moved this many elements.  */
+#define PARTIAL_INSERTION_SORT_LIMIT 8
+
+/* Number of elements classified per block by the branchless partition.
+   Offsets are stored in unsigned char, so it must not exceed 255.  */
+#define BLOCK_SIZE 64
+
+/* The parameters that stay constant during the whole sort.  */
+struct sort_param
+{
+  size_t size;
+  enum swap_type_t swap_type;
+  __compar_d_fn_t cmp;
+  void *arg;
+};
+
+#define CMP(p, a, b) ((p)->cmp ((void *) (a), (void *) (b), (p)->arg))
+#define SWAP(p, a, b) do_swap ((a), (b), (p)->size, (p)->swap_type)
+#define ELEM(p, base, i) ((base) + (i) * (p)->size)
 
 /* Stack node declarations used to store unfulfilled partition obligations. */
 typedef struct
   {
     char *lo;
-    char *hi;
+    size_t n;
+    unsigned int bad_allowed;
+    bool leftmost;
   } stack_node;
 
-/* The next 4 #defines implement a very fast in-line stack abstraction. */
-/* The stack needs log (total_elements) entries (we could even subtract
-   log(MAX_THRESH)).  Since total_elements has type size_t, we get as
-   upper bound for log (total_elements):
+/* The stack needs log (total_elements) entries, since the smaller
+   partition is always processed first.  Since total_elements has type
+   size_t, we get as upper bound for log (total_elements):
    bits per byte (CHAR_BIT) * sizeof(size_t).  */
 #define STACK_SIZE	(CHAR_BIT * sizeof (size_t))
-#define PUSH(low, high)	((void) ((top->lo = (low)), (top->hi = (high)), ++top))
-#define	POP(low, high)	((void) (--top, (low = top->lo), (high = top->hi)))
+#define PUSH(low, num, bad, left)					      \
+  ((void) ((top->lo = (low)), (top->n = (num)), (top->bad_allowed = (bad)),   \
+	   (top->leftmost = (left)), ++top))
+#define	POP(low, num, bad, left)					      \
+  ((void) (--top, (low = top->lo), (num = top->n),			      \
+	   (bad = top->bad_allowed), (left = top->leftmost)))
 #define	STACK_NOT_EMPTY	(stack < top)
 
+/* Sort the N elements at BASE with insertion sort.  All the scans are
+   bounded by BASE, so that an inconsistent comparison function can not
+   make them run outside of the array.  */
+static void
+insertion_sort (const struct sort_param *p, char *base, size_t n)
+{
+  const size_t size = p->size;
+  char *end = ELEM (p, base, n);
+
+  for (char *cur = base + size; cur < end; cur += size)
+    for (char *sift = cur; sift > base && CMP (p, sift, sift - size) < 0;
+	 sift -= size)
+      SWAP (p, sift, sift - size);
+}
+
+/* Attempt to sort the N elements at BASE with insertion sort, giving up
+   once more than PARTIAL_INSERTION_SORT_LIMIT elements were moved.
+   Return true if the range ends up sorted.  */
+static bool
+partial_insertion_sort (const struct sort_param *p, char *base, size_t n)
+{
+  const size_t size = p->size;
+  char *end = ELEM (p, base, n);
+  size_t limit = 0;
+
+  for (char *cur = base + size; cur < end; cur += size)
+    {
+      char *sift = cur;
+      while (sift > base && CMP (p, sift, sift - size) < 0)
+	{
+	  SWAP (p, sift, sift - size);
+	  sift -= size;
+	}
+      limit += (cur - sift) / size;
+      if (limit > PARTIAL_INSERTION_SORT_LIMIT)
+	return false;
+    }
+  return true;
+}
+
+/* Establish the max-heap property for the subtree rooted at K of the
+   heap of N elements at BASE.  */
+static void
+siftdown (const struct sort_param *p, char *base, size_t k, size_t n)
+{
+  while (2 * k + 1 < n)
+    {
+      size_t j = 2 * k + 1;
+      if (j + 1 < n && CMP (p, ELEM (p, base, j), ELEM (p, base, j + 1)) < 0)
+	j++;
+      if (CMP (p, ELEM (p, base, k), ELEM (p, base, j)) >= 0)
+	break;
+      SWAP (p, ELEM (p, base, k), ELEM (p, base, j));
+      k = j;
+    }
+}
+
+/* Sort the N elements at BASE with heapsort.  Used when quicksort keeps
+   picking bad pivots, to guarantee O(n log n) worst case behavior.  */
+static void
+heapsort_r (const struct sort_param *p, char *base, size_t n)
+{
+  if (n < 2)
+    return;
+
+  for (size_t k = n / 2; k-- > 0; )
+    siftdown (p, base, k, n);
+
+  while (--n > 0)
+    {
+      SWAP (p, base, ELEM (p, base, n));
+      siftdown (p, base, 0, n);
+    }
+}
+
+/* Sort the three elements at A, B and C in place.  */
+static inline void
+sort3 (const struct sort_param *p, char *a, char *b, char *c)
+{
+  if (CMP (p, b, a) < 0)
+    SWAP (p, a, b);
+  if (CMP (p, c, b) < 0)
+    {
+      SWAP (p, b, c);
+      if (CMP (p, b, a) < 0)
+	SWAP (p, a, b);
+    }
+}
+
+/* Partition the N elements at BASE around the pivot stored at BASE.
+   Elements equal to the pivot go to the right partition.  Return the
+   final position of the pivot and store in *ALREADY_PARTITIONED whether
+   no element had to be moved.
+
+   Elements are classified in blocks of BLOCK_SIZE, recording the offsets
+   of the misplaced ones without branching on the comparison result, and
+   then swapped pairwise.  The only remaining unpredictable branches are
+   the ones inside the comparison function.  */
+static char *
+partition_right (const struct sort_param *p, char *base, size_t n,
+		 bool *already_partitioned)
+{
+  const size_t size = p->size;
+  char *pivot = base;
+  char *first = base + size;
+  char *last = ELEM (p, base, n);
+
+  /* Find the first element greater than or equal to the pivot.  The
+     pivot selection guarantees that one exists, the bound is only there
+     to protect against inconsistent comparison functions.  */
+  while (first < last && CMP (p, first, pivot) < 0)
+    first += size;
+
+  /* Find the last element strictly smaller than the pivot.  */
+  while (first < last)
+    {
+      last -= size;
+      if (CMP (p, last, pivot) < 0)
+	break;
+    }
+
+  *already_partitioned = first >= last;
+  if (!*already_partitioned)
+    {
+      unsigned char offsets_l[BLOCK_SIZE];
+      unsigned char offsets_r[BLOCK_SIZE];
+      size_t num_l = 0, num_r = 0, start_l = 0, start_r = 0;
+
+      SWAP (p, first, last);
+      first += size;
+
+      char *offsets_l_base = first;
+      char *offsets_r_base = last;
+
+      while (first < last)
+	{
+	  /* Fill up the offset blocks with elements that are on the wrong
+	     side.  First determine how many elements are considered for
+	     each block.  */
+	  size_t num_unknown = (last - first) / size;
+	  size_t left_split = num_l == 0
+			      ? (num_r == 0 ? num_unknown / 2 : num_unknown)
+			      : 0;
+	  size_t right_split = num_r == 0 ? num_unknown - left_split : 0;
+	  if (left_split > BLOCK_SIZE)
+	    left_split = BLOCK_SIZE;
+	  if (right_split > BLOCK_SIZE)
+	    right_split = BLOCK_SIZE;
+
+	  for (size_t i = 0; i < left_split; i++)
+	    {
+	      offsets_l[num_l] = i;
+	      num_l += !(CMP (p, first, pivot) < 0);
+	      first += size;
+	    }
+	  for (size_t i = 0; i < right_split; )
+	    {
+	      last -= size;
+	      offsets_r[num_r] = ++i;
+	      num_r += CMP (p, last, pivot) < 0;
+	    }
+
+	  /* Swap the misplaced pairs and update the block bookkeeping.  */
+	  size_t num = num_l < num_r ? num_l : num_r;
+	  for (size_t i = 0; i < num; i++)
+	    SWAP (p, ELEM (p, offsets_l_base, offsets_l[start_l + i]),
+		  offsets_r_base - offsets_r[start_r + i] * size);
+	  num_l -= num;
+	  num_r -= num;
+	  start_l += num;
+	  start_r += num;
+
+	  if (num_l == 0)
+	    {
+	      start_l = 0;
+	      offsets_l_base = first;
+	    }
+	  if (num_r == 0)
+	    {
+	      start_r = 0;
+	      offsets_r_base = last;
+	    }
+	}
+
+      /* All of [first, last) is classified now; move the remaining
+	 misplaced elements of the one unfinished block to the border.  */
+      if (num_l > 0)
+	{
+	  while (num_l-- > 0)
+	    {
+	      last -= size;
+	      char *e = ELEM (p, offsets_l_base, offsets_l[start_l + num_l]);
+	      if (e != last)
+		SWAP (p, e, last);
+	    }
+	  first = last;
+	}
+      if (num_r > 0)
+	{
+	  while (num_r-- > 0)
+	    {
+	      char *e = offsets_r_base - offsets_r[start_r + num_r] * size;
+	      if (e != first)
+		SWAP (p, e, first);
+	      first += size;
+	    }
+	}
+    }
+
+  /* Put the pivot in its final place.  */
+  char *pivot_pos = first - size;
+  if (pivot_pos != base)
+    SWAP (p, base, pivot_pos);
+  return pivot_pos;
+}
+
+/* Partition the N elements at BASE around the pivot stored at BASE,
+   placing the elements equal to the pivot in the left partition.  This
+   is used when the element preceding BASE (the pivot of an enclosing
+   partition step) compares equal to the pivot, in which case the whole
+   left partition consists of equal elements and needs no more work.
+   That makes inputs with many duplicates sort in linear time.  */
+static char *
+partition_left (const struct sort_param *p, char *base, size_t n)
+{
+  const size_t size = p->size;
+  char *pivot = base;
+  char *first = base;
+  char *last = ELEM (p, base, n);
+
+  do
+    last -= size;
+  while (last > base && CMP (p, pivot, last) < 0);
+
+  do
+    first += size;
+  while (first < last && !(CMP (p, pivot, first) < 0));
+
+  while (first < last)
+    {
+      SWAP (p, first, last);
+      do
+	last -= size;
+      while (last > base && CMP (p, pivot, last) < 0);
+      do
+	first += size;
+      while (first < last && !(CMP (p, pivot, first) < 0));
+    }
+
+  if (last != base)
+    SWAP (p, base, last);
+  return last;
+}
+
+/* Order the TOTAL_ELEMS elements of SIZE bytes at PBASE using a
+   pattern-defeating quicksort (introsort variant):
 
-/* Order size using quicksort.  This implementation incorporates
-   four optimizations discussed in Sedgewick:
+   1. Non-recursive, using an explicit stack that store the next array
+      partition to sort.  The smaller partition is always sorted first,
+      which guarantees no more than log (total_elems) stack entries.
 
-   1. Non-recursive, using an explicit stack of pointer that store the
-      next array partition to sort.  To save time, this maximum amount
-      of space required to store an array of SIZE_MAX is allocated on the
-      stack.  Assuming a 32-bit (64 bit) integer for size_t, this needs
-      only 32 * sizeof(stack_node) == 256 bytes (for 64 bit: 1024 bytes).
-      Pretty cheap, actually.
+   2. The pivot is the median of three elements, or Tukey's ninther for
+      larger partitions, moved to the start of the partition.
 
-   2. Chose the pivot element using a median-of-three decision tree.
-      This reduces the probability of selecting a bad pivot value and
-      eliminates certain extraneous comparisons.
+   3. Partitions below INSERTION_SORT_THRESHOLD elements are sorted with
+      insertion sort.  Ranges that needed no swaps during partitioning
+      are optimistically insertion sorted first, which makes sorted and
+      reverse sorted inputs linear.
 
-   3. Only quicksorts TOTAL_ELEMS / MAX_THRESH partitions, leaving
-      insertion sort to order the MAX_THRESH items within each partition.
-      This is a big win, since insertion sort is faster for small, mostly
-      sorted array segments.
+   4. Partitions that are highly unbalanced have some elements shuffled
+      to break up patterns; after log (total_elems) such partitions the
+      range is sorted with heapsort instead, bounding the worst case to
+      O(n log n).
 
-   4. The larger of the two sub-partitions is always pushed onto the
-      stack first, with the algorithm then concentrating on the
-      smaller partition.  This *guarantees* no more than log (total_elems)
-      stack size is needed (actually O(1) in this case)!  */
+   The sort is done in place and never allocates memory.  */
 
 void
 _quicksort (void *const pbase, size_t total_elems, size_t size,
 	    __compar_d_fn_t cmp, void *arg)
 {
-  char *base_ptr = (char *) pbase;
-
-  const size_t max_thresh = MAX_THRESH * size;
-
-  if (total_elems == 0)
-    /* Avoid lossage with unsigned arithmetic below.  */
+  if (total_elems <= 1)
     return;
 
-  if (total_elems > MAX_THRESH)
+  const struct sort_param p =
+    {
+      .size = size,
+      .swap_type = get_swap_type (pbase, size),
+      .cmp = cmp,
+      .arg = arg
+    };
+
+  stack_node stack[STACK_SIZE];
+  stack_node *top = stack;
+
+  char *lo = pbase;
+  size_t n = total_elems;
+  unsigned int bad_allowed = (sizeof (size_t) * CHAR_BIT - 1)
+			     - __builtin_clzl (total_elems);
+  bool leftmost = true;
+
+  while (true)
     {
-      char *lo = base_ptr;
-      char *hi = &lo[size * (total_elems - 1)];
-      stack_node stack[STACK_SIZE];
-      stack_node *top = stack;
-
-      PUSH (NULL, NULL);
-
-      while (STACK_NOT_EMPTY)
-        {
-          char *left_ptr;
-          char *right_ptr;
-
-	  /* Select median value from among LO, MID, and HI. Rearrange
-	     LO and HI so the three values are sorted. This lowers the
-	     probability of picking a pathological pivot value and
-	     skips a comparison for both the LEFT_PTR and RIGHT_PTR in
-	     the while loops. */
-
-	  char *mid = lo + size * ((hi - lo) / size >> 1);
-
-	  if ((*cmp) ((void *) mid, (void *) lo, arg) < 0)
-	    SWAP (mid, lo, size);
-	  if ((*cmp) ((void *) hi, (void *) mid, arg) < 0)
-	    SWAP (mid, hi, size);
-	  else
-	    goto jump_over;
-	  if ((*cmp) ((void *) mid, (void *) lo, arg) < 0)
-	    SWAP (mid, lo, size);
-	jump_over:;
-
-	  left_ptr  = lo + size;
-	  right_ptr = hi - size;
-
-	  /* Here's the famous ``collapse the walls'' section of quicksort.
-	     Gotta like those tight inner loops!  They are the main reason
-	     that this algorithm runs much faster than others. */
-	  do
+      if (n < INSERTION_SORT_THRESHOLD)
+	{
+	  insertion_sort (&p, lo, n);
+	  if (!STACK_NOT_EMPTY)
+	    break;
+	  POP (lo, n, bad_allowed, leftmost);
+	  continue;
+	}
+
+      /* Choose the pivot and move it to LO.  */
+      char *hi = ELEM (&p, lo, n - 1);
+      char *mid = ELEM (&p, lo, n / 2);
+      if (n > NINTHER_THRESHOLD)
+	{
+	  sort3 (&p, lo, mid, hi);
+	  sort3 (&p, lo + size, mid - size, hi - size);
+	  sort3 (&p, lo + 2 * size, mid + size, hi - 2 * size);
+	  sort3 (&p, mid - size, mid, mid + size);
+	  SWAP (&p, lo, mid);
+	}
+      else
+	sort3 (&p, mid, lo, hi);
+
+      /* If the element before LO (which is at most every element of the
+	 range) is equal to the pivot, all the elements equal to the pivot
+	 can be gathered on the left and skipped.  */
+      if (!leftmost && !(CMP (&p, lo - size, lo) < 0))
+	{
+	  char *pivot_pos = partition_left (&p, lo, n);
+	  size_t skip = (pivot_pos - lo) / size + 1;
+	  lo = pivot_pos + size;
+	  n -= skip;
+	  continue;
+	}
+
+      bool already_partitioned;
+      char *pivot_pos = partition_right (&p, lo, n, &already_partitioned);
+      size_t l_n = (pivot_pos - lo) / size;
+      size_t r_n = n - l_n - 1;
+      char *r_lo = pivot_pos + size;
+
+      if (l_n < n / 8 || r_n < n / 8)
+	{
+	  /* Highly unbalanced partition: if that happened too often fall
+	     back to heapsort, otherwise shuffle some elements around to
+	     break up the pattern that caused it.  */
+	  if (--bad_allowed == 0)
 	    {
-	      while ((*cmp) ((void *) left_ptr, (void *) mid, arg) < 0)
-		left_ptr += size;
-
-	      while ((*cmp) ((void *) mid, (void *) right_ptr, arg) < 0)
-		right_ptr -= size;
+	      heapsort_r (&p, lo, n);
+	      if (!STACK_NOT_EMPTY)
+		break;
+	      POP (lo, n, bad_allowed, leftmost);
+	      continue;
+	    }
 
-	      if (left_ptr < right_ptr)
+	  if (l_n >= INSERTION_SORT_THRESHOLD)
+	    {
+	      size_t q = l_n / 4;
+	      SWAP (&p, lo, ELEM (&p, lo, q));
+	      SWAP (&p, pivot_pos - size, pivot_pos - q * size);
+	      if (l_n > NINTHER_THRESHOLD)
 		{
-		  SWAP (left_ptr, right_ptr, size);
-		  if (mid == left_ptr)
-		    mid = right_ptr;
-		  else if (mid == right_ptr)
-		    mid = left_ptr;
-		  left_ptr += size;
-		  right_ptr -= size;
+		  SWAP (&p, lo + size, ELEM (&p, lo, q + 1));
+		  SWAP (&p, lo + 2 * size, ELEM (&p, lo, q + 2));
+		  SWAP (&p, pivot_pos - 2 * size, pivot_pos - (q + 1) * size);
+		  SWAP (&p, pivot_pos - 3 * size, pivot_pos - (q + 2) * size);
 		}
-	      else if (left_ptr == right_ptr)
+	    }
+	  if (r_n >= INSERTION_SORT_THRESHOLD)
+	    {
+	      size_t q = r_n / 4;
+	      char *r_hi = ELEM (&p, r_lo, r_n - 1);
+	      SWAP (&p, r_lo, ELEM (&p, r_lo, q));
+	      SWAP (&p, r_hi, r_hi - q * size);
+	      if (r_n > NINTHER_THRESHOLD)
 		{
-		  left_ptr += size;
-		  right_ptr -= size;
-		  break;
+		  SWAP (&p, r_lo + size, ELEM (&p, r_lo, q + 1));
+		  SWAP (&p, r_lo + 2 * size, ELEM (&p, r_lo, q + 2));
+		  SWAP (&p, r_hi - size, r_hi - (q + 1) * size);
+		  SWAP (&p, r_hi - 2 * size, r_hi - (q + 2) * size);
 		}
 	    }
-	  while (left_ptr <= right_ptr);
-
-          /* Set up pointers for next iteration.  First determine whether
-             left and right partitions are below the threshold size.  If so,
-             ignore one or both.  Otherwise, push the larger partition's
-             bounds on the stack and continue sorting the smaller one. */
-
-          if ((size_t) (right_ptr - lo) <= max_thresh)
-            {
-              if ((size_t) (hi - left_ptr) <= max_thresh)
-		/* Ignore both small partitions. */
-                POP (lo, hi);
-              else
-		/* Ignore small left partition. */
-                lo = left_ptr;
-            }
-          else if ((size_t) (hi - left_ptr) <= max_thresh)
-	    /* Ignore small right partition. */
-            hi = right_ptr;
-          else if ((right_ptr - lo) > (hi - left_ptr))
-            {
-	      /* Push larger left partition indices. */
-              PUSH (lo, right_ptr);
-              lo = left_ptr;
-            }
-          else
-            {
-	      /* Push larger right partition indices. */
-              PUSH (left_ptr, hi);
-              hi = right_ptr;
-            }
-        }
+	}
+      else if (already_partitioned
+	       && partial_insertion_sort (&p, lo, l_n)
+	       && partial_insertion_sort (&p, r_lo, r_n))
+	{
+	  /* The input was (nearly) sorted already.  */
+	  if (!STACK_NOT_EMPTY)
+	    break;
+	  POP (lo, n, bad_allowed, leftmost);
+	  continue;
+	}
+
+      /* Push the larger partition and continue with the smaller one.  */
+      if (l_n > r_n)
+	{
+	  PUSH (lo, l_n, bad_allowed, leftmost);
+	  lo = r_lo;
+	  n = r_n;
+	  leftmost = false;
+	}
+      else
+	{
+	  PUSH (r_lo, r_n, bad_allowed, false);
+	  n = l_n;
+	}
     }
-
-  /* Once the BASE_PTR array is partially sorted by quicksort the rest
-     is completely sorted using insertion sort, since this is efficient
-     for partitions below MAX_THRESH size. BASE_PTR points to the beginning
-     of the array to sort, and END_PTR points at the very last element in
-     the array (*not* one beyond it!). */
-
-#define min(x, y) ((x) < (y) ? (x) : (y))
-
-  {
-    char *const end_ptr = &base_ptr[size * (total_elems - 1)];
-    char *tmp_ptr = base_ptr;
-    char *thresh = min(end_ptr, base_ptr + max_thresh);
-    char *run_ptr;
-
-    /* Find smallest element in first threshold and place it at the
-       array's beginning.  This is the smallest array element,
-       and the operation speeds up insertion sort's inner loop. */
-
-    for (run_ptr = tmp_ptr + size; run_ptr <= thresh; run_ptr += size)
-      if ((*cmp) ((void *) run_ptr, (void *) tmp_ptr, arg) < 0)
-        tmp_ptr = run_ptr;
-
-    if (tmp_ptr != base_ptr)
-      SWAP (tmp_ptr, base_ptr, size);
-
-    /* Insertion sort, running from left-hand-side up to right-hand-side.  */
-
-    run_ptr = base_ptr + size;
-    while ((run_ptr += size) <= end_ptr)
-      {
-	tmp_ptr = run_ptr - size;
-	while ((*cmp) ((void *) run_ptr, (void *) tmp_ptr, arg) < 0)
-	  tmp_ptr -= size;
-
-	tmp_ptr += size;
-        if (tmp_ptr != run_ptr)
-          {
-            char *trav;
-
-	    trav = run_ptr + size;
-	    while (--trav >= run_ptr)
-              {
-                char c = *trav;
-                char *hi, *lo;
-
-                for (hi = lo = trav; (lo -= size) >= tmp_ptr; hi = lo)
-                  *hi = *lo;
-                *hi = c;
-              }
-          }
-      }
-  }
 }
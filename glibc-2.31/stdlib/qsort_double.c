@@ -0,0 +1,38 @@
+/* Sort an array of double values.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <stdint.h>
+#include <string.h>
+
+/* Map a double to an integer whose unsigned order is the IEEE 754
+   totalOrder of the values: flip all the bits of negative numbers and
+   only the sign bit of positive ones.  */
+static inline uint64_t
+double_key (double d)
+{
+  uint64_t u;
+  memcpy (&u, &d, sizeof (u));
+  return u ^ ((uint64_t) ((int64_t) u >> 63) | ((uint64_t) 1 << 63));
+}
+
+#define QSORT_NAME qsort_double
+#define ELEM_TYPE double
+#define KEY_TYPE uint64_t
+#define ELEM_KEY(e) double_key (e)
+
+#include "qsort_u64.c"
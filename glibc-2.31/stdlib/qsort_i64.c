@@ -0,0 +1,25 @@
+/* Sort an array of 64-bit signed integers.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#define QSORT_NAME qsort_i64
+#define ELEM_TYPE int64_t
+#define KEY_TYPE uint64_t
+/* Flipping the sign bit maps the signed order to the unsigned one.  */
+#define ELEM_KEY(e) ((uint64_t) (e) ^ ((uint64_t) 1 << 63))
+
+#include "qsort_u64.c"
@@ -1,5 +1,5 @@
-/* Function logf vectorized with AVX-512. Wrapper to AVX2 version.
-   Copyright (C) 2014-2020 Free Software Foundation, Inc.
+/* Sort an array of 64-bit key and payload pairs by key.
+   Copyright (C) 2020 Free Software Foundation, Inc.
    This file is part of the GNU C Library.
 
    The GNU C Library is free software; you can redistribute it and/or
@@ -16,10 +16,9 @@
    License along with the GNU C Library; if not, see
    <https://www.gnu.org/licenses/>.  */
 
-#include <sysdep.h>
-#include "svml_s_wrapper_impl.h"
+#define QSORT_NAME qsort_kv64
+#define ELEM_TYPE struct qsort_kv64
+#define KEY_TYPE uint64_t
+#define ELEM_KEY(e) ((e).key)
 
-	.text
-ENTRY (_ZGVeN16v_logf)
-WRAPPER_IMPL_AVX512 _ZGVdN8v_logf
-END (_ZGVeN16v_logf)
+#include "qsort_u64.c"
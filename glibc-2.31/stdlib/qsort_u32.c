@@ -1,5 +1,5 @@
-/* Function expf vectorized in AVX ISA as wrapper to SSE4 ISA version.
-   Copyright (C) 2014-2020 Free Software Foundation, Inc.
+/* Sort an array of 32-bit unsigned integers.
+   Copyright (C) 2020 Free Software Foundation, Inc.
    This file is part of the GNU C Library.
 
    The GNU C Library is free software; you can redistribute it and/or
@@ -16,10 +16,9 @@
    License along with the GNU C Library; if not, see
    <https://www.gnu.org/licenses/>.  */
 
-#include <sysdep.h>
-#include "svml_s_wrapper_impl.h"
+#define QSORT_NAME qsort_u32
+#define ELEM_TYPE uint32_t
+#define KEY_TYPE uint32_t
+#define ELEM_KEY(e) (e)
 
-        .text
-ENTRY(_ZGVcN8v_expf)
-WRAPPER_IMPL_AVX _ZGVbN4v_expf
-END(_ZGVcN8v_expf)
+#include "qsort_u64.c"
@@ -0,0 +1,145 @@
+/* Sort an array of integer or floating-point keys without a comparison
+   function.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* This file is the template for all the typed sort functions.  The
+   including file defines QSORT_NAME, the element type ELEM_TYPE, the
+   unsigned integer type KEY_TYPE used as radix key and ELEM_KEY, which
+   maps an element to a key whose unsigned order is the desired order of
+   the elements.  */
+#ifndef QSORT_NAME
+# define QSORT_NAME qsort_u64
+# define ELEM_TYPE uint64_t
+# define KEY_TYPE uint64_t
+# define ELEM_KEY(e) (e)
+#endif
+
+/* Arrays shorter than this are sorted with insertion sort.  */
+#define RADIX_THRESHOLD 64
+
+/* The keys are sorted by a least significant digit radix sort, one byte
+   per pass.  */
+#define RADIX_BITS 8
+#define RADIX_SIZE (1 << RADIX_BITS)
+#define RADIX_PASSES (sizeof (KEY_TYPE))
+
+static int
+compare_elem (const void *a, const void *b, void *arg)
+{
+  KEY_TYPE ka = ELEM_KEY (*(const ELEM_TYPE *) a);
+  KEY_TYPE kb = ELEM_KEY (*(const ELEM_TYPE *) b);
+  return (ka > kb) - (ka < kb);
+}
+
+static void
+insertion_sort (ELEM_TYPE *base, size_t nmemb)
+{
+  for (size_t i = 1; i < nmemb; i++)
+    {
+      ELEM_TYPE e = base[i];
+      KEY_TYPE k = ELEM_KEY (e);
+      size_t j = i;
+      for (; j > 0 && ELEM_KEY (base[j - 1]) > k; j--)
+	base[j] = base[j - 1];
+      base[j] = e;
+    }
+}
+
+void
+QSORT_NAME (ELEM_TYPE *base, size_t nmemb)
+{
+  if (nmemb < RADIX_THRESHOLD)
+    {
+      insertion_sort (base, nmemb);
+      return;
+    }
+
+  /* Already sorted input is common enough to be worth an extra scan,
+     which is cheap compared to a single radix pass.  */
+  size_t i;
+  for (i = 1; i < nmemb; i++)
+    if (ELEM_KEY (base[i - 1]) > ELEM_KEY (base[i]))
+      break;
+  if (i == nmemb)
+    return;
+
+  /* The radix sort needs a second array of the same size.  If it can
+     not be allocated fall back to the in-place sort used by qsort.  */
+  ELEM_TYPE *tmp = NULL;
+  if (nmemb <= SIZE_MAX / sizeof (ELEM_TYPE))
+    {
+      int save = errno;
+      tmp = malloc (nmemb * sizeof (ELEM_TYPE));
+      __set_errno (save);
+    }
+  if (tmp == NULL)
+    {
+      _quicksort (base, nmemb, sizeof (ELEM_TYPE), compare_elem, NULL);
+      return;
+    }
+
+  /* Compute the digit histograms of all passes with a single scan.  */
+  size_t count[RADIX_PASSES][RADIX_SIZE];
+  memset (count, 0, sizeof (count));
+  for (i = 0; i < nmemb; i++)
+    {
+      KEY_TYPE k = ELEM_KEY (base[i]);
+      for (size_t pass = 0; pass < RADIX_PASSES; pass++)
+	count[pass][(k >> (pass * RADIX_BITS)) & (RADIX_SIZE - 1)]++;
+    }
+
+  ELEM_TYPE *src = base;
+  ELEM_TYPE *dst = tmp;
+  for (size_t pass = 0; pass < RADIX_PASSES; pass++)
+    {
+      unsigned int shift = pass * RADIX_BITS;
+      size_t *c = count[pass];
+
+      /* Skip the pass if all the keys have the same digit, which is
+	 the case for the high bytes of small integers.  */
+      if (c[(ELEM_KEY (src[0]) >> shift) & (RADIX_SIZE - 1)] == nmemb)
+	continue;
+
+      size_t sum = 0;
+      for (size_t d = 0; d < RADIX_SIZE; d++)
+	{
+	  size_t t = c[d];
+	  c[d] = sum;
+	  sum += t;
+	}
+
+      for (i = 0; i < nmemb; i++)
+	{
+	  ELEM_TYPE e = src[i];
+	  dst[c[(ELEM_KEY (e) >> shift) & (RADIX_SIZE - 1)]++] = e;
+	}
+
+      ELEM_TYPE *t = src;
+      src = dst;
+      dst = t;
+    }
+
+  if (src != base)
+    memcpy (base, src, nmemb * sizeof (ELEM_TYPE));
+  free (tmp);
+}
@@ -0,0 +1,59 @@
+/* Per-thread 64-bit pseudo-random number generator.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "random64.h"
+
+/* Unlike random, which serializes all threads on one lock, every thread
+   has its own generator, seeded on first use from getrandom.  A child
+   process created by fork inherits the state of the calling thread, so
+   parent and child continue with the same sequence, as with random.  */
+
+static __thread struct random64_data state attribute_tls_model_ie;
+static __thread bool seeded attribute_tls_model_ie;
+
+static inline struct random64_data *
+get_state (void)
+{
+  if (__glibc_unlikely (!seeded))
+    {
+      __random64_seed_r (&state);
+      seeded = true;
+    }
+  return &state;
+}
+
+uint64_t
+random64 (void)
+{
+  return random64_next (get_state ()->__s);
+}
+
+void
+random64_fill (uint64_t *array, size_t n)
+{
+  __random64_fill_r (get_state (), array, n);
+}
+
+void
+random64_fill_double (double *array, size_t n)
+{
+  __random64_fill_double_r (get_state (), array, n);
+}
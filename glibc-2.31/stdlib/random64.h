@@ -0,0 +1,108 @@
+/* Internal definitions for the random64 family of functions.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#ifndef _RANDOM64_H
+#define _RANDOM64_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* The generator is xoshiro256** by David Blackman and Sebastiano Vigna,
+   see <http://prng.di.unimi.it/>.  It has a period of 2^256 - 1, passes
+   the usual statistical test suites and needs a handful of cycles per
+   64-bit output.  The state must not be all zero.  */
+
+static inline uint64_t
+random64_rotl (uint64_t x, int k)
+{
+  return (x << k) | (x >> (64 - k));
+}
+
+/* Return the next output for the state S and advance S.  */
+static inline uint64_t
+random64_next (uint64_t s[4])
+{
+  uint64_t result = random64_rotl (s[1] * 5, 7) * 9;
+  uint64_t t = s[1] << 17;
+
+  s[2] ^= s[0];
+  s[3] ^= s[1];
+  s[1] ^= s[2];
+  s[0] ^= s[3];
+  s[2] ^= t;
+  s[3] = random64_rotl (s[3], 45);
+
+  return result;
+}
+
+/* Advance the state S by 2^128 steps.  This splits the period into
+   2^128 non-overlapping streams, which are used for the lanes of the
+   bulk fill functions.  */
+static inline void
+random64_jump (uint64_t s[4])
+{
+  static const uint64_t jump[] =
+    {
+      0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL,
+      0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL
+    };
+  uint64_t t[4] = { 0, 0, 0, 0 };
+
+  for (int i = 0; i < 4; i++)
+    for (int b = 0; b < 64; b++)
+      {
+	if (jump[i] & (1ULL << b))
+	  {
+	    t[0] ^= s[0];
+	    t[1] ^= s[1];
+	    t[2] ^= s[2];
+	    t[3] ^= s[3];
+	  }
+	random64_next (s);
+      }
+
+  memcpy (s, t, sizeof (t));
+}
+
+/* Return the next output of the splitmix64 generator with state X,
+   which is used to expand a 64-bit seed into a full state.  */
+static inline uint64_t
+random64_splitmix (uint64_t *x)
+{
+  uint64_t z = (*x += 0x9e3779b97f4a7c15ULL);
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  return z ^ (z >> 31);
+}
+
+/* Map X to a double in [0, 1), using its high 52 bits as the mantissa
+   of a number in [1, 2).  Unlike a conversion from an integer this only
+   needs bit operations, so the loops using it vectorize.  */
+static inline double
+random64_to_double (uint64_t x)
+{
+  union
+  {
+    uint64_t i;
+    double d;
+  } u = { .i = (x >> 12) | 0x3ff0000000000000ULL };
+  return u.d - 1.0;
+}
+
+#endif /* random64.h */
@@ -0,0 +1,119 @@
+/* Fill an array with 64-bit pseudo-random numbers.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "random64.h"
+
+#ifndef RANDOM64_FILL
+# define RANDOM64_FILL __random64_fill_r
+#endif
+#ifndef RANDOM64_FILL_DOUBLE
+# define RANDOM64_FILL_DOUBLE __random64_fill_double_r
+#endif
+
+/* Large arrays are filled from LANES independent streams at once, in
+   structure of arrays form so that the compiler can keep every state
+   word of all lanes in one vector register.  Lane 0 is the stream of
+   BUF itself and lane L starts 2^128 * L steps further, so the lanes
+   never overlap.  Since jumping commutes with stepping, advancing BUF
+   by the number of steps taken by each lane makes the lanes of the next
+   call continue where the lanes of this call stopped.
+
+   The three jumps cost a few thousand cycles, so smaller arrays are
+   filled sequentially, with the same result as calling random64_r for
+   each element.  */
+#define LANES 4
+#define LANES_THRESHOLD 4096
+
+/* Store OUTPUT to element I of ARRAY, as a double if AS_DOUBLE.  */
+static __always_inline void
+store (void *array, size_t i, uint64_t output, bool as_double)
+{
+  if (as_double)
+    ((double *) array)[i] = random64_to_double (output);
+  else
+    ((uint64_t *) array)[i] = output;
+}
+
+static __always_inline void
+fill (struct random64_data *buf, void *array, size_t n, bool as_double)
+{
+  if (n < LANES_THRESHOLD)
+    {
+      for (size_t i = 0; i < n; i++)
+	store (array, i, random64_next (buf->__s), as_double);
+      return;
+    }
+
+  uint64_t s[4][LANES];
+  uint64_t lane[4];
+  memcpy (lane, buf->__s, sizeof (lane));
+  for (int l = 0; l < LANES; l++)
+    {
+      if (l > 0)
+	random64_jump (lane);
+      for (int w = 0; w < 4; w++)
+	s[w][l] = lane[w];
+    }
+
+  size_t i = 0;
+  for (; i + LANES <= n; i += LANES)
+    for (int l = 0; l < LANES; l++)
+      {
+	/* random64_next, spelled out on the lane arrays.  */
+	uint64_t t = s[1][l] << 17;
+	store (array, i + l, random64_rotl (s[1][l] * 5, 7) * 9, as_double);
+	s[2][l] ^= s[0][l];
+	s[3][l] ^= s[1][l];
+	s[1][l] ^= s[2][l];
+	s[0][l] ^= s[3][l];
+	s[2][l] ^= t;
+	s[3][l] = random64_rotl (s[3][l], 45);
+      }
+
+  /* The remaining elements are taken from the first lanes.  BUF
+     continues from lane 0; a lane which is not used here skips one
+     output in the next call, which does not matter.  */
+  for (int w = 0; w < 4; w++)
+    buf->__s[w] = s[w][0];
+  for (int l = 0; i < n; i++, l++)
+    {
+      uint64_t tail[4] = { s[0][l], s[1][l], s[2][l], s[3][l] };
+      store (array, i, random64_next (tail), as_double);
+      if (l == 0)
+	memcpy (buf->__s, tail, sizeof (tail));
+    }
+}
+
+void
+RANDOM64_FILL (struct random64_data *buf, uint64_t *array, size_t n)
+{
+  fill (buf, array, n, false);
+}
+libc_hidden_def (__random64_fill_r)
+weak_alias (__random64_fill_r, random64_fill_r)
+
+void
+RANDOM64_FILL_DOUBLE (struct random64_data *buf, double *array, size_t n)
+{
+  fill (buf, array, n, true);
+}
+libc_hidden_def (__random64_fill_double_r)
+weak_alias (__random64_fill_double_r, random64_fill_double_r)
@@ -0,0 +1,57 @@
+/* Reentrant 64-bit pseudo-random number generator.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <not-cancel.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <sys/random.h>
+#include <time.h>
+#include "random64.h"
+
+void
+srandom64_r (uint64_t seed, struct random64_data *buf)
+{
+  for (int i = 0; i < 4; i++)
+    buf->__s[i] = random64_splitmix (&seed);
+}
+
+int
+__random64_seed_r (struct random64_data *buf)
+{
+  /* Do not block if the kernel entropy pool is not yet initialized:
+     a process started early during boot still gets distinct, if not
+     unpredictable, sequences.  Seeding is not a cancellation point.  */
+  if (__getrandom_nocancel (buf->__s, sizeof (buf->__s), GRND_NONBLOCK)
+      == sizeof (buf->__s)
+      && (buf->__s[0] | buf->__s[1] | buf->__s[2] | buf->__s[3]) != 0)
+    return 0;
+
+  struct timespec ts;
+  __clock_gettime (CLOCK_MONOTONIC, &ts);
+  uint64_t seed = ((uint64_t) ts.tv_sec * 1000000000 + ts.tv_nsec)
+		  ^ (uintptr_t) buf;
+  srandom64_r (seed, buf);
+  return -1;
+}
+weak_alias (__random64_seed_r, random64_seed_r)
+
+uint64_t
+random64_r (struct random64_data *buf)
+{
+  return random64_next (buf->__s);
+}
@@ -535,6 +535,69 @@ extern int lcong48_r (unsigned short int __param[7],
 # endif	/* Use misc.  */
 #endif	/* Use misc or X/Open.  */
 
+#ifdef __USE_GNU
+/* 64-bit pseudo-random number generator (xoshiro256**) with a period of
+   2^256 - 1.  Unlike `random' these functions do not take a lock: each
+   thread has its own generator, seeded on first use from the kernel
+   entropy pool.  They must not be used for cryptographic purposes.  */
+
+/* Return a random 64-bit integer.  */
+extern __uint64_t random64 (void) __THROW;
+
+/* Fill ARRAY with N random 64-bit integers.  */
+extern void random64_fill (__uint64_t *__array, size_t __n) __THROW;
+
+/* Fill ARRAY with N random doubles in [0.0,1.0), which are multiples of
+   2^-52.  */
+extern void random64_fill_double (double *__array, size_t __n) __THROW;
+
+/* Reentrant versions of the above, using the state in BUF.  */
+struct random64_data
+  {
+    __uint64_t __s[4];
+  };
+
+/* Seed BUF deterministically from SEED.  */
+extern void srandom64_r (__uint64_t __seed, struct random64_data *__buf)
+     __THROW __nonnull ((2));
+
+/* Seed BUF from the kernel entropy pool.  If that fails, BUF is seeded
+   from the current time and -1 is returned, otherwise 0.  */
+extern int random64_seed_r (struct random64_data *__buf)
+     __THROW __nonnull ((1));
+
+extern __uint64_t random64_r (struct random64_data *__buf)
+     __THROW __nonnull ((1));
+
+/* Large arrays are filled from several independent streams at once, so
+   the result only equals that of N calls to random64_r for small N.  */
+extern void random64_fill_r (struct random64_data *__restrict __buf,
+			     __uint64_t *__restrict __array, size_t __n)
+     __THROW __nonnull ((1));
+
+extern void random64_fill_double_r (struct random64_data *__restrict __buf,
+				    double *__restrict __array, size_t __n)
+     __THROW __nonnull ((1));
+#endif
+
+#ifdef __USE_MISC
+/* Cryptographically secure pseudo-random number generator, based on
+   ChaCha20 and seeded from the kernel entropy pool.  Each thread has its
+   own state, which is reseeded after fork.  */
+
+/* Return a random integer between zero and 2**32-1 (inclusive).  */
+extern __uint32_t arc4random (void) __THROW __wur;
+
+/* Fill the buffer with random data.  */
+extern void arc4random_buf (void *__buf, size_t __size)
+     __THROW __nonnull ((1));
+
+/* Return a random number between zero (inclusive) and the specified
+   limit (exclusive).  */
+extern __uint32_t arc4random_uniform (__uint32_t __upper_bound)
+     __THROW __wur;
+#endif
+
 /* Allocate SIZE bytes of memory.  */
 extern void *malloc (size_t __size) __THROW __attribute_malloc__
      __attribute_alloc_size__ ((1)) __wur;
@@ -825,6 +888,45 @@ extern void *bsearch (const void *__key, const void *__base,
 # include <bits/stdlib-bsearch.h>
 #endif
 
+#ifdef __USE_GNU
+/* Like bsearch, but if several elements compare equal to KEY return the
+   first of them.  The search does not branch on the comparison results
+   and prefetches the elements of the next step, which makes it faster
+   than bsearch on large arrays.  */
+extern void *bsearch_first (const void *__key, const void *__base,
+			    size_t __nmemb, size_t __size,
+			    __compar_fn_t __compar)
+     __nonnull ((1, 2, 5)) __wur;
+
+/* Search for the NKEYS keys of KEYSIZE bytes each at KEYS in BASE, as
+   bsearch_first does, and store a pointer to the first matching element
+   or a null pointer for each key in RESULTS.  The searches for
+   consecutive keys are interleaved to overlap their memory accesses.
+   Return the number of keys found.  */
+extern size_t bsearch_batch (const void *__keys, size_t __nkeys,
+			     size_t __keysize, const void *__base,
+			     size_t __nmemb, size_t __size,
+			     __compar_fn_t __compar, void **__results)
+     __nonnull ((1, 4, 7, 8));
+
+/* Copy the NMEMB sorted elements of SIZE bytes at SRC to DST, which must
+   not overlap, in Eytzinger (breadth-first binary tree) order for
+   eytzinger_search.  */
+extern void eytzinger_layout (void *__restrict __dst,
+			      const void *__restrict __src,
+			      size_t __nmemb, size_t __size)
+     __THROW __nonnull ((1, 2));
+
+/* Search for KEY in BASE, which consists of NMEMB elements of SIZE bytes
+   each in the order produced by eytzinger_layout, using COMPAR to
+   perform the comparisons.  Return the first matching element in sorted
+   order, or a null pointer.  */
+extern void *eytzinger_search (const void *__key, const void *__base,
+			       size_t __nmemb, size_t __size,
+			       __compar_fn_t __compar)
+     __nonnull ((1, 2, 5)) __wur;
+#endif
+
 /* Sort NMEMB elements of BASE, of SIZE bytes each,
    using COMPAR to perform the comparisons.  */
 extern void qsort (void *__base, size_t __nmemb, size_t __size,
@@ -833,6 +935,32 @@ extern void qsort (void *__base, size_t __nmemb, size_t __size,
 extern void qsort_r (void *__base, size_t __nmemb, size_t __size,
 		     __compar_d_fn_t __compar, void *__arg)
   __nonnull ((1, 4));
+
+/* Sort NMEMB integers of BASE in ascending order, without the overhead
+   of calling a comparison function.  */
+extern void qsort_u32 (__uint32_t *__base, size_t __nmemb)
+     __THROW __nonnull ((1));
+extern void qsort_u64 (__uint64_t *__base, size_t __nmemb)
+     __THROW __nonnull ((1));
+extern void qsort_i64 (__int64_t *__base, size_t __nmemb)
+     __THROW __nonnull ((1));
+
+/* Sort NMEMB floating-point numbers of BASE in ascending order, as
+   defined by totalorder: negative NaNs sort first, and positive NaNs
+   last, and -0.0 sorts before +0.0.  */
+extern void qsort_double (double *__base, size_t __nmemb)
+     __THROW __nonnull ((1));
+
+/* Key and payload pair for qsort_kv64.  */
+struct qsort_kv64
+  {
+    __uint64_t key;
+    __uint64_t value;
+  };
+
+/* Sort NMEMB pairs of BASE in ascending order of their keys.  */
+extern void qsort_kv64 (struct qsort_kv64 *__base, size_t __nmemb)
+     __THROW __nonnull ((1));
 #endif
 
 
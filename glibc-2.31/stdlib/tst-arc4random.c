@@ -0,0 +1,255 @@
+/* Test arc4random, arc4random_buf and arc4random_uniform.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <support/check.h>
+#include <support/support.h>
+#include <support/xthread.h>
+#include <support/xunistd.h>
+#include <sys/param.h>
+#include <sys/wait.h>
+
+/* The output is random, so these checks can only catch gross errors
+   such as repeated output, unfilled buffers or values out of range.
+   Each of them fails by chance with negligible probability.  */
+
+/* Return true if the N bytes at P contain a run of 16 zero bytes.  */
+static bool
+has_zero_run (const unsigned char *p, size_t n)
+{
+  size_t run = 0;
+  for (size_t i = 0; i < n; i++)
+    {
+      run = p[i] == 0 ? run + 1 : 0;
+      if (run == 16)
+	return true;
+    }
+  return false;
+}
+
+static void
+check_buf (size_t n)
+{
+  unsigned char *a = xmalloc (n + 1);
+  unsigned char *b = xmalloc (n + 1);
+  memset (a, 0, n + 1);
+  memset (b, 0, n + 1);
+  arc4random_buf (a, n);
+  arc4random_buf (b, n);
+  if (n >= 16)
+    {
+      TEST_VERIFY (!has_zero_run (a, n));
+      TEST_VERIFY (memcmp (a, b, n) != 0);
+    }
+  /* Nothing is written past the end.  */
+  TEST_COMPARE (a[n], 0);
+  free (b);
+  free (a);
+}
+
+static void *
+thread_func (void *closure)
+{
+  arc4random_buf (closure, 32);
+  return NULL;
+}
+
+#define ROTL(x, k) (((x) << (k)) | ((x) >> (32 - (k))))
+#define QUARTER_ROUND(a, b, c, d)				\
+  x[a] += x[b]; x[d] = ROTL (x[d] ^ x[a], 16);			\
+  x[c] += x[d]; x[b] = ROTL (x[b] ^ x[c], 12);			\
+  x[a] += x[b]; x[d] = ROTL (x[d] ^ x[a], 8);			\
+  x[c] += x[d]; x[b] = ROTL (x[b] ^ x[c], 7)
+
+/* Store the ChaCha20 keystream block COUNTER for the all-zero key and
+   nonce, which is public, to DST.  */
+static void
+zero_key_block (unsigned char *dst, uint64_t counter)
+{
+  const uint32_t in[16] =
+    {
+      0x61707865, 0x3320646e, 0x79622d32, 0x6b206574,
+      0, 0, 0, 0, 0, 0, 0, 0,
+      counter, counter >> 32, 0, 0
+    };
+  uint32_t x[16];
+  memcpy (x, in, sizeof (x));
+  for (int i = 0; i < 10; i++)
+    {
+      QUARTER_ROUND (0, 4, 8, 12);
+      QUARTER_ROUND (1, 5, 9, 13);
+      QUARTER_ROUND (2, 6, 10, 14);
+      QUARTER_ROUND (3, 7, 11, 15);
+      QUARTER_ROUND (0, 5, 10, 15);
+      QUARTER_ROUND (1, 6, 11, 12);
+      QUARTER_ROUND (2, 7, 8, 13);
+      QUARTER_ROUND (3, 4, 9, 14);
+    }
+  for (int w = 0; w < 16; w++)
+    {
+      uint32_t v = x[w] + in[w];
+      for (int i = 0; i < 4; i++)
+	dst[w * 4 + i] = v >> (8 * i);
+    }
+}
+
+/* The first request of a thread is large enough to be written
+   directly to the buffer.  */
+static void *
+thread_func_bulk (void *closure)
+{
+  arc4random_buf (closure, 4096);
+  return NULL;
+}
+
+static int
+do_test (void)
+{
+  /* Sizes around the internal buffer and the bulk path.  */
+  static const size_t sizes[] =
+    {
+      0, 1, 15, 16, 479, 480, 481, 511, 512, 513, 1024, 4097, 65536,
+      65537, 200000
+    };
+  for (size_t i = 0; i < sizeof (sizes) / sizeof (sizes[0]); i++)
+    check_buf (sizes[i]);
+
+  /* Small requests draining the buffer across refills.  */
+  {
+    unsigned char buf[4096] = { 0 };
+    for (size_t off = 0; off < sizeof (buf); off += 7)
+      arc4random_buf (buf + off, MIN (7, sizeof (buf) - off));
+    TEST_VERIFY (!has_zero_run (buf, sizeof (buf)));
+  }
+
+  /* All bits of arc4random are set at some point.  */
+  uint32_t or_all = 0, and_all = UINT32_MAX;
+  for (int i = 0; i < 1000; i++)
+    {
+      uint32_t r = arc4random ();
+      or_all |= r;
+      and_all &= r;
+    }
+  TEST_COMPARE (or_all, UINT32_MAX);
+  TEST_COMPARE (and_all, 0);
+
+  /* arc4random_uniform stays in range and reaches every value.  */
+  static const uint32_t bounds[] = { 0, 1, 2, 3, 7, 10, 1000 };
+  for (size_t b = 0; b < sizeof (bounds) / sizeof (bounds[0]); b++)
+    {
+      uint32_t n = bounds[b];
+      bool seen[1000] = { false };
+      for (int i = 0; i < 100000; i++)
+	{
+	  uint32_t r = arc4random_uniform (n);
+	  TEST_VERIFY_EXIT (r < (n > 1 ? n : 1));
+	  seen[r] = true;
+	}
+      for (uint32_t r = 0; r < n; r++)
+	TEST_VERIFY (seen[r]);
+    }
+  for (int i = 0; i < 1000; i++)
+    TEST_VERIFY (arc4random_uniform (UINT32_MAX) < UINT32_MAX);
+
+  /* Threads have their own state.  */
+  unsigned char results[2][32];
+  pthread_t thr = xpthread_create (NULL, thread_func, results[0]);
+  thread_func (results[1]);
+  xpthread_join (thr);
+  TEST_VERIFY (memcmp (results[0], results[1], 32) != 0);
+
+  /* The key is seeded before the first request of a thread, even if
+     that does not go through the internal buffer.  */
+  {
+    unsigned char first[4096];
+    thr = xpthread_create (NULL, thread_func_bulk, first);
+    xpthread_join (thr);
+    /* The reference implementation is right.  */
+    unsigned char block[64];
+    zero_key_block (block, 0);
+    TEST_COMPARE (block[0], 0x76);
+    TEST_COMPARE (block[63], 0x86);
+    for (uint64_t counter = 0; counter < 128; counter++)
+      {
+	zero_key_block (block, counter);
+	TEST_VERIFY (memmem (first, sizeof (first), block, 16) == NULL);
+      }
+  }
+
+  /* The child after fork does not repeat the output of the parent, even
+     if the parent has buffered output left.  */
+  arc4random ();
+  int fds[2];
+  xpipe (fds);
+  pid_t pid = xfork ();
+  unsigned char mine[32];
+  arc4random_buf (mine, sizeof (mine));
+  if (pid == 0)
+    {
+      xwrite (fds[1], mine, sizeof (mine));
+      _exit (0);
+    }
+  unsigned char child[32];
+  TEST_COMPARE (read (fds[0], child, sizeof (child)), sizeof (child));
+  TEST_VERIFY (memcmp (mine, child, sizeof (mine)) != 0);
+  int status;
+  TEST_COMPARE (xwaitpid (pid, &status, 0), pid);
+  TEST_COMPARE (status, 0);
+  xclose (fds[0]);
+  xclose (fds[1]);
+
+  /* The same for large requests, which do not use the buffer.  The
+     output of the child must not appear anywhere in that of the
+     parent, which starts with what the parent had buffered.  */
+  {
+    static unsigned char parent_buf[8192];
+    static unsigned char child_buf[4096];
+    xpipe (fds);
+    pid = xfork ();
+    if (pid == 0)
+      {
+	arc4random_buf (child_buf, sizeof (child_buf));
+	xwrite (fds[1], child_buf, sizeof (child_buf));
+	_exit (0);
+      }
+    arc4random_buf (parent_buf, sizeof (parent_buf));
+    size_t got = 0;
+    while (got < sizeof (child_buf))
+      {
+	ssize_t r = read (fds[0], child_buf + got, sizeof (child_buf) - got);
+	TEST_VERIFY_EXIT (r > 0);
+	got += r;
+      }
+    for (size_t off = 0; off < sizeof (child_buf); off += 64)
+      TEST_VERIFY (memmem (parent_buf, sizeof (parent_buf),
+			   child_buf + off, 16) == NULL);
+    TEST_COMPARE (xwaitpid (pid, &status, 0), pid);
+    TEST_COMPARE (status, 0);
+    xclose (fds[0]);
+    xclose (fds[1]);
+  }
+
+  return 0;
+}
+
+#include <support/test-driver.c>
@@ -0,0 +1,129 @@
+/* Test bsearch_first, bsearch_batch and the Eytzinger search functions.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <support/check.h>
+#include <support/support.h>
+
+/* The arrays hold the even numbers up to 2 * NMEMB, each repeated DUP
+   times, so that every odd key is missing and every even key in range
+   has a well-defined first match.  The elements are larger than the key
+   so that the element size is exercised separately from the key.  */
+
+struct elem
+{
+  uint32_t key;
+  uint32_t index;
+};
+
+static int
+compare (const void *k, const void *e)
+{
+  uint32_t key = *(const uint32_t *) k;
+  uint32_t ekey = ((const struct elem *) e)->key;
+  return (key > ekey) - (key < ekey);
+}
+
+/* Return the index of the first element equal to KEY, or -1.  */
+static ptrdiff_t
+expected_index (const struct elem *array, size_t nmemb, uint32_t key)
+{
+  for (size_t i = 0; i < nmemb; i++)
+    if (array[i].key == key)
+      return i;
+  return -1;
+}
+
+static void
+do_one_test (size_t nmemb, size_t dup)
+{
+  struct elem *array = xmalloc (nmemb * sizeof (*array) + 1);
+  struct elem *eytz = xmalloc (nmemb * sizeof (*array) + 1);
+  for (size_t i = 0; i < nmemb; i++)
+    array[i] = (struct elem) { (i / dup) * 2, i };
+  eytzinger_layout (eytz, array, nmemb, sizeof (*array));
+
+  size_t nkeys = nmemb * 2 / dup + 4;
+  uint32_t *keys = xmalloc (nkeys * sizeof (*keys));
+  void **results = xmalloc (nkeys * sizeof (*results));
+  for (size_t i = 0; i < nkeys; i++)
+    keys[i] = i;
+
+  size_t expected_found = 0;
+  for (size_t i = 0; i < nkeys; i++)
+    expected_found += expected_index (array, nmemb, keys[i]) >= 0;
+  TEST_COMPARE (bsearch_batch (keys, nkeys, sizeof (*keys), array, nmemb,
+			       sizeof (*array), compare, results),
+		expected_found);
+
+  for (size_t i = 0; i < nkeys; i++)
+    {
+      ptrdiff_t idx = expected_index (array, nmemb, keys[i]);
+      struct elem *first = bsearch_first (&keys[i], array, nmemb,
+					  sizeof (*array), compare);
+      struct elem *eyt = eytzinger_search (&keys[i], eytz, nmemb,
+					   sizeof (*array), compare);
+      if (idx < 0)
+	{
+	  TEST_VERIFY (first == NULL);
+	  TEST_VERIFY (results[i] == NULL);
+	  TEST_VERIFY (eyt == NULL);
+	}
+      else
+	{
+	  TEST_VERIFY (first == &array[idx]);
+	  TEST_VERIFY (results[i] == &array[idx]);
+	  /* The Eytzinger copy carries the original index along.  */
+	  TEST_VERIFY (eyt != NULL && eyt->index == idx);
+	}
+      if (support_record_failure_is_failed ())
+	{
+	  printf ("error: nmemb %zu, dup %zu: key %u\n", nmemb, dup,
+		  (unsigned int) keys[i]);
+	  break;
+	}
+    }
+
+  free (results);
+  free (keys);
+  free (eytz);
+  free (array);
+}
+
+static int
+do_test (void)
+{
+  static const size_t dups[] = { 1, 2, 3, 17 };
+
+  for (size_t d = 0; d < sizeof (dups) / sizeof (dups[0]); d++)
+    {
+      for (size_t nmemb = 0; nmemb <= 70; nmemb++)
+	do_one_test (nmemb, dups[d]);
+      do_one_test (1000, dups[d]);
+      do_one_test (4095, dups[d]);
+      do_one_test (4096, dups[d]);
+      do_one_test (4097, dups[d]);
+    }
+
+  return 0;
+}
+
+#include <support/test-driver.c>
@@ -0,0 +1,77 @@
+/* Test the ChaCha20 block function used by arc4random.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <stdint.h>
+#include <string.h>
+#include <support/check.h>
+
+#include "chacha20.c"
+
+/* The keystream for the all-zero key and nonce, block numbers 0 and 1,
+   from RFC 8439, appendix A.1, test vectors #1 and #2.  */
+static const uint8_t expected_zero[2 * CHACHA20_BLOCK_SIZE] =
+  {
+    0x76, 0xb8, 0xe0, 0xad, 0xa0, 0xf1, 0x3d, 0x90,
+    0x40, 0x5d, 0x6a, 0xe5, 0x53, 0x86, 0xbd, 0x28,
+    0xbd, 0xd2, 0x19, 0xb8, 0xa0, 0x8d, 0xed, 0x1a,
+    0xa8, 0x36, 0xef, 0xcc, 0x8b, 0x77, 0x0d, 0xc7,
+    0xda, 0x41, 0x59, 0x7c, 0x51, 0x57, 0x48, 0x8d,
+    0x77, 0x24, 0xe0, 0x3f, 0xb8, 0xd8, 0x4a, 0x37,
+    0x6a, 0x43, 0xb8, 0xf4, 0x15, 0x18, 0xa1, 0x1c,
+    0xc3, 0x87, 0xb6, 0x69, 0xb2, 0xee, 0x65, 0x86,
+    0x9f, 0x07, 0xe7, 0xbe, 0x55, 0x51, 0x38, 0x7a,
+    0x98, 0xba, 0x97, 0x7c, 0x73, 0x2d, 0x08, 0x0d,
+    0xcb, 0x0f, 0x29, 0xa0, 0x48, 0xe3, 0x65, 0x69,
+    0x12, 0xc6, 0x53, 0x3e, 0x32, 0xee, 0x7a, 0xed,
+    0x29, 0xb7, 0x21, 0x76, 0x9c, 0xe6, 0x4e, 0x43,
+    0xd5, 0x71, 0x33, 0xb0, 0x74, 0xd8, 0x39, 0xd5,
+    0x31, 0xed, 0x1f, 0x28, 0x51, 0x0a, 0xfb, 0x45,
+    0xac, 0xe1, 0x0a, 0x1f, 0x4b, 0x79, 0x4d, 0x6f
+  };
+
+static int
+do_test (void)
+{
+  static const uint32_t zero_key[8];
+  uint8_t out[CHACHA20_BUFSIZE];
+  uint8_t out2[CHACHA20_BUFSIZE];
+
+  CHACHA20_BLOCKS (out, zero_key, 0);
+  TEST_COMPARE_BLOB (out, sizeof (expected_zero),
+		     expected_zero, sizeof (expected_zero));
+
+  /* The blocks of one call are consecutive, and the block numbers
+     carry into the high word.  */
+  CHACHA20_BLOCKS (out2, zero_key, 1);
+  TEST_COMPARE_BLOB (out + CHACHA20_BLOCK_SIZE,
+		     CHACHA20_BUFSIZE - CHACHA20_BLOCK_SIZE,
+		     out2, CHACHA20_BUFSIZE - CHACHA20_BLOCK_SIZE);
+
+  uint64_t base = UINT32_MAX - 2;
+  CHACHA20_BLOCKS (out, zero_key, base);
+  for (int l = 0; l < CHACHA20_LANES; l++)
+    {
+      CHACHA20_BLOCKS (out2, zero_key, base + l);
+      TEST_COMPARE_BLOB (out + l * CHACHA20_BLOCK_SIZE, CHACHA20_BLOCK_SIZE,
+			 out2, CHACHA20_BLOCK_SIZE);
+    }
+
+  return 0;
+}
+
+#include <support/test-driver.c>
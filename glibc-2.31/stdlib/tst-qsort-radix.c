@@ -0,0 +1,178 @@
+/* Test the typed sort functions qsort_u32, qsort_u64 and friends.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <support/check.h>
+#include <support/support.h>
+
+/* Every typed sort is checked against qsort with an equivalent
+   comparison function, for sizes on both sides of the insertion sort
+   threshold and for key distributions which leave some radix passes
+   out.  */
+
+static const size_t nmembs[] = { 0, 1, 2, 17, 63, 64, 65, 1000, 65537 };
+
+static uint64_t rand_state = 1;
+
+static uint64_t
+next_rand (void)
+{
+  /* xorshift64.  */
+  rand_state ^= rand_state << 13;
+  rand_state ^= rand_state >> 7;
+  rand_state ^= rand_state << 17;
+  return rand_state;
+}
+
+/* Return a random key, masked to MASK to get inputs which only differ
+   in the low bytes.  */
+static uint64_t
+random_key (uint64_t mask)
+{
+  return next_rand () & mask;
+}
+
+static const uint64_t masks[] =
+{
+  UINT64_MAX, 0xff, 0xffff00, 0xffffffff, 0xff00000000000000
+};
+
+#define MAKE_COMPARE(name, type)					      \
+  static int								      \
+  name (const void *a, const void *b)					      \
+  {									      \
+    type va = *(const type *) a;					      \
+    type vb = *(const type *) b;					      \
+    return (va > vb) - (va < vb);					      \
+  }
+
+MAKE_COMPARE (compare_u32, uint32_t)
+MAKE_COMPARE (compare_u64, uint64_t)
+MAKE_COMPARE (compare_i64, int64_t)
+
+static int
+compare_double (const void *a, const void *b)
+{
+  return totalorder ((const double *) b, (const double *) a)
+	 - totalorder ((const double *) a, (const double *) b);
+}
+
+static int
+compare_kv64 (const void *a, const void *b)
+{
+  const struct qsort_kv64 *ka = a;
+  const struct qsort_kv64 *kb = b;
+  return (ka->key > kb->key) - (ka->key < kb->key);
+}
+
+#define CHECK_SORT(sortfn, cmpfn, type, nmemb, init)			      \
+  do									      \
+    {									      \
+      type *array = xmalloc ((nmemb) * sizeof (type) + 1);		      \
+      type *expected = xmalloc ((nmemb) * sizeof (type) + 1);		      \
+      for (size_t i = 0; i < (nmemb); i++)				      \
+	array[i] = init;						      \
+      memcpy (expected, array, (nmemb) * sizeof (type));		      \
+      qsort (expected, (nmemb), sizeof (type), cmpfn);			      \
+      sortfn (array, (nmemb));						      \
+      for (size_t i = 0; i < (nmemb); i++)				      \
+	if (cmpfn (&array[i], &expected[i]) != 0)			      \
+	  {								      \
+	    support_record_failure ();					      \
+	    printf ("error: " #sortfn ": nmemb %zu: mismatch at %zu\n",	      \
+		    (size_t) (nmemb), i);				      \
+	    break;							      \
+	  }								      \
+      free (expected);							      \
+      free (array);							      \
+    }									      \
+  while (0)
+
+static double
+random_double (uint64_t mask)
+{
+  static const double specials[] =
+    {
+      0.0, -0.0, INFINITY, -INFINITY, NAN, -NAN, 1.0, -1.0, 0x1p-1074,
+      -0x1p-1074, 0x1.fffffffffffffp+1023, -0x1.fffffffffffffp+1023
+    };
+  uint64_t r = next_rand ();
+  if (r % 8 == 0)
+    return specials[(r >> 3) % (sizeof (specials) / sizeof (specials[0]))];
+  if (mask != UINT64_MAX)
+    return (double) (int64_t) (r & mask) - (double) (mask / 2);
+  double d;
+  memcpy (&d, &r, sizeof (d));
+  return d;
+}
+
+static int
+do_test (void)
+{
+  for (size_t n = 0; n < sizeof (nmembs) / sizeof (nmembs[0]); n++)
+    for (size_t m = 0; m < sizeof (masks) / sizeof (masks[0]); m++)
+      {
+	size_t nmemb = nmembs[n];
+	uint64_t mask = masks[m];
+
+	CHECK_SORT (qsort_u32, compare_u32, uint32_t, nmemb,
+		    (uint32_t) (random_key (mask) >> (mask >> 32 ? 32 : 0)));
+	CHECK_SORT (qsort_u64, compare_u64, uint64_t, nmemb,
+		    random_key (mask));
+	CHECK_SORT (qsort_i64, compare_i64, int64_t, nmemb,
+		    (int64_t) random_key (mask) - (int64_t) (mask / 2));
+	CHECK_SORT (qsort_double, compare_double, double, nmemb,
+		    random_double (mask));
+	CHECK_SORT (qsort_kv64, compare_kv64, struct qsort_kv64, nmemb,
+		    ((struct qsort_kv64) { random_key (mask), i }));
+
+	/* Already sorted and reverse sorted input.  */
+	CHECK_SORT (qsort_u64, compare_u64, uint64_t, nmemb, i * mask);
+	CHECK_SORT (qsort_u64, compare_u64, uint64_t, nmemb,
+		    (nmemb - i) * mask);
+      }
+
+  /* The payload of equal keys must be carried along: every input pair
+     has to show up in the output.  */
+  {
+    size_t nmemb = 10000;
+    struct qsort_kv64 *array = xmalloc (nmemb * sizeof (*array));
+    for (size_t i = 0; i < nmemb; i++)
+      array[i] = (struct qsort_kv64) { next_rand () % 10, i };
+    qsort_kv64 (array, nmemb);
+    unsigned char *seen = xcalloc (nmemb, 1);
+    for (size_t i = 0; i < nmemb; i++)
+      {
+	TEST_VERIFY (array[i].value < nmemb);
+	TEST_VERIFY (!seen[array[i].value]);
+	seen[array[i].value] = 1;
+	if (i > 0)
+	  TEST_VERIFY (array[i - 1].key <= array[i].key);
+      }
+    free (seen);
+    free (array);
+  }
+
+  return 0;
+}
+
+#include <support/test-driver.c>
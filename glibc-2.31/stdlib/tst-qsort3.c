@@ -0,0 +1,181 @@
+/* qsort tests for the in-place sorting path.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <support/check.h>
+#include <support/support.h>
+
+/* Exercise every element size with a dedicated swap routine (4, 8 and
+   16 bytes) and some which use the generic one, with input patterns
+   that trigger the different quicksort strategies: already sorted and
+   reverse sorted input, many duplicates, and patterns that produce
+   unbalanced partitions and end up in the heapsort fallback.  */
+
+typedef enum
+{
+  Sorted,
+  Reverse,
+  Random,
+  FewUnique,
+  AllEqual,
+  OrganPipe,
+  SawTooth,
+  NearlySorted,
+  PatternCount
+} pattern_t;
+
+static const size_t element_sizes[] = { 4, 8, 12, 16, 20, 32, 48 };
+
+static const size_t nmembs[] =
+{
+  0, 1, 2, 3, 7, 23, 24, 25, 100, 129, 500, 1000, 4096, 10007, 100000
+};
+
+static unsigned char *array;
+static unsigned char *array_end;
+static size_t element_size;
+
+static uint32_t
+get_key (const void *p)
+{
+  uint32_t key;
+  memcpy (&key, p, sizeof (key));
+  return key;
+}
+
+static int
+compare (const void *a, const void *b)
+{
+  if (! ((const unsigned char *) a >= array
+	 && (const unsigned char *) a < array_end
+	 && (const unsigned char *) b >= array
+	 && (const unsigned char *) b < array_end))
+    FAIL_EXIT1 ("compare arguments not inside of the array");
+  uint32_t ka = get_key (a);
+  uint32_t kb = get_key (b);
+  return (ka > kb) - (ka < kb);
+}
+
+/* Compare the whole element, used to check that the result is a
+   permutation of the input.  */
+static int
+compare_element (const void *a, const void *b)
+{
+  return memcmp (a, b, element_size);
+}
+
+static void
+fill_array (unsigned char *p, size_t nmemb, size_t size, pattern_t pattern)
+{
+  for (size_t i = 0; i < nmemb; i++)
+    {
+      uint32_t key;
+      switch (pattern)
+	{
+	case Sorted:
+	  key = i;
+	  break;
+	case Reverse:
+	  key = nmemb - i;
+	  break;
+	case Random:
+	  key = random ();
+	  break;
+	case FewUnique:
+	  key = random () % 4;
+	  break;
+	case AllEqual:
+	  key = 42;
+	  break;
+	case OrganPipe:
+	  key = i < nmemb / 2 ? i : nmemb - i;
+	  break;
+	case SawTooth:
+	  key = i % 37;
+	  break;
+	case NearlySorted:
+	default:
+	  key = i % 100 == 0 ? random () : i;
+	  break;
+	}
+      /* Use the remaining bytes to make each element unique, so that a
+	 broken swap routine can not go unnoticed.  */
+      for (size_t j = sizeof (key); j < size; j++)
+	p[i * size + j] = i + j;
+      memcpy (p + i * size, &key, sizeof (key));
+    }
+}
+
+static void
+test_one (size_t nmemb, size_t size, pattern_t pattern)
+{
+  unsigned char *input = xmalloc (nmemb * size + 1);
+  unsigned char *expected = xmalloc (nmemb * size + 1);
+
+  fill_array (input, nmemb, size, pattern);
+  array = xmalloc (nmemb * size + 1);
+  array_end = array + nmemb * size;
+  memcpy (array, input, nmemb * size);
+
+  qsort (array, nmemb, size, compare);
+
+  for (size_t i = 1; i < nmemb; i++)
+    if (get_key (array + (i - 1) * size) > get_key (array + i * size))
+      {
+	support_record_failure ();
+	printf ("error: %zu x %zu (pattern %d): failure at index %zu\n",
+		nmemb, size, (int) pattern, i);
+	break;
+      }
+
+  /* The sorted array must contain the same elements as the input.  */
+  element_size = size;
+  memcpy (expected, input, nmemb * size);
+  qsort (expected, nmemb, size, compare_element);
+  unsigned char *result = xmalloc (nmemb * size + 1);
+  memcpy (result, array, nmemb * size);
+  qsort (result, nmemb, size, compare_element);
+  if (memcmp (expected, result, nmemb * size) != 0)
+    {
+      support_record_failure ();
+      printf ("error: %zu x %zu (pattern %d): elements changed\n",
+	      nmemb, size, (int) pattern);
+    }
+
+  free (result);
+  free (expected);
+  free (array);
+  free (input);
+}
+
+static int
+do_test (void)
+{
+  for (size_t s = 0; s < sizeof (element_sizes) / sizeof (element_sizes[0]);
+       s++)
+    for (size_t n = 0; n < sizeof (nmembs) / sizeof (nmembs[0]); n++)
+      for (pattern_t pattern = Sorted; pattern < PatternCount; pattern++)
+	test_one (nmembs[n], element_sizes[s], pattern);
+
+  return 0;
+}
+
+#include <support/test-driver.c>
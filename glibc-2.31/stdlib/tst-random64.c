@@ -0,0 +1,138 @@
+/* Test the random64 family of functions.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <support/check.h>
+#include <support/support.h>
+#include <support/xthread.h>
+
+/* The first outputs of xoshiro256** for the state { 1, 2, 3, 4 }, from
+   the reference implementation.  */
+static const uint64_t reference[] =
+  {
+    11520ULL, 0ULL, 1509978240ULL, 1215971899390074240ULL
+  };
+
+static int
+compare_u64 (const void *a, const void *b)
+{
+  uint64_t va = *(const uint64_t *) a;
+  uint64_t vb = *(const uint64_t *) b;
+  return (va > vb) - (va < vb);
+}
+
+/* Check that random64_fill_r of N elements matches the lane structure
+   documented in random64_fill.c: the elements at multiples of the lane
+   count continue the stream of BUF.  */
+static void
+check_fill (uint64_t seed, size_t n)
+{
+  struct random64_data buf, ref;
+  srandom64_r (seed, &buf);
+  ref = buf;
+
+  uint64_t *array = xmalloc ((n + 1) * sizeof (*array));
+  random64_fill_r (&buf, array, n);
+
+  size_t stride = n < 4096 ? 1 : 4;
+  for (size_t i = 0; i < n; i += stride)
+    if (array[i] != random64_r (&ref))
+      {
+	support_record_failure ();
+	printf ("error: fill of %zu: mismatch at %zu\n", n, i);
+	break;
+      }
+
+  /* Filling doubles consumes the same outputs.  */
+  double *darray = xmalloc ((n + 1) * sizeof (*darray));
+  srandom64_r (seed, &ref);
+  random64_fill_double_r (&ref, darray, n);
+  for (size_t i = 0; i < n; i++)
+    {
+      TEST_VERIFY (darray[i] >= 0.0 && darray[i] < 1.0);
+      TEST_VERIFY (darray[i] == (double) (array[i] >> 12) * 0x1p-52);
+    }
+  TEST_VERIFY (memcmp (&ref, &buf, sizeof (buf)) == 0);
+
+  /* No output of the next call repeats one of this call.  */
+  uint64_t *next = xmalloc ((n + 1) * sizeof (*next));
+  random64_fill_r (&buf, next, n);
+  qsort_u64 (array, n);
+  for (size_t i = 0; i < n; i++)
+    TEST_VERIFY (bsearch_first (&next[i], array, n, sizeof (*array),
+				compare_u64) == NULL);
+
+  free (next);
+  free (darray);
+  free (array);
+}
+
+static void *
+thread_func (void *closure)
+{
+  uint64_t *result = closure;
+  random64_fill (result, 4);
+  return NULL;
+}
+
+static int
+do_test (void)
+{
+  struct random64_data buf;
+  memcpy (buf.__s, (uint64_t[]) { 1, 2, 3, 4 }, sizeof (buf.__s));
+  for (size_t i = 0; i < sizeof (reference) / sizeof (reference[0]); i++)
+    TEST_COMPARE (random64_r (&buf), reference[i]);
+
+  /* Seeding is deterministic.  */
+  struct random64_data a, b;
+  srandom64_r (42, &a);
+  srandom64_r (42, &b);
+  for (int i = 0; i < 100; i++)
+    TEST_COMPARE (random64_r (&a), random64_r (&b));
+
+  /* Seeding from the kernel gives different states.  */
+  random64_seed_r (&a);
+  random64_seed_r (&b);
+  TEST_VERIFY (memcmp (&a, &b, sizeof (a)) != 0);
+
+  static const size_t sizes[] = { 0, 1, 3, 4095, 4096, 4097, 4098, 4099,
+				  100000 };
+  for (size_t i = 0; i < sizeof (sizes) / sizeof (sizes[0]); i++)
+    check_fill (i, sizes[i]);
+
+  double d[1000];
+  random64_fill_double (d, 1000);
+  for (int i = 0; i < 1000; i++)
+    TEST_VERIFY (d[i] >= 0.0 && d[i] < 1.0);
+
+  /* Every thread has its own generator.  */
+  uint64_t results[2][4];
+  pthread_t thr = xpthread_create (NULL, thread_func, results[0]);
+  thread_func (results[1]);
+  xpthread_join (thr);
+  TEST_VERIFY (memcmp (results[0], results[1], sizeof (results[0])) != 0);
+  TEST_VERIFY (random64 () != random64 ());
+
+  return 0;
+}
+
+#include <support/test-driver.c>
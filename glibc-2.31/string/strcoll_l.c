@@ -20,6 +20,7 @@
 #include <assert.h>
 #include <langinfo.h>
 #include <locale.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <string.h>
@@ -254,6 +255,82 @@ out:
   return result;
 }
 
+#ifndef WIDE_CHAR_VERSION
+/* Compare US1 and US2 at level PASS like get_next_seq and do_compare,
+   but with the weights of the ASCII characters from ASCII, which are
+   all sorted forward.  Store the result in *RESULT and return true, or
+   return false if a character other than ASCII is reached first.  */
+static __always_inline bool
+compare_ascii (const unsigned char *us1, const unsigned char *us2,
+	       const struct lc_collate_ascii *ascii,
+	       const unsigned char *weights, int pass, int position,
+	       int *result)
+{
+  const unsigned char *w1 = NULL;
+  const unsigned char *w2 = NULL;
+  int len1 = 0;
+  int len2 = 0;
+
+  while (1)
+    {
+      size_t val1 = 0;
+      size_t val2 = 0;
+
+      /* Get the next sequences, skipping the ignored characters.  */
+      while (len1 == 0 && *us1 != '\0')
+	{
+	  if (*us1 >= 0x80)
+	    return false;
+	  len1 = ascii->len[pass][*us1];
+	  w1 = weights + ascii->idx[pass][*us1];
+	  ++us1;
+	  ++val1;
+	}
+      while (len2 == 0 && *us2 != '\0')
+	{
+	  if (*us2 >= 0x80)
+	    return false;
+	  len2 = ascii->len[pass][*us2];
+	  w2 = weights + ascii->idx[pass][*us2];
+	  ++us2;
+	  ++val2;
+	}
+
+      if (len1 == 0 || len2 == 0)
+	{
+	  *result = len1 == len2 ? 0 : len1 == 0 ? -1 : 1;
+	  return true;
+	}
+
+      if (position && val1 != val2)
+	{
+	  *result = val1 > val2 ? 1 : -1;
+	  return true;
+	}
+
+      do
+	{
+	  if (*w1 != *w2)
+	    {
+	      *result = *w1 - *w2;
+	      return true;
+	    }
+	  ++w1;
+	  ++w2;
+	  --len1;
+	  --len2;
+	}
+      while (len1 > 0 && len2 > 0);
+
+      if (position && len1 != len2)
+	{
+	  *result = len1 - len2;
+	  return true;
+	}
+    }
+}
+#endif
+
 int
 STRCOLL (const STRING_TYPE *s1, const STRING_TYPE *s2, locale_t l)
 {
@@ -290,6 +367,51 @@ STRCOLL (const STRING_TYPE *s1, const STRING_TYPE *s2, locale_t l)
   assert (((uintptr_t) extra) % __alignof__ (extra[0]) == 0);
   assert (((uintptr_t) indirect) % __alignof__ (indirect[0]) == 0);
 
+#ifndef WIDE_CHAR_VERSION
+  /* Most strings start with ASCII characters, and many differ there.
+     Compare them with the precomputed weights, and use the full
+     algorithm only if a character other than ASCII comes first.  */
+  const struct lc_collate_ascii *ascii
+    = &_nl_get_collate_data (current)->ascii;
+  if (ascii->usable)
+    {
+      const unsigned char *us1 = (const unsigned char *) s1;
+      const unsigned char *us2 = (const unsigned char *) s2;
+      int result;
+
+      /* A common prefix has the same weights in both strings at all
+	 levels, and the ignored characters at its end count the same
+	 for the positions.  */
+      size_t skip = 0;
+      while (us1[skip] == us2[skip] && us1[skip] != '\0'
+	     && us1[skip] < 0x80)
+	++skip;
+      if (us1[skip] == '\0' && us2[skip] == '\0')
+	return 0;
+
+      if (compare_ascii (us1 + skip, us2 + skip, ascii, weights, 0,
+			 rulesets[0] & sort_position, &result))
+	{
+	  if (result != 0)
+	    return result;
+
+	  /* Both strings are ASCII and the first level is not enough.
+	     The rule of the first character of S1 decides about the
+	     positions, as below.  */
+	  int rule = ascii->rule[*us1];
+	  for (int pass = 1; pass < nrules; ++pass)
+	    {
+	      compare_ascii (us1 + skip, us2 + skip, ascii, weights, pass,
+			     rulesets[rule * nrules + pass] & sort_position,
+			     &result);
+	      if (result != 0)
+		break;
+	    }
+	  return result;
+	}
+    }
+#endif
+
   int result = 0, rule = 0;
 
   /* With GCC 7 when compiling with -Os the compiler warns that
@@ -161,6 +161,31 @@ extern size_t strxfrm_l (char *__dest, const char *__src, size_t __n,
 			 locale_t __l) __THROW __nonnull ((2, 4));
 #endif
 
+#ifdef __USE_GNU
+/* Put the transformations of the N strings at SRCS, each with its
+   terminating null byte, one after the other into no more than SIZE
+   bytes of KEYS.  Store the offset of the transformation of SRCS[I] in
+   OFFSETS[I] and the total size in OFFSETS[N], and return it.  If it is
+   larger than SIZE, only the transformations before the first one which
+   does not fit are complete.  */
+extern size_t strxfrm_array (char *__keys, size_t __size,
+			     const char *const *__srcs, size_t __n,
+			     size_t *__offsets) __THROW __nonnull ((5));
+/* Return an upper bound of the total size strxfrm_array returns for the
+   N strings at SRCS, computed from their lengths.  */
+extern size_t strxfrm_array_bound (const char *const *__srcs, size_t __n)
+     __THROW __attribute_pure__;
+
+/* Likewise, using sorting rules from L.  */
+extern size_t strxfrm_array_l (char *__keys, size_t __size,
+			       const char *const *__srcs, size_t __n,
+			       size_t *__offsets, locale_t __l)
+     __THROW __nonnull ((5, 6));
+extern size_t strxfrm_array_bound_l (const char *const *__srcs, size_t __n,
+				     locale_t __l)
+     __THROW __attribute_pure__ __nonnull ((3));
+#endif
+
 #if (defined __USE_XOPEN_EXTENDED || defined __USE_XOPEN2K8	\
      || __GLIBC_USE (LIB_EXT2) || __GLIBC_USE (ISOC2X))
 /* Duplicate S, returning an identical malloc'd string.  */
@@ -0,0 +1,35 @@
+/* Transform arrays of strings into one buffer of sort keys.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <string.h>
+#include <locale/localeinfo.h>
+
+size_t
+strxfrm_array_bound (const char *const *srcs, size_t n)
+{
+  return __strxfrm_array_bound_l (srcs, n, _NL_CURRENT_LOCALE);
+}
+
+size_t
+__strxfrm_array (char *keys, size_t size, const char *const *srcs, size_t n,
+		 size_t *offsets)
+{
+  return __strxfrm_array_l (keys, size, srcs, n, offsets,
+			    _NL_CURRENT_LOCALE);
+}
+weak_alias (__strxfrm_array, strxfrm_array)
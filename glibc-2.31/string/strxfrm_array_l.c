@@ -0,0 +1,95 @@
+/* Transform arrays of strings into one buffer of sort keys.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <stdint.h>
+#include <string.h>
+#include <sys/param.h>
+#include "../locale/localeinfo.h"
+
+/* Each key is stored with its null byte, so that no key is a prefix
+   of another one and memcmp on the shorter length of two keys orders
+   them as strcmp, and so as strcoll orders the strings.  */
+
+size_t
+__strxfrm_array_bound_l (const char *const *srcs, size_t n, locale_t l)
+{
+  struct __locale_data *current = l->__locales[LC_COLLATE];
+  uint_fast32_t nrules =
+    current->values[_NL_ITEM_INDEX (_NL_COLLATE_NRULES)].word;
+  size_t factor = 1;
+  size_t total = 0;
+
+  /* Without rules the strings are copied.  */
+  if (nrules != 0)
+    factor = _nl_get_collate_data (current)->xfrm_factor;
+
+  for (size_t i = 0; i < n; ++i)
+    {
+      size_t len;
+      if (factor == 0)
+	/* The bound of the locale is not known, so the string has to
+	   be transformed.  */
+	len = __strxfrm_l (NULL, srcs[i], 0, l) + 1;
+      else
+	{
+	  /* The keys have a separator or the null byte after each
+	     level.  */
+	  size_t extra = MAX (nrules, 1);
+	  size_t slen = strlen (srcs[i]);
+	  if (slen > (SIZE_MAX - extra) / factor)
+	    return SIZE_MAX;
+	  len = slen * factor + extra;
+	}
+
+      if (len > SIZE_MAX - total)
+	return SIZE_MAX;
+      total += len;
+    }
+
+  return total;
+}
+libc_hidden_def (__strxfrm_array_bound_l)
+weak_alias (__strxfrm_array_bound_l, strxfrm_array_bound_l)
+
+
+size_t
+__strxfrm_array_l (char *keys, size_t size, const char *const *srcs,
+		   size_t n, size_t *offsets, locale_t l)
+{
+  size_t used = 0;
+  size_t room = size;
+
+  for (size_t i = 0; i < n; ++i)
+    {
+      /* Once a key did not fit only the lengths are computed.  */
+      size_t len = __strxfrm_l (room != 0 ? keys + used : NULL, srcs[i],
+				room, l);
+      if (len < room)
+	room -= len + 1;
+      else
+	room = 0;
+
+      offsets[i] = used;
+      used += len + 1;
+    }
+
+  offsets[n] = used;
+  return used;
+}
+libc_hidden_def (__strxfrm_array_l)
+weak_alias (__strxfrm_array_l, strxfrm_array_l)
@@ -664,6 +664,78 @@ do_xfrm_cached (STRING_TYPE *dest, size_t n, const locale_data_t *l_data,
   return needed - 1;
 }
 
+#ifndef WIDE_CHAR_VERSION
+/* Do the transformation of the SRCLEN ASCII characters at USRC like
+   do_xfrm_cached, but with the weights from ASCII, which are all
+   sorted forward.  */
+static size_t
+do_xfrm_ascii (const unsigned char *usrc, size_t srclen, char *dest,
+	       size_t n, const locale_data_t *l_data,
+	       const struct lc_collate_ascii *ascii)
+{
+  uint_fast32_t nrules = l_data->nrules;
+  const unsigned char *weights = l_data->weights;
+  unsigned char rule = ascii->rule[usrc[0]];
+  size_t needed = 0;
+  size_t last_needed;
+  char buf[7];
+
+  for (uint_fast32_t pass = 0; pass < nrules; ++pass)
+    {
+      /* We assume that if a rule has defined `position' in one section
+	 this is true for all of them.  */
+      int position = l_data->rulesets[rule * nrules + pass] & sort_position;
+      const unsigned char *lens = ascii->len[pass];
+      const int32_t *idxs = ascii->idx[pass];
+      int val = 1;
+
+      last_needed = needed;
+      for (size_t i = 0; i < srclen; ++i)
+	{
+	  size_t len = lens[usrc[i]];
+	  size_t buflen = 0;
+
+	  if (position)
+	    {
+	      if (len == 0)
+		{
+		  ++val;
+		  continue;
+		}
+	      buflen = utf8_encode (buf, val);
+	      val = 1;
+	    }
+
+	  if (needed + buflen + len < n)
+	    {
+	      const unsigned char *w = weights + idxs[usrc[i]];
+	      for (size_t j = 0; j < buflen; ++j)
+		dest[needed + j] = buf[j];
+	      for (size_t j = 0; j < len; ++j)
+		dest[needed + buflen + j] = w[j];
+	    }
+	  needed += buflen + len;
+	}
+
+      /* Finally store the byte to separate the passes or terminate
+	 the string.  */
+      if (needed < n)
+	dest[needed] = pass + 1 < nrules ? '\1' : '\0';
+      ++needed;
+    }
+
+  /* Remove the last \1 byte if no weights follow it, as
+     do_xfrm_cached does.  */
+  if (needed > 2 && needed == last_needed + 1)
+    {
+      if (--needed <= n)
+	dest[needed - 1] = '\0';
+    }
+
+  return needed - 1;
+}
+#endif
+
 size_t
 STRXFRM (STRING_TYPE *dest, const STRING_TYPE *src, size_t n, locale_t l)
 {
@@ -711,6 +783,21 @@ STRXFRM (STRING_TYPE *dest, const STRING_TYPE *src, size_t n, locale_t l)
      are used as indeces.  */
   const USTRING_TYPE *usrc = (const USTRING_TYPE *) src;
 
+#ifndef WIDE_CHAR_VERSION
+  /* Strings of ASCII characters, of any length, are transformed with
+     the precomputed weights if the locale allows it.  */
+  const struct lc_collate_ascii *ascii
+    = &_nl_get_collate_data (current)->ascii;
+  if (ascii->usable)
+    {
+      size_t srclen = 0;
+      while (usrc[srclen] != '\0' && usrc[srclen] < 0x80)
+	++srclen;
+      if (usrc[srclen] == '\0')
+	return do_xfrm_ascii (usrc, srclen, dest, n, &l_data, ascii);
+    }
+#endif
+
   /* Allocate cache for small strings on the stack and fill it with weight and
      rule indices.  If the cache size is not sufficient, continue with the
      uncached xfrm version.  */
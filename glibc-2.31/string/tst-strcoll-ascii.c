@@ -0,0 +1,155 @@
+/* Test the collation of ASCII strings with the precomputed weights.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+/* strcoll and strxfrm compare and transform the ASCII characters with
+   a table of their weights, while wcscoll always uses the full
+   algorithm.  Compare them on random strings, some of them with other
+   characters, and on strings too long for the index cache of
+   strxfrm.  */
+
+#include <locale.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <wchar.h>
+
+#include <support/check.h>
+#include <support/support.h>
+
+#define MAXCHARS 24
+#define LONGLEN 6000
+
+/* cs_CZ has the contraction "ch", so that strings in it always use the
+   full algorithm.  */
+static const char *const locales[] =
+  { "en_US.UTF-8", "de_DE.UTF-8", "en_US.ISO-8859-1", "cs_CZ.UTF-8",
+    "da_DK.ISO-8859-1" };
+
+static const wchar_t ascii[] = L"aAbBcChHzZ09 -.,'_\t";
+static const wchar_t others[] = L"\xe9\xc5\xdf\xe6";
+
+static wchar_t
+random_ascii (void)
+{
+  return ascii[random () % wcslen (ascii)];
+}
+
+static int
+sign (int value)
+{
+  return (value > 0) - (value < 0);
+}
+
+/* Store a random string in WS and its multibyte form in S.  */
+static void
+make_string (wchar_t *ws, char *s, int with_others)
+{
+  size_t len = random () % MAXCHARS;
+  for (size_t i = 0; i < len; ++i)
+    if (with_others && random () % 8 == 0)
+      ws[i] = others[random () % wcslen (others)];
+    else
+      ws[i] = random_ascii ();
+  ws[len] = L'\0';
+  TEST_VERIFY_EXIT (wcstombs (s, ws, MAXCHARS * 4 + 1) != (size_t) -1);
+}
+
+/* Check that strcoll agrees with wcscoll and with the transformed
+   strings.  */
+static void
+check_pair (const wchar_t *ws1, const char *s1, const wchar_t *ws2,
+	    const char *s2)
+{
+  int expected = sign (wcscoll (ws1, ws2));
+  int result = sign (strcoll (s1, s2));
+  if (result != expected)
+    {
+      support_record_failure ();
+      printf ("error: strcoll (\"%s\", \"%s\") has sign %d, expected %d\n",
+	      s1, s2, result, expected);
+    }
+  TEST_COMPARE (sign (strcoll (s2, s1)), -expected);
+
+  size_t len1 = strxfrm (NULL, s1, 0);
+  size_t len2 = strxfrm (NULL, s2, 0);
+  char *x1 = xmalloc (len1 + 1);
+  char *x2 = xmalloc (len2 + 1);
+  TEST_COMPARE (strxfrm (x1, s1, len1 + 1), len1);
+  TEST_COMPARE (strxfrm (x2, s2, len2 + 1), len2);
+  TEST_COMPARE (sign (strcmp (x1, x2)), expected);
+
+  /* A short buffer gets a prefix of the result.  */
+  char buf[4];
+  memset (buf, '\xff', sizeof (buf));
+  TEST_COMPARE (strxfrm (buf, s1, sizeof (buf)), len1);
+  if (len1 < sizeof (buf))
+    TEST_COMPARE_BLOB (buf, len1 + 1, x1, len1 + 1);
+
+  free (x1);
+  free (x2);
+}
+
+static int
+do_test (void)
+{
+  static wchar_t ws1[LONGLEN + 1];
+  static wchar_t ws2[LONGLEN + 1];
+  static char s1[LONGLEN * 4 + 1];
+  static char s2[LONGLEN * 4 + 1];
+
+  for (size_t l = 0; l < sizeof (locales) / sizeof (locales[0]); ++l)
+    {
+      if (setlocale (LC_ALL, locales[l]) == NULL)
+	FAIL_EXIT1 ("setlocale (LC_ALL, \"%s\") failed", locales[l]);
+
+      srandom (l);
+      for (int i = 0; i < 20000; ++i)
+	{
+	  int with_others = i % 4 == 0;
+	  make_string (ws1, s1, with_others);
+	  if (i % 3 == 0 && ws1[0] != L'\0')
+	    {
+	      /* A string with a common prefix.  */
+	      wcscpy (ws2, ws1);
+	      ws2[random () % wcslen (ws2)] = random_ascii ();
+	      TEST_VERIFY_EXIT (wcstombs (s2, ws2, sizeof (s2))
+				!= (size_t) -1);
+	    }
+	  else
+	    make_string (ws2, s2, with_others);
+	  check_pair (ws1, s1, ws2, s2);
+	}
+
+      /* Long strings which differ at the end.  */
+      for (int i = 0; i < 10; ++i)
+	{
+	  for (size_t j = 0; j < LONGLEN; ++j)
+	    ws1[j] = random_ascii ();
+	  ws1[LONGLEN] = L'\0';
+	  wcscpy (ws2, ws1);
+	  ws2[LONGLEN - 1 - random () % 10] = random_ascii ();
+	  TEST_VERIFY_EXIT (wcstombs (s1, ws1, sizeof (s1)) != (size_t) -1);
+	  TEST_VERIFY_EXIT (wcstombs (s2, ws2, sizeof (s2)) != (size_t) -1);
+	  check_pair (ws1, s1, ws2, s2);
+	}
+    }
+
+  return 0;
+}
+
+#include <support/test-driver.c>
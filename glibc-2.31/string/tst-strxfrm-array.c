@@ -0,0 +1,161 @@
+/* Test strxfrm_array and strxfrm_array_bound.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <locale.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/param.h>
+
+#include <support/check.h>
+#include <support/support.h>
+
+#define NSTRINGS 200
+#define MAXLEN 40
+
+static const char *const locales[] =
+  { "C", "en_US.UTF-8", "de_DE.UTF-8", "cs_CZ.UTF-8", "en_US.ISO-8859-1",
+    "da_DK.ISO-8859-1" };
+
+static char strings[NSTRINGS][MAXLEN + 1];
+static const char *srcs[NSTRINGS];
+
+/* Fill STRINGS with random text, some of it bytes which are not valid
+   in the locale.  */
+static void
+make_strings (void)
+{
+  static const char chars[] = "aAbBcChHzZ09 -.,'_\t\xc3\xa9\xc5\xdf\x80\xff";
+
+  for (size_t i = 0; i < NSTRINGS; ++i)
+    {
+      size_t len = random () % MAXLEN;
+      for (size_t j = 0; j < len; ++j)
+	strings[i][j] = chars[random () % (sizeof (chars) - 1)];
+      strings[i][len] = '\0';
+      srcs[i] = strings[i];
+    }
+}
+
+static int
+sign (int value)
+{
+  return (value > 0) - (value < 0);
+}
+
+static void
+check_locale (locale_t l)
+{
+  size_t offsets[NSTRINGS + 1];
+  size_t bound = strxfrm_array_bound (srcs, NSTRINGS);
+  TEST_COMPARE (strxfrm_array_bound_l (srcs, NSTRINGS, l), bound);
+  TEST_COMPARE (strxfrm_array_bound (srcs, 0), 0);
+
+  char *keys = xmalloc (bound);
+  size_t total = strxfrm_array (keys, bound, srcs, NSTRINGS, offsets);
+  TEST_VERIFY (total <= bound);
+  TEST_COMPARE (offsets[0], 0);
+  TEST_COMPARE (offsets[NSTRINGS], total);
+
+  /* Each key is the result of strxfrm.  */
+  for (size_t i = 0; i < NSTRINGS; ++i)
+    {
+      size_t len = strxfrm (NULL, srcs[i], 0);
+      TEST_COMPARE (offsets[i + 1] - offsets[i], len + 1);
+      TEST_COMPARE (strxfrm_array_bound (&srcs[i], 1) >= len + 1, 1);
+
+      char *key = xmalloc (len + 1);
+      strxfrm (key, srcs[i], len + 1);
+      TEST_COMPARE_BLOB (keys + offsets[i], len + 1, key, len + 1);
+      free (key);
+    }
+
+  /* memcmp on the shorter key orders the strings.  */
+  for (size_t i = 0; i + 1 < NSTRINGS; ++i)
+    {
+      size_t len1 = offsets[i + 1] - offsets[i];
+      size_t len2 = offsets[i + 2] - offsets[i + 1];
+      int expected = sign (strcoll (srcs[i], srcs[i + 1]));
+      int result = sign (memcmp (keys + offsets[i], keys + offsets[i + 1],
+				 MIN (len1, len2)));
+      if (result != expected)
+	{
+	  support_record_failure ();
+	  printf ("error: keys of \"%s\" and \"%s\" compare as %d,"
+		  " expected %d\n", srcs[i], srcs[i + 1], result, expected);
+	}
+    }
+
+  /* The same keys with an explicit locale.  */
+  char *keys_l = xmalloc (bound);
+  size_t offsets_l[NSTRINGS + 1];
+  TEST_COMPARE (strxfrm_array_l (keys_l, bound, srcs, NSTRINGS, offsets_l,
+				 l), total);
+  TEST_COMPARE_BLOB (offsets_l, sizeof (offsets_l), offsets,
+		     sizeof (offsets));
+  TEST_COMPARE_BLOB (keys_l, total, keys, total);
+
+  /* With too little room the size is still returned, and the keys
+     before the first one which does not fit are stored.  */
+  for (size_t size = 0; size < total; size += 1 + size / 2)
+    {
+      memset (keys_l, '\xff', bound);
+      TEST_COMPARE (strxfrm_array (keys_l, size, srcs, NSTRINGS, offsets_l),
+		    total);
+      TEST_COMPARE_BLOB (offsets_l, sizeof (offsets_l), offsets,
+			 sizeof (offsets));
+      size_t i = 0;
+      while (i < NSTRINGS && offsets[i + 1] <= size)
+	++i;
+      TEST_COMPARE_BLOB (keys_l, offsets[i], keys, offsets[i]);
+      for (size_t j = size; j < bound; ++j)
+	TEST_VERIFY (keys_l[j] == '\xff');
+    }
+
+  /* Nothing is written for an empty array.  */
+  TEST_COMPARE (strxfrm_array (NULL, 0, srcs, 0, offsets_l), 0);
+  TEST_COMPARE (offsets_l[0], 0);
+
+  free (keys_l);
+  free (keys);
+}
+
+static int
+do_test (void)
+{
+  for (size_t l = 0; l < sizeof (locales) / sizeof (locales[0]); ++l)
+    {
+      if (setlocale (LC_ALL, locales[l]) == NULL)
+	FAIL_EXIT1 ("setlocale (LC_ALL, \"%s\") failed", locales[l]);
+      locale_t loc = newlocale (LC_ALL_MASK, locales[l], (locale_t) 0);
+      TEST_VERIFY_EXIT (loc != (locale_t) 0);
+
+      srandom (l);
+      for (int i = 0; i < 20; ++i)
+	{
+	  make_strings ();
+	  check_locale (loc);
+	}
+
+      freelocale (loc);
+    }
+
+  return 0;
+}
+
+#include <support/test-driver.c>
@@ -0,0 +1,62 @@
+/* Bulk case mapping of ASCII letters.  Generic version.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#ifndef _CTYPE_BULK_H
+#define _CTYPE_BULK_H	1
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Flip the case of the letters FIRST to FIRST + 25 among the N bytes
+   at SRC, where FIRST is 'A' or 'a', and store the result in DST, which
+   may be SRC but must not overlap it otherwise.  All other bytes are
+   copied.  Only whole blocks are done; return the number of bytes
+   done, and the caller maps the rest with the tables.  */
+
+#define CTYPE_BULK_BLOCK	8
+
+static inline size_t
+ctype_bulk_flip_case (unsigned char *dst, const unsigned char *src,
+		      size_t n, unsigned char first)
+{
+  const uint64_t ones = 0x0101010101010101ULL;
+  const uint64_t high = 0x8080808080808080ULL;
+  size_t done;
+
+  for (done = 0; done + CTYPE_BULK_BLOCK <= n; done += CTYPE_BULK_BLOCK)
+    {
+      uint64_t x;
+      memcpy (&x, src + done, sizeof (x));
+
+      /* The low seven bits of each byte, plus an offset which sets the
+	 high bit if they are at least FIRST, or past FIRST + 25.  None
+	 of the sums carries into the next byte.  */
+      uint64_t low = x & ~high;
+      uint64_t ge_first = low + ones * (0x80 - first);
+      uint64_t gt_last = low + ones * (0x7f - (first + 25));
+      uint64_t letter = (ge_first ^ gt_last) & ~x & high;
+      x ^= letter >> 2;
+
+      memcpy (dst + done, &x, sizeof (x));
+    }
+
+  return done;
+}
+
+#endif /* ctype_bulk.h */
@@ -89,12 +89,72 @@ struct cache_file_new
   char version[sizeof CACHE_VERSION - 1];
   uint32_t nlibs;		/* Number of entries.  */
   uint32_t len_strings;		/* Size of string table. */
-  uint32_t unused[5];		/* Leave space for future extensions
+  uint32_t hash_offset;		/* Offset of the hash index from the
+				   start of this structure, or 0.  */
+  uint32_t unused[4];		/* Leave space for future extensions
 				   and align to 8 byte boundary.  */
   struct file_entry_new libs[0]; /* Entries describing libraries.  */
   /* After this the string table of size len_strings is found.	*/
 };
 
+/* The hash index maps each library name in the new format to the
+   first of its entries, which are sorted by name.  It is a perfect
+   hash: the names are distributed over NSEEDS buckets, and each bucket
+   has a seed which maps its names to different slots.  The slot of
+   NAME is
+
+     H = _dl_cache_hash (NAME, 0);
+     SEED = seeds[_dl_cache_hash_reduce (H, nseeds)];
+     SLOT = _dl_cache_hash_reduce (_dl_cache_hash (NAME, SEED), nslots);
+
+   and contains the index of the entry plus one, or zero.  A name which
+   is not in the cache may map to any slot, so the name of the entry
+   must be compared.  */
+struct cache_hash_index
+{
+  uint32_t nseeds;
+  uint32_t nslots;
+  uint32_t seeds[0];		/* NSEEDS seeds, followed by NSLOTS
+				   slots.  */
+};
+
+/* Hash NAME with SEED for the hash index.  Leading zeros of numbers
+   are skipped, so that names which _dl_cache_libcmp considers equal
+   have the same hash.  */
+static inline uint32_t
+_dl_cache_hash (const char *name, uint32_t seed)
+{
+  const unsigned char *p = (const unsigned char *) name;
+  uint32_t h = 2166136261U ^ seed;
+  int in_number = 0;
+
+  for (; *p != '\0'; ++p)
+    {
+      if (*p >= '0' && *p <= '9')
+	{
+	  if (!in_number && *p == '0' && p[1] >= '0' && p[1] <= '9')
+	    continue;
+	  in_number = 1;
+	}
+      else
+	in_number = 0;
+      h = (h ^ *p) * 16777619U;
+    }
+
+  /* Mix the bits, so that the high bits depend on all characters.  */
+  h ^= h >> 15;
+  h *= 0x2c1b3c6dU;
+  h ^= h >> 12;
+  return h;
+}
+
+/* Map the hash H to a number less than N.  */
+static inline uint32_t
+_dl_cache_hash_reduce (uint32_t h, uint32_t n)
+{
+  return ((uint64_t) h * n) >> 32;
+}
+
 /* Used to align cache_file_new.  */
 #define ALIGN_CACHE(addr)				\
 (((addr) + __alignof__ (struct cache_file_new) -1)	\
@@ -0,0 +1,51 @@
+/* Helper threads for ld.so.  Generic version.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#ifndef _DL_HELPER_THREAD_H
+#define _DL_HELPER_THREAD_H
+
+#include <stdbool.h>
+
+/* This type stores what _dl_helper_thread_join needs to wait for a
+   thread started by _dl_helper_thread_start.  */
+struct dl_helper_thread
+  {
+    /* In the stub version, no threads can be started.  */
+  };
+
+/* Start a thread which calls FN (ARG).  The thread runs before the
+   thread library is initialized and has no thread descriptor, so FN
+   must not use thread-local storage.  Returns true on success.  */
+static inline bool
+_dl_helper_thread_start (struct dl_helper_thread *thread
+			 __attribute__ ((unused)),
+			 int (*fn) (void *) __attribute__ ((unused)),
+			 void *arg __attribute__ ((unused)))
+{
+  return false;
+}
+
+/* Wait until the thread started with THREAD has exited and release
+   its resources.  */
+static inline void
+_dl_helper_thread_join (struct dl_helper_thread *thread
+			__attribute__ ((unused)))
+{
+}
+
+#endif /* dl-helper-thread.h */
@@ -0,0 +1,39 @@
+/* Blocking for dlclose while dl_iterate_phdr runs.  Generic version.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#ifndef _DL_PHDR_READERS_H
+#define _DL_PHDR_READERS_H
+
+#include <atomic.h>
+
+/* Wait until *WORD may differ from VAL.  Without a way to block,
+   this returns at once and the caller checks again.  */
+static inline void
+_dl_phdr_readers_wait (unsigned int *word __attribute__ ((unused)),
+		       unsigned int val __attribute__ ((unused)))
+{
+  atomic_spin_nop ();
+}
+
+/* Wake the threads waiting for a change of *WORD.  */
+static inline void
+_dl_phdr_readers_wake (unsigned int *word __attribute__ ((unused)))
+{
+}
+
+#endif /* dl-phdr-readers.h */
@@ -0,0 +1,218 @@
+/* Bulk conversion of character runs in the gconv loops.  Generic version.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#ifndef _GCONV_BULK_H
+#define _GCONV_BULK_H	1
+
+#include <byteswap.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Each function converts N input elements, in whole blocks, as long as
+   every element of a block is a character it handles, and returns the
+   number of elements converted.  It stops before the first block with
+   another element, which the caller converts one character at a time
+   with its full checks, as it does the tail of the input.  The
+   pointers need not be aligned.  UCS4 is the internal representation
+   in host byte order; UCS2 is swapped if SWAP is nonzero.  */
+
+#define GCONV_BULK_BLOCK	8
+
+/* Convert ASCII bytes to UCS4.  */
+static inline size_t
+gconv_bulk_ascii_to_ucs4 (const unsigned char *in, unsigned char *out,
+			  size_t n)
+{
+  size_t done;
+
+  for (done = 0; done + GCONV_BULK_BLOCK <= n; done += GCONV_BULK_BLOCK)
+    {
+      unsigned char any = 0;
+      for (int i = 0; i < GCONV_BULK_BLOCK; ++i)
+	any |= in[done + i];
+      if (any >= 0x80)
+	break;
+
+      for (int i = 0; i < GCONV_BULK_BLOCK; ++i)
+	{
+	  uint32_t wc = in[done + i];
+	  memcpy (out + 4 * (done + i), &wc, 4);
+	}
+    }
+
+  return done;
+}
+
+/* Convert UCS4 characters below 0x80 to ASCII.  */
+static inline size_t
+gconv_bulk_ucs4_to_ascii (const unsigned char *in, unsigned char *out,
+			  size_t n)
+{
+  size_t done;
+
+  for (done = 0; done + GCONV_BULK_BLOCK <= n; done += GCONV_BULK_BLOCK)
+    {
+      uint32_t wc[GCONV_BULK_BLOCK];
+      uint32_t any = 0;
+      memcpy (wc, in + 4 * done, sizeof (wc));
+      for (int i = 0; i < GCONV_BULK_BLOCK; ++i)
+	any |= wc[i];
+      if (any >= 0x80)
+	break;
+
+      for (int i = 0; i < GCONV_BULK_BLOCK; ++i)
+	out[done + i] = wc[i];
+    }
+
+  return done;
+}
+
+/* Convert UCS2 units which are not surrogates to UCS4.  */
+static inline size_t
+gconv_bulk_ucs2_to_ucs4 (const unsigned char *in, unsigned char *out,
+			 size_t n, int swap)
+{
+  size_t done;
+
+  for (done = 0; done + GCONV_BULK_BLOCK <= n; done += GCONV_BULK_BLOCK)
+    {
+      uint16_t u[GCONV_BULK_BLOCK];
+      int surrogate = 0;
+      memcpy (u, in + 2 * done, sizeof (u));
+      for (int i = 0; i < GCONV_BULK_BLOCK; ++i)
+	{
+	  if (swap)
+	    u[i] = bswap_16 (u[i]);
+	  surrogate |= (u[i] & 0xf800) == 0xd800;
+	}
+      if (surrogate)
+	break;
+
+      for (int i = 0; i < GCONV_BULK_BLOCK; ++i)
+	{
+	  uint32_t wc = u[i];
+	  memcpy (out + 4 * (done + i), &wc, 4);
+	}
+    }
+
+  return done;
+}
+
+/* Convert UCS4 characters below 0x10000 which are not surrogates to
+   UCS2.  */
+static inline size_t
+gconv_bulk_ucs4_to_ucs2 (const unsigned char *in, unsigned char *out,
+			 size_t n, int swap)
+{
+  size_t done;
+
+  for (done = 0; done + GCONV_BULK_BLOCK <= n; done += GCONV_BULK_BLOCK)
+    {
+      uint32_t wc[GCONV_BULK_BLOCK];
+      int bad = 0;
+      memcpy (wc, in + 4 * done, sizeof (wc));
+      for (int i = 0; i < GCONV_BULK_BLOCK; ++i)
+	bad |= wc[i] >= 0x10000 || (wc[i] & 0xf800) == 0xd800;
+      if (bad)
+	break;
+
+      for (int i = 0; i < GCONV_BULK_BLOCK; ++i)
+	{
+	  uint16_t u = swap ? bswap_16 (wc[i]) : wc[i];
+	  memcpy (out + 2 * (done + i), &u, 2);
+	}
+    }
+
+  return done;
+}
+
+/* Copy ASCII bytes.  */
+static inline size_t
+gconv_bulk_ascii_copy (const unsigned char *in, unsigned char *out, size_t n)
+{
+  size_t done;
+
+  for (done = 0; done + GCONV_BULK_BLOCK <= n; done += GCONV_BULK_BLOCK)
+    {
+      unsigned char any = 0;
+      for (int i = 0; i < GCONV_BULK_BLOCK; ++i)
+	any |= in[done + i];
+      if (any >= 0x80)
+	break;
+
+      memcpy (out + done, in + done, GCONV_BULK_BLOCK);
+    }
+
+  return done;
+}
+
+/* Convert ASCII bytes to UCS2.  */
+static inline size_t
+gconv_bulk_ascii_to_ucs2 (const unsigned char *in, unsigned char *out,
+			  size_t n, int swap)
+{
+  size_t done;
+
+  for (done = 0; done + GCONV_BULK_BLOCK <= n; done += GCONV_BULK_BLOCK)
+    {
+      unsigned char any = 0;
+      for (int i = 0; i < GCONV_BULK_BLOCK; ++i)
+	any |= in[done + i];
+      if (any >= 0x80)
+	break;
+
+      for (int i = 0; i < GCONV_BULK_BLOCK; ++i)
+	{
+	  uint16_t u = swap ? bswap_16 (in[done + i]) : in[done + i];
+	  memcpy (out + 2 * (done + i), &u, 2);
+	}
+    }
+
+  return done;
+}
+
+/* Convert UCS2 units below 0x80 to ASCII.  */
+static inline size_t
+gconv_bulk_ucs2_to_ascii (const unsigned char *in, unsigned char *out,
+			  size_t n, int swap)
+{
+  size_t done;
+
+  for (done = 0; done + GCONV_BULK_BLOCK <= n; done += GCONV_BULK_BLOCK)
+    {
+      uint16_t u[GCONV_BULK_BLOCK];
+      uint16_t any = 0;
+      memcpy (u, in + 2 * done, sizeof (u));
+      for (int i = 0; i < GCONV_BULK_BLOCK; ++i)
+	{
+	  if (swap)
+	    u[i] = bswap_16 (u[i]);
+	  any |= u[i];
+	}
+      if (any >= 0x80)
+	break;
+
+      for (int i = 0; i < GCONV_BULK_BLOCK; ++i)
+	out[done + i] = u[i];
+    }
+
+  return done;
+}
+
+#endif /* gconv_bulk.h */
@@ -208,6 +208,10 @@ struct r_search_path_elem
     const char *dirname;
     size_t dirnamelen;
 
+    /* The files which were not found in the directory, see
+       elf/dl-load.c.  */
+    struct r_missing_file *missing;
+
     enum r_dir_status status[0];
   };
 
@@ -370,6 +374,29 @@ struct rtld_global
      from that list.  */
   __rtld_lock_define_recursive (EXTERN, _dl_load_write_lock)
 
+  /* Snapshots of the loaded objects, for readers which do not take
+     _dl_load_write_lock.  The low bit of the version selects the
+     current one, see dl-find_object.c.  Zero means there is none.  */
+  EXTERN unsigned int _dl_find_object_version;
+  EXTERN struct dl_find_object_table *_dl_find_object_tables[2];
+
+  /* Threads which run dl_iterate_phdr on a snapshot.  dlclose waits
+     for them before it unmaps objects.  Each slot has a cache line of
+     its own, so that threads in different slots do not contend.  */
+#define DL_PHDR_READERS 64
+  EXTERN struct dl_phdr_reader
+  {
+    /* 0 if the slot is free, DL_PHDR_READER_CLAIMED while it is taken,
+       otherwise two more than the version of the snapshot in use.  */
+    unsigned int state;
+    void *thread;
+  } __attribute__ ((aligned (64))) _dl_phdr_readers[DL_PHDR_READERS];
+#define DL_PHDR_READER_CLAIMED 1
+  /* Incremented when a reader changes its state while there are
+     waiters.  */
+  EXTERN unsigned int _dl_phdr_readers_changed;
+  EXTERN unsigned int _dl_phdr_readers_waiters;
+
   /* Incremented whenever something may have been added to dl_loaded.  */
   EXTERN unsigned long long _dl_load_adds;
 
@@ -382,6 +409,8 @@ struct rtld_global
   /* Counters for the number of relocations performed.  */
   EXTERN unsigned long int _dl_num_relocations;
   EXTERN unsigned long int _dl_num_cache_relocations;
+  /* Number of symbol lookups answered by the lookup cache.  */
+  EXTERN unsigned long int _dl_num_lookup_cache_hits;
 
   /* List of search directories.  */
   EXTERN struct r_search_path_elem *_dl_all_dirs;
@@ -583,6 +612,8 @@ struct rtld_global_ro
   EXTERN const char *_dl_profile;
   /* Filename of the output file.  */
   EXTERN const char *_dl_profile_output;
+  /* Directory of the binding cache files.  */
+  EXTERN const char *_dl_bindcache_dir;
   /* Name of the object we want to trace the prelinking.  */
   EXTERN const char *_dl_trace_prelink;
   /* Map of shared object to be prelink traced.  */
@@ -933,6 +964,9 @@ enum
     /* Set if dl_lookup is called for non-lazy relocation processing
        from _dl_relocate_object in elf/dl-reloc.c.  */
     DL_LOOKUP_FOR_RELOCATE = 8,
+    /* Set if the lookup must not have any side effects because it is
+       called from _dl_lookup_symbol_prefetch.  */
+    DL_LOOKUP_PREFETCH = 16,
   };
 
 /* Lookup versioned symbol.  */
@@ -945,6 +979,70 @@ extern lookup_t _dl_lookup_symbol_x (const char *undef,
 				     struct link_map *skip_map)
      attribute_hidden;
 
+/* Start caching the results of the symbol lookups for relocations.
+   The caller must hold GL(dl_load_lock) unless no other threads
+   exist.  */
+extern void _dl_lookup_cache_begin (void) attribute_hidden;
+
+/* Stop caching the results of the symbol lookups and free the cache.
+   This also ends the caching for an enclosing _dl_lookup_cache_begin.
+   It does nothing if no results are cached.  */
+extern void _dl_lookup_cache_end (void) attribute_hidden;
+
+/* Discard the cached lookup results.  This is necessary whenever an
+   object is added to or removed from a scope.  */
+extern void _dl_lookup_cache_flush (void) attribute_hidden;
+
+#ifdef SHARED
+/* Prepare the use of the binding cache for the relocation of the
+   objects in the global scope of MAIN_MAP at startup.  */
+extern void _dl_bindcache_setup (struct link_map *main_map)
+     attribute_hidden;
+
+/* Look up the symbol UNDEF_NAME referenced by *REF in L like
+   _dl_lookup_symbol_x does for a relocation, using the binding cache.
+   L must have been set up by _dl_bindcache_setup.  */
+extern lookup_t _dl_bindcache_lookup (const char *undef_name,
+				      struct link_map *l,
+				      const ElfW(Sym) **ref,
+				      struct r_scope_elem *scope[],
+				      const struct r_found_version *version,
+				      int type_class) attribute_hidden;
+
+/* Write the binding cache file if necessary and release the cache.  */
+extern void _dl_bindcache_finish (void) attribute_hidden;
+
+/* Look up UNDEF_NAME without side effects for the relocation of
+   UNDEF_MAP.  See elf/dl-lookup.c.  */
+extern bool _dl_lookup_symbol_prefetch (const char *undef_name,
+					struct link_map *undef_map,
+					const ElfW(Sym) **ref,
+					struct r_scope_elem *symbol_scope[],
+					const struct r_found_version *version,
+					int type_class, struct link_map **mapp)
+     attribute_hidden;
+
+/* Do the symbol lookups for the relocation of the objects in the
+   global scope of MAIN_MAP at startup in advance on helper threads, if
+   enabled by the glibc.rtld.reloc_threads tunable.  */
+extern void _dl_relocate_prefetch (struct link_map *main_map)
+     attribute_hidden;
+
+/* Look up the symbol UNDEF_NAME referenced by *REF in L like
+   _dl_lookup_symbol_x does for a relocation, using the results of
+   _dl_relocate_prefetch.  */
+extern lookup_t _dl_prefetched_lookup (const char *undef_name,
+				       struct link_map *l,
+				       const ElfW(Sym) **ref,
+				       struct r_scope_elem *scope[],
+				       const struct r_found_version *version,
+				       int type_class) attribute_hidden;
+
+/* Release the results of _dl_relocate_prefetch.  */
+extern void _dl_relocate_prefetch_finish (struct link_map *main_map)
+     attribute_hidden;
+#endif
+
 
 /* Add the new link_map NEW to the end of the namespace list.  */
 extern void _dl_add_to_namespace_list (struct link_map *new, Lmid_t nsid)
@@ -1179,6 +1277,14 @@ extern void _dl_show_scope (struct link_map *new, int from)
 extern struct link_map *_dl_find_dso_for_object (const ElfW(Addr) addr);
 rtld_hidden_proto (_dl_find_dso_for_object)
 
+/* Publish a snapshot of the objects loaded now, not counting those
+   marked l_removed.  The caller must hold GL(dl_load_lock).  */
+extern void _dl_find_object_update (void) attribute_hidden;
+
+/* Wait until no thread other than the caller runs dl_iterate_phdr on
+   an older snapshot than the current one.  */
+extern void _dl_find_object_wait_readers (void) attribute_hidden;
+
 /* Initialization which is normally done by the dynamic linker.  */
 extern void _dl_non_dynamic_init (void)
      attribute_hidden;
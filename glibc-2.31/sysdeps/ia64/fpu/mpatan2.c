@@ -1 +0,0 @@
-/* Not needed.  */
@@ -20,16 +20,15 @@
 /*  MODULE_NAME: atnat.c                                                */
 /*                                                                      */
 /*  FUNCTIONS:  uatan                                                   */
-/*              atanMp                                                  */
 /*              signArctan                                              */
 /*                                                                      */
 /*                                                                      */
 /*  FILES NEEDED: dla.h endian.h mpa.h mydefs.h atnat.h                 */
-/*                mpatan.c mpatan2.c mpsqrt.c                           */
 /*                uatan.tbl                                             */
 /*                                                                      */
-/* An ultimate atan() routine. Given an IEEE double machine number x    */
-/* it computes the correctly rounded (to nearest) value of atan(x).     */
+/* An atan() routine.  Given an IEEE double machine number x it         */
+/* computes atan(x) with an error of less than one ulp, in a bounded    */
+/* number of steps.                                                     */
 /*                                                                      */
 /* Assumption: Machine arithmetic operations are performed in           */
 /* round to nearest mode of IEEE 754 standard.                          */
@@ -47,10 +46,6 @@
 #include <math.h>
 #include <fenv_private.h>
 #include <math-underflow.h>
-#include <stap-probe.h>
-
-void __mpatan (mp_no *, mp_no *, int);	/* see definition in mpatan.c */
-static double atanMp (double, const int[]);
 
   /* Fix the sign of y and return */
 static double
@@ -60,18 +55,16 @@ __signArctan (double x, double y)
 }
 
 
-/* An ultimate atan() routine. Given an IEEE double machine number x,    */
-/* routine computes the correctly rounded (to nearest) value of atan(x). */
+/* An atan() routine.  Given an IEEE double machine number x, routine */
+/* computes atan(x) with an error of less than one ulp.               */
 double
 __atan (double x)
 {
-  double cor, s1, ss1, s2, ss2, t1, t2, t3, t7, t8, t9, t10, u, u2, u3,
-	 v, vv, w, ww, y, yy, z, zz;
+  double cor, t1, t2, t3, u, v, w, ww, y, yy, z;
 #ifndef DLA_FMS
-  double t4, t5, t6;
+  double t4, t5, t6, t7;
 #endif
   int i, ux, dx;
-  static const int pr[M] = { 6, 8, 10, 32 };
   number num;
 
   num.d = x;
@@ -105,32 +98,9 @@ __atan (double x)
 	      yy = d3.d + v * yy;
 	      yy *= x * v;
 
-	      if ((y = x + (yy - U1 * x)) == x + (yy + U1 * x))
-		return y;
-
-	      EMULV (x, x, v, vv, t1, t2, t3, t4, t5);	/* v+vv=x^2 */
-
-	      s1 = f17.d + v * f19.d;
-	      s1 = f15.d + v * s1;
-	      s1 = f13.d + v * s1;
-	      s1 = f11.d + v * s1;
-	      s1 *= v;
-
-	      ADD2 (f9.d, ff9.d, s1, 0, s2, ss2, t1, t2);
-	      MUL2 (v, vv, s2, ss2, s1, ss1, t1, t2, t3, t4, t5, t6, t7, t8);
-	      ADD2 (f7.d, ff7.d, s1, ss1, s2, ss2, t1, t2);
-	      MUL2 (v, vv, s2, ss2, s1, ss1, t1, t2, t3, t4, t5, t6, t7, t8);
-	      ADD2 (f5.d, ff5.d, s1, ss1, s2, ss2, t1, t2);
-	      MUL2 (v, vv, s2, ss2, s1, ss1, t1, t2, t3, t4, t5, t6, t7, t8);
-	      ADD2 (f3.d, ff3.d, s1, ss1, s2, ss2, t1, t2);
-	      MUL2 (v, vv, s2, ss2, s1, ss1, t1, t2, t3, t4, t5, t6, t7, t8);
-	      MUL2 (x, 0, s1, ss1, s2, ss2, t1, t2, t3, t4, t5, t6, t7,
-		    t8);
-	      ADD2 (x, 0, s2, ss2, s1, ss1, t1, t2);
-	      if ((y = s1 + (ss1 - U5 * s1)) == s1 + (ss1 + U5 * s1))
-		return y;
-
-	      return atanMp (x, pr);
+	      y = x + yy;
+	      /* Max ULP is 0.511.  */
+	      return y;
 	    }
 	}
       else
@@ -145,44 +115,9 @@ __atan (double x)
 	  yy *= z;
 
 	  t1 = cij[i][1].d;
-	  if (i < 112)
-	    {
-	      if (i < 48)
-		u2 = U21;	/* u < 1/4        */
-	      else
-		u2 = U22;
-	    }			/* 1/4 <= u < 1/2 */
-	  else
-	    {
-	      if (i < 176)
-		u2 = U23;	/* 1/2 <= u < 3/4 */
-	      else
-		u2 = U24;
-	    }			/* 3/4 <= u <= 1  */
-	  if ((y = t1 + (yy - u2 * t1)) == t1 + (yy + u2 * t1))
-	    return __signArctan (x, y);
-
-	  z = u - hij[i][0].d;
-
-	  s1 = hij[i][14].d + z * hij[i][15].d;
-	  s1 = hij[i][13].d + z * s1;
-	  s1 = hij[i][12].d + z * s1;
-	  s1 = hij[i][11].d + z * s1;
-	  s1 *= z;
-
-	  ADD2 (hij[i][9].d, hij[i][10].d, s1, 0, s2, ss2, t1, t2);
-	  MUL2 (z, 0, s2, ss2, s1, ss1, t1, t2, t3, t4, t5, t6, t7, t8);
-	  ADD2 (hij[i][7].d, hij[i][8].d, s1, ss1, s2, ss2, t1, t2);
-	  MUL2 (z, 0, s2, ss2, s1, ss1, t1, t2, t3, t4, t5, t6, t7, t8);
-	  ADD2 (hij[i][5].d, hij[i][6].d, s1, ss1, s2, ss2, t1, t2);
-	  MUL2 (z, 0, s2, ss2, s1, ss1, t1, t2, t3, t4, t5, t6, t7, t8);
-	  ADD2 (hij[i][3].d, hij[i][4].d, s1, ss1, s2, ss2, t1, t2);
-	  MUL2 (z, 0, s2, ss2, s1, ss1, t1, t2, t3, t4, t5, t6, t7, t8);
-	  ADD2 (hij[i][1].d, hij[i][2].d, s1, ss1, s2, ss2, t1, t2);
-	  if ((y = s2 + (ss2 - U6 * s2)) == s2 + (ss2 + U6 * s2))
-	    return __signArctan (x, y);
-
-	  return atanMp (x, pr);
+	  y = t1 + yy;
+	  /* Max ULP is 0.56.  */
+	  return __signArctan (x, y);
 	}
     }
   else
@@ -203,38 +138,9 @@ __atan (double x)
 	  yy = HPI1 - z * yy;
 
 	  t1 = HPI - cij[i][1].d;
-	  if (i < 112)
-	    u3 = U31;           /* w <  1/2 */
-	  else
-	    u3 = U32;           /* w >= 1/2 */
-	  if ((y = t1 + (yy - u3)) == t1 + (yy + u3))
-	    return __signArctan (x, y);
-
-	  DIV2 (1, 0, u, 0, w, ww, t1, t2, t3, t4, t5, t6, t7, t8, t9,
-		t10);
-	  t1 = w - hij[i][0].d;
-	  EADD (t1, ww, z, zz);
-
-	  s1 = hij[i][14].d + z * hij[i][15].d;
-	  s1 = hij[i][13].d + z * s1;
-	  s1 = hij[i][12].d + z * s1;
-	  s1 = hij[i][11].d + z * s1;
-	  s1 *= z;
-
-	  ADD2 (hij[i][9].d, hij[i][10].d, s1, 0, s2, ss2, t1, t2);
-	  MUL2 (z, zz, s2, ss2, s1, ss1, t1, t2, t3, t4, t5, t6, t7, t8);
-	  ADD2 (hij[i][7].d, hij[i][8].d, s1, ss1, s2, ss2, t1, t2);
-	  MUL2 (z, zz, s2, ss2, s1, ss1, t1, t2, t3, t4, t5, t6, t7, t8);
-	  ADD2 (hij[i][5].d, hij[i][6].d, s1, ss1, s2, ss2, t1, t2);
-	  MUL2 (z, zz, s2, ss2, s1, ss1, t1, t2, t3, t4, t5, t6, t7, t8);
-	  ADD2 (hij[i][3].d, hij[i][4].d, s1, ss1, s2, ss2, t1, t2);
-	  MUL2 (z, zz, s2, ss2, s1, ss1, t1, t2, t3, t4, t5, t6, t7, t8);
-	  ADD2 (hij[i][1].d, hij[i][2].d, s1, ss1, s2, ss2, t1, t2);
-	  SUB2 (HPI, HPI1, s2, ss2, s1, ss1, t1, t2);
-	  if ((y = s1 + (ss1 - U7)) == s1 + (ss1 + U7))
-	    return __signArctan (x, y);
-
-	  return atanMp (x, pr);
+	  y = t1 + yy;
+	  /* Max ULP is 0.503.  */
+	  return __signArctan (x, y);
 	}
       else
 	{
@@ -254,35 +160,9 @@ __atan (double x)
 	      ww = w * ((1 - t1) - t2);
 	      ESUB (HPI, w, t3, cor);
 	      yy = ((HPI1 + cor) - ww) - yy;
-	      if ((y = t3 + (yy - U4)) == t3 + (yy + U4))
-		return __signArctan (x, y);
-
-	      DIV2 (1, 0, u, 0, w, ww, t1, t2, t3, t4, t5, t6, t7, t8,
-		    t9, t10);
-	      MUL2 (w, ww, w, ww, v, vv, t1, t2, t3, t4, t5, t6, t7, t8);
-
-	      s1 = f17.d + v * f19.d;
-	      s1 = f15.d + v * s1;
-	      s1 = f13.d + v * s1;
-	      s1 = f11.d + v * s1;
-	      s1 *= v;
-
-	      ADD2 (f9.d, ff9.d, s1, 0, s2, ss2, t1, t2);
-	      MUL2 (v, vv, s2, ss2, s1, ss1, t1, t2, t3, t4, t5, t6, t7, t8);
-	      ADD2 (f7.d, ff7.d, s1, ss1, s2, ss2, t1, t2);
-	      MUL2 (v, vv, s2, ss2, s1, ss1, t1, t2, t3, t4, t5, t6, t7, t8);
-	      ADD2 (f5.d, ff5.d, s1, ss1, s2, ss2, t1, t2);
-	      MUL2 (v, vv, s2, ss2, s1, ss1, t1, t2, t3, t4, t5, t6, t7, t8);
-	      ADD2 (f3.d, ff3.d, s1, ss1, s2, ss2, t1, t2);
-	      MUL2 (v, vv, s2, ss2, s1, ss1, t1, t2, t3, t4, t5, t6, t7, t8);
-	      MUL2 (w, ww, s1, ss1, s2, ss2, t1, t2, t3, t4, t5, t6, t7, t8);
-	      ADD2 (w, ww, s2, ss2, s1, ss1, t1, t2);
-	      SUB2 (HPI, HPI1, s1, ss1, s2, ss2, t1, t2);
-
-	      if ((y = s2 + (ss2 - U8)) == s2 + (ss2 + U8))
-		return __signArctan (x, y);
-
-	      return atanMp (x, pr);
+	      y = t3 + yy;
+	      /* Max ULP is 0.5003.  */
+	      return __signArctan (x, y);
 	    }
 	  else
 	    {
@@ -296,35 +176,6 @@ __atan (double x)
     }
 }
 
- /* Final stages. Compute atan(x) by multiple precision arithmetic */
-static double
-atanMp (double x, const int pr[])
-{
-  mp_no mpx, mpy, mpy2, mperr, mpt1, mpy1;
-  double y1, y2;
-  int i, p;
-
-  for (i = 0; i < M; i++)
-    {
-      p = pr[i];
-      __dbl_mp (x, &mpx, p);
-      __mpatan (&mpx, &mpy, p);
-      __dbl_mp (u9[i].d, &mpt1, p);
-      __mul (&mpy, &mpt1, &mperr, p);
-      __add (&mpy, &mperr, &mpy1, p);
-      __sub (&mpy, &mperr, &mpy2, p);
-      __mp_dbl (&mpy1, &y1, p);
-      __mp_dbl (&mpy2, &y2, p);
-      if (y1 == y2)
-	{
-	  LIBC_PROBE (slowatan, 3, &p, &x, &y1);
-	  return y1;
-	}
-    }
-  LIBC_PROBE (slowatan_inexact, 3, &p, &x, &y1);
-  return y1;			/*if impossible to do exact computing */
-}
-
 #ifndef __atan
 libm_alias_double (__atan, atan)
 #endif
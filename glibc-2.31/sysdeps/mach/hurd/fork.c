@@ -16,6 +16,7 @@
    <https://www.gnu.org/licenses/>.  */
 
 #include <errno.h>
+#include <stdlib.h>
 #include <unistd.h>
 #include <hurd.h>
 #include <hurd/signal.h>
@@ -666,6 +667,10 @@ __fork (void)
       _hurd_malloc_fork_child ();
       call_function_static_weak (__malloc_fork_unlock_child);
 
+      /* The child must not produce the same random numbers as the
+	 parent.  */
+      call_function_static_weak (__arc4random_fork_subprocess);
+
       /* Run things that want to run in the child task to set up.  */
       RUN_HOOK (_hurd_fork_child_hook, ());
 
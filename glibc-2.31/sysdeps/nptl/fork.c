@@ -122,9 +122,21 @@ __libc_fork (void)
 	  _IO_list_resetlock ();
 	}
 
+      /* The child must not produce the same random numbers as the
+	 parent.  */
+      call_function_static_weak (__arc4random_fork_subprocess);
+
       /* Reset the lock the dynamic loader uses to protect its data.  */
       __rtld_lock_initialize (GL(dl_load_lock));
 
+      /* The other threads which ran dl_iterate_phdr do not exist in the
+	 child, and dlclose must not wait for them.  */
+      for (size_t i = 0; i < DL_PHDR_READERS; ++i)
+	if (GL(dl_phdr_readers)[i].state == DL_PHDR_READER_CLAIMED
+	    || GL(dl_phdr_readers)[i].thread != self)
+	  GL(dl_phdr_readers)[i].state = 0;
+      GL(dl_phdr_readers_waiters) = 0;
+
       /* Run the handlers registered for the child.  */
       __run_fork_handlers (atfork_run_child, multiple_threads);
     }
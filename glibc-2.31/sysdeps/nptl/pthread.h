@@ -240,6 +240,32 @@ extern int pthread_clockjoin_np (pthread_t __th, void **__thread_return,
 				 const struct timespec *__abstime);
 #endif
 
+#ifdef __USE_GNU
+/* Sort NMEMB elements of BASE, of SIZE bytes each, using COMPAR with
+   the additional argument ARG to perform the comparisons, like
+   qsort_r, but using up to NTHREADS threads.  If NTHREADS is zero, the
+   number of online processors is used.  Small arrays, and arrays for
+   which no scratch memory can be allocated, are sorted by the calling
+   thread alone.  COMPAR must be safe to call concurrently, and may be
+   passed pointers to elements in the scratch memory.  */
+extern void pthread_qsort_np (void *__base, size_t __nmemb, size_t __size,
+			      int (*__compar) (const void *, const void *,
+					       void *),
+			      void *__arg, unsigned int __nthreads)
+     __nonnull ((1, 4));
+
+/* Transform the N strings at SRCS into sort keys like strxfrm_array,
+   but using up to NTHREADS threads.  If NTHREADS is zero, the number
+   of online processors is used.  Small arrays, and arrays whose keys
+   strxfrm_array_bound does not guarantee to fit into SIZE bytes, are
+   transformed by the calling thread alone.  */
+extern size_t pthread_strxfrm_array_np (char *__keys, size_t __size,
+					const char *const *__srcs, size_t __n,
+					size_t *__offsets,
+					unsigned int __nthreads)
+     __nonnull ((5));
+#endif
+
 /* Indicate that the thread TH is never to be joined with PTHREAD_JOIN.
    The resources of TH will therefore be freed immediately when it
    terminates, instead of waiting for another thread to perform PTHREAD_JOIN
@@ -0,0 +1,93 @@
+/* Helper threads for ld.so.  Linux version.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#ifndef _DL_HELPER_THREAD_H
+#define _DL_HELPER_THREAD_H
+
+#include <sched.h>
+#include <stackinfo.h>
+#include <stdbool.h>
+#include <sys/mman.h>
+#include <atomic.h>
+#include <lowlevellock-futex.h>
+
+/* The threads only run code of ld.so, which needs little stack.  */
+#define DL_HELPER_THREAD_STACK_SIZE	(128 * 1024)
+
+struct dl_helper_thread
+  {
+    void *stack;
+    /* The kernel clears the thread ID when the thread has exited.  */
+    pid_t tid;
+  };
+
+/* Start a thread which calls FN (ARG).  The thread runs before the
+   thread library is initialized and has no thread descriptor, so FN
+   must not use thread-local storage.  Returns true on success.  */
+static inline bool
+_dl_helper_thread_start (struct dl_helper_thread *thread,
+			 int (*fn) (void *), void *arg)
+{
+  void *stack = __mmap (NULL, DL_HELPER_THREAD_STACK_SIZE,
+			PROT_READ | PROT_WRITE,
+			MAP_PRIVATE | MAP_ANONYMOUS | MAP_STACK, -1, 0);
+  if (stack == MAP_FAILED)
+    return false;
+
+  /* The thread shares everything but its stack with the process.
+     CLONE_CHILD_CLEARTID lets _dl_helper_thread_join find out when
+     the stack is no longer used.  */
+  const int flags = (CLONE_VM | CLONE_FS | CLONE_FILES | CLONE_SIGHAND
+		     | CLONE_THREAD | CLONE_SYSVSEM
+		     | CLONE_PARENT_SETTID | CLONE_CHILD_CLEARTID);
+  thread->stack = stack;
+  thread->tid = 0;
+#ifdef __ia64__
+  int ret = __clone2 (fn, stack, DL_HELPER_THREAD_STACK_SIZE, flags, arg,
+		      &thread->tid, NULL, &thread->tid);
+#elif _STACK_GROWS_UP
+  int ret = __clone (fn, stack, flags, arg, &thread->tid, NULL,
+		     &thread->tid);
+#else
+  int ret = __clone (fn, stack + DL_HELPER_THREAD_STACK_SIZE, flags, arg,
+		     &thread->tid, NULL, &thread->tid);
+#endif
+  if (ret == -1)
+    {
+      __munmap (stack, DL_HELPER_THREAD_STACK_SIZE);
+      return false;
+    }
+  return true;
+}
+
+/* Wait until the thread started with THREAD has exited and release
+   its resources.  */
+static inline void
+_dl_helper_thread_join (struct dl_helper_thread *thread)
+{
+  pid_t tid;
+
+  /* The kernel wakes up the waiters on the thread ID with a shared
+     futex operation, so the private futex macros cannot be used.  */
+  while ((tid = atomic_load_acquire (&thread->tid)) != 0)
+    lll_futex_syscall (4, &thread->tid, FUTEX_WAIT, tid, NULL);
+
+  __munmap (thread->stack, DL_HELPER_THREAD_STACK_SIZE);
+}
+
+#endif /* dl-helper-thread.h */
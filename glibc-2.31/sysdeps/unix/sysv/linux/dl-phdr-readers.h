@@ -0,0 +1,39 @@
+/* Blocking for dlclose while dl_iterate_phdr runs.  Linux version.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#ifndef _DL_PHDR_READERS_H
+#define _DL_PHDR_READERS_H
+
+#include <limits.h>
+#include <lowlevellock-futex.h>
+
+/* Wait until *WORD may differ from VAL.  */
+static inline void
+_dl_phdr_readers_wait (unsigned int *word, unsigned int val)
+{
+  lll_futex_wait (word, val, LLL_PRIVATE);
+}
+
+/* Wake the threads waiting for a change of *WORD.  */
+static inline void
+_dl_phdr_readers_wake (unsigned int *word)
+{
+  lll_futex_wake (word, INT_MAX, LLL_PRIVATE);
+}
+
+#endif /* dl-phdr-readers.h */
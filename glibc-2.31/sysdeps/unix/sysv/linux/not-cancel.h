@@ -72,6 +72,18 @@ __writev_nocancel_nostatus (int fd, const struct iovec *iov, int iovcnt)
 /* Uncancelable fcntl.  */
 __typeof (__fcntl) __fcntl64_nocancel;
 
+/* Non cancellable getrandom syscall.  */
+static inline ssize_t
+__getrandom_nocancel (void *buf, size_t buflen, unsigned int flags)
+{
+#ifdef __NR_getrandom
+  return INLINE_SYSCALL_CALL (getrandom, buf, buflen, flags);
+#else
+  __set_errno (ENOSYS);
+  return -1;
+#endif
+}
+
 #if IS_IN (libc) || IS_IN (rtld)
 hidden_proto (__open_nocancel)
 hidden_proto (__open64_nocancel)
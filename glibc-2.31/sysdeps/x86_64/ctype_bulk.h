@@ -0,0 +1,51 @@
+/* Bulk case mapping of ASCII letters.  x86-64 version.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#ifndef _CTYPE_BULK_H
+#define _CTYPE_BULK_H	1
+
+#include <stddef.h>
+#include <emmintrin.h>
+
+/* See sysdeps/generic/ctype_bulk.h for the interface.  The blocks are
+   16 bytes and use only SSE2, which every x86-64 processor has.  */
+
+static inline size_t
+ctype_bulk_flip_case (unsigned char *dst, const unsigned char *src,
+		      size_t n, unsigned char first)
+{
+  /* The bytes from 0x80 are negative in the signed comparisons, and so
+     are below FIRST.  */
+  const __m128i before = _mm_set1_epi8 (first - 1);
+  const __m128i after = _mm_set1_epi8 (first + 26);
+  const __m128i bit = _mm_set1_epi8 (0x20);
+  size_t done;
+
+  for (done = 0; done + 16 <= n; done += 16)
+    {
+      __m128i x = _mm_loadu_si128 ((const __m128i *) (src + done));
+      __m128i letter = _mm_and_si128 (_mm_cmpgt_epi8 (x, before),
+				      _mm_cmplt_epi8 (x, after));
+      x = _mm_xor_si128 (x, _mm_and_si128 (letter, bit));
+      _mm_storeu_si128 ((__m128i *) (dst + done), x);
+    }
+
+  return done;
+}
+
+#endif /* ctype_bulk.h */
@@ -0,0 +1,27 @@
+/* libmvec array functions with AVX2 kernels.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#define ARRAY_NAME(func) __v##func##_avx2
+#define VLEN 4
+#define KVLEN 4
+#define KERNEL_v(func) _ZGVdN4v_##func
+#define KERNEL_vv(func) _ZGVdN4vv_##func
+#define KERNELF_v(func) _ZGVdN8v_##func##f
+#define KERNELF_vv(func) _ZGVdN8vv_##func##f
+
+#include <sysdeps/x86_64/fpu/svml_array.h>
@@ -1,5 +1,5 @@
-/* Function logf vectorized in AVX ISA as wrapper to SSE4 ISA version.
-   Copyright (C) 2014-2020 Free Software Foundation, Inc.
+/* libmvec array functions with SSE2 kernels.
+   Copyright (C) 2020 Free Software Foundation, Inc.
    This file is part of the GNU C Library.
 
    The GNU C Library is free software; you can redistribute it and/or
@@ -16,10 +16,6 @@
    License along with the GNU C Library; if not, see
    <https://www.gnu.org/licenses/>.  */
 
-#include <sysdep.h>
-#include "svml_s_wrapper_impl.h"
+#define ARRAY_NAME(func) __v##func##_sse2
 
-        .text
-ENTRY(_ZGVcN8v_logf)
-WRAPPER_IMPL_AVX _ZGVbN4v_logf
-END(_ZGVcN8v_logf)
+#include <sysdeps/x86_64/fpu/svml_array.c>
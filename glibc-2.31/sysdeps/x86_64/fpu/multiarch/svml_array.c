@@ -0,0 +1,83 @@
+/* Multiple versions of the libmvec array functions.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <mathvec.h>
+#include <init-arch.h>
+
+/* The array functions for AVX2 and AVX-512 run the generic kernels on
+   the full vector width, and the assembly kernels on 256-bit
+   vectors.  */
+static inline int
+array_isa (void)
+{
+  const struct cpu_features* cpu_features = __get_cpu_features ();
+
+  if (CPU_FEATURES_ARCH_P (cpu_features, AVX512F_Usable)
+      && !CPU_FEATURES_ARCH_P (cpu_features, MathVec_Prefer_No_AVX512))
+    return 2;
+  if (CPU_FEATURES_ARCH_P (cpu_features, AVX2_Usable))
+    return 1;
+  return 0;
+}
+
+#define DEFINE_ARRAY_IFUNC(func)					      \
+  extern __typeof (func) __##func##_sse2 attribute_hidden;		      \
+  extern __typeof (func) __##func##_avx2 attribute_hidden;		      \
+  extern __typeof (func) __##func##_avx512 attribute_hidden;		      \
+  libc_ifunc (func,							      \
+	      array_isa () == 2 ? __##func##_avx512			      \
+	      : array_isa () == 1 ? __##func##_avx2			      \
+	      : __##func##_sse2);
+
+DEFINE_ARRAY_IFUNC (vsin)
+DEFINE_ARRAY_IFUNC (vcos)
+DEFINE_ARRAY_IFUNC (vtan)
+DEFINE_ARRAY_IFUNC (vatan)
+DEFINE_ARRAY_IFUNC (vatan2)
+DEFINE_ARRAY_IFUNC (vexp)
+DEFINE_ARRAY_IFUNC (vexp2)
+DEFINE_ARRAY_IFUNC (vexpm1)
+DEFINE_ARRAY_IFUNC (vlog)
+DEFINE_ARRAY_IFUNC (vlog2)
+DEFINE_ARRAY_IFUNC (vlog10)
+DEFINE_ARRAY_IFUNC (vlog1p)
+DEFINE_ARRAY_IFUNC (vsinh)
+DEFINE_ARRAY_IFUNC (vcosh)
+DEFINE_ARRAY_IFUNC (vtanh)
+DEFINE_ARRAY_IFUNC (vcbrt)
+DEFINE_ARRAY_IFUNC (verf)
+DEFINE_ARRAY_IFUNC (vpow)
+
+DEFINE_ARRAY_IFUNC (vsinf)
+DEFINE_ARRAY_IFUNC (vcosf)
+DEFINE_ARRAY_IFUNC (vtanf)
+DEFINE_ARRAY_IFUNC (vatanf)
+DEFINE_ARRAY_IFUNC (vatan2f)
+DEFINE_ARRAY_IFUNC (vexpf)
+DEFINE_ARRAY_IFUNC (vexp2f)
+DEFINE_ARRAY_IFUNC (vexpm1f)
+DEFINE_ARRAY_IFUNC (vlogf)
+DEFINE_ARRAY_IFUNC (vlog2f)
+DEFINE_ARRAY_IFUNC (vlog10f)
+DEFINE_ARRAY_IFUNC (vlog1pf)
+DEFINE_ARRAY_IFUNC (vsinhf)
+DEFINE_ARRAY_IFUNC (vcoshf)
+DEFINE_ARRAY_IFUNC (vtanhf)
+DEFINE_ARRAY_IFUNC (vcbrtf)
+DEFINE_ARRAY_IFUNC (verff)
+DEFINE_ARRAY_IFUNC (vpowf)
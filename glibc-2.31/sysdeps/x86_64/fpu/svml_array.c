@@ -1,5 +1,5 @@
-/* Function logf vectorized with AVX2, wrapper version.
-   Copyright (C) 2014-2020 Free Software Foundation, Inc.
+/* libmvec array functions with SSE2 kernels.
+   Copyright (C) 2020 Free Software Foundation, Inc.
    This file is part of the GNU C Library.
 
    The GNU C Library is free software; you can redistribute it and/or
@@ -16,14 +16,14 @@
    License along with the GNU C Library; if not, see
    <https://www.gnu.org/licenses/>.  */
 
-#include <sysdep.h>
-#include "svml_s_wrapper_impl.h"
-
-	.text
-ENTRY (_ZGVdN8v_logf)
-WRAPPER_IMPL_AVX _ZGVbN4v_logf
-END (_ZGVdN8v_logf)
-
-#ifndef USE_MULTIARCH
- libmvec_hidden_def (_ZGVdN8v_logf)
+#ifndef ARRAY_NAME
+# define ARRAY_NAME(func) v##func
 #endif
+#define VLEN 2
+#define KVLEN 2
+#define KERNEL_v(func) _ZGVbN2v_##func
+#define KERNEL_vv(func) _ZGVbN2vv_##func
+#define KERNELF_v(func) _ZGVbN4v_##func##f
+#define KERNELF_vv(func) _ZGVbN4vv_##func##f
+
+#include "svml_array.h"
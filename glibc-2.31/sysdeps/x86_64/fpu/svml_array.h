@@ -0,0 +1,166 @@
+/* Template for the libmvec array functions.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+/* The includer defines VLEN to the number of double lanes of its ISA,
+   ARRAY_NAME to build the name of the array function for FUNC, and
+   KVLEN, KERNEL_v, KERNEL_vv, KERNELF_v and KERNELF_vv to select the
+   assembly kernels with KVLEN double or 2 * KVLEN float lanes, which
+   may be narrower than the ISA.
+
+   The functions with generic kernels inline them, the others call the
+   assembly kernels through their hidden aliases.  The head of the
+   array up to the first element whose output address is aligned to
+   the vector size, and the tail which does not fill a vector, are
+   computed with a vector padded with 1.0, which is in the domain of
+   every function and raises no exception.  */
+
+#include <mathvec.h>
+#include <stdint.h>
+#include <string.h>
+#include "svml_s_vecmathf.h"
+
+typedef double k_f64 __attribute__ ((vector_size (KVLEN * 8)));
+typedef float k_f32 __attribute__ ((vector_size (KVLEN * 8)));
+
+extern k_f64 KERNEL_v (sin) (k_f64);
+extern k_f64 KERNEL_v (cos) (k_f64);
+extern k_f64 KERNEL_v (exp) (k_f64);
+extern k_f64 KERNEL_v (log) (k_f64);
+extern k_f64 KERNEL_vv (pow) (k_f64, k_f64);
+extern k_f32 KERNELF_v (sin) (k_f32);
+extern k_f32 KERNELF_v (cos) (k_f32);
+extern k_f32 KERNELF_v (exp) (k_f32);
+extern k_f32 KERNELF_v (log) (k_f32);
+extern k_f32 KERNELF_vv (pow) (k_f32, k_f32);
+libmvec_hidden_proto (KERNEL_v (sin))
+libmvec_hidden_proto (KERNEL_v (cos))
+libmvec_hidden_proto (KERNEL_v (exp))
+libmvec_hidden_proto (KERNEL_v (log))
+libmvec_hidden_proto (KERNEL_vv (pow))
+libmvec_hidden_proto (KERNELF_v (sin))
+libmvec_hidden_proto (KERNELF_v (cos))
+libmvec_hidden_proto (KERNELF_v (exp))
+libmvec_hidden_proto (KERNELF_v (log))
+libmvec_hidden_proto (KERNELF_vv (pow))
+
+/* Return the number of elements of size ELEM before OUT is aligned to
+   SIZE bytes, at most N.  */
+static __always_inline size_t
+array_head (const void *out, size_t size, size_t elem, size_t n)
+{
+  size_t mis = (uintptr_t) out % size;
+  size_t head = 0;
+
+  if (mis != 0 && mis % elem == 0)
+    head = (size - mis) / elem;
+  return head < n ? head : n;
+}
+
+/* Compute the COUNT elements at index I with one call of KERNEL on
+   vectors of type VT.  */
+#define ARRAY_STEP_v(T, vt, kernel, i, count)				      \
+  do									      \
+    {									      \
+      vt x = (vt) {} + (T) 1;						      \
+      memcpy (&x, in + (i), (count) * sizeof (T));			      \
+      x = kernel (x);							      \
+      memcpy (out + (i), &x, (count) * sizeof (T));			      \
+    }									      \
+  while (0)
+
+#define ARRAY_STEP_vv(T, vt, kernel, i, count)				      \
+  do									      \
+    {									      \
+      vt x = (vt) {} + (T) 1;						      \
+      vt y = (vt) {} + (T) 1;						      \
+      memcpy (&x, in1 + (i), (count) * sizeof (T));			      \
+      memcpy (&y, in2 + (i), (count) * sizeof (T));			      \
+      x = kernel (x, y);						      \
+      memcpy (out + (i), &x, (count) * sizeof (T));			      \
+    }									      \
+  while (0)
+
+/* The partial vectors of the head and the tail go through a separate
+   function, so that the kernel is inlined only twice.  */
+#define ARRAY_LOOP(func, nargs, T, vt, lanes, kernel, ...)		      \
+  static void __attribute__ ((noinline))				      \
+  func##_part (T *out, __VA_ARGS__, size_t n)				      \
+  {									      \
+    ARRAY_STEP_##nargs (T, vt, kernel, 0, n);				      \
+  }									      \
+									      \
+  void ARRAY_NAME (func) (T *, __VA_ARGS__, size_t);			      \
+  void									      \
+  ARRAY_NAME (func) (T *out, __VA_ARGS__, size_t n)			      \
+  {									      \
+    size_t i = array_head (out, sizeof (vt), sizeof (T), n);		      \
+    if (i != 0)								      \
+      ARRAY_CALL_##nargs (func##_part, 0, i);				      \
+    for (; i + (lanes) <= n; i += (lanes))				      \
+      ARRAY_STEP_##nargs (T, vt, kernel, i, (lanes));			      \
+    if (i < n)								      \
+      ARRAY_CALL_##nargs (func##_part, i, n - i);			      \
+  }
+
+#define ARRAY_CALL_v(f, i, count) f (out + (i), in + (i), (count))
+#define ARRAY_CALL_vv(f, i, count) \
+  f (out + (i), in1 + (i), in2 + (i), (count))
+
+#define DEFINE_ARRAY_v(func, T, vt, lanes, kernel)			      \
+  ARRAY_LOOP (func, v, T, vt, lanes, kernel, const T *in)
+
+#define DEFINE_ARRAY_vv(func, T, vt, lanes, kernel)			      \
+  ARRAY_LOOP (func, vv, T, vt, lanes, kernel, const T *in1, const T *in2)
+
+DEFINE_ARRAY_v (sin, double, k_f64, KVLEN, KERNEL_v (sin))
+DEFINE_ARRAY_v (cos, double, k_f64, KVLEN, KERNEL_v (cos))
+DEFINE_ARRAY_v (exp, double, k_f64, KVLEN, KERNEL_v (exp))
+DEFINE_ARRAY_v (log, double, k_f64, KVLEN, KERNEL_v (log))
+DEFINE_ARRAY_vv (pow, double, k_f64, KVLEN, KERNEL_vv (pow))
+DEFINE_ARRAY_v (tan, double, v_f64, VLEN, v_tan)
+DEFINE_ARRAY_v (atan, double, v_f64, VLEN, v_atan)
+DEFINE_ARRAY_vv (atan2, double, v_f64, VLEN, v_atan2)
+DEFINE_ARRAY_v (exp2, double, v_f64, VLEN, v_exp2)
+DEFINE_ARRAY_v (expm1, double, v_f64, VLEN, v_expm1)
+DEFINE_ARRAY_v (log2, double, v_f64, VLEN, v_log2)
+DEFINE_ARRAY_v (log10, double, v_f64, VLEN, v_log10)
+DEFINE_ARRAY_v (log1p, double, v_f64, VLEN, v_log1p)
+DEFINE_ARRAY_v (sinh, double, v_f64, VLEN, v_sinh)
+DEFINE_ARRAY_v (cosh, double, v_f64, VLEN, v_cosh)
+DEFINE_ARRAY_v (tanh, double, v_f64, VLEN, v_tanh)
+DEFINE_ARRAY_v (cbrt, double, v_f64, VLEN, v_cbrt)
+DEFINE_ARRAY_v (erf, double, v_f64, VLEN, v_erf)
+
+DEFINE_ARRAY_v (sinf, float, k_f32, 2 * KVLEN, KERNELF_v (sin))
+DEFINE_ARRAY_v (cosf, float, k_f32, 2 * KVLEN, KERNELF_v (cos))
+DEFINE_ARRAY_v (expf, float, k_f32, 2 * KVLEN, KERNELF_v (exp))
+DEFINE_ARRAY_v (logf, float, k_f32, 2 * KVLEN, KERNELF_v (log))
+DEFINE_ARRAY_vv (powf, float, k_f32, 2 * KVLEN, KERNELF_vv (pow))
+DEFINE_ARRAY_v (tanf, float, v_f32, 2 * VLEN, v_tanf)
+DEFINE_ARRAY_v (atanf, float, v_f32, 2 * VLEN, v_atanf)
+DEFINE_ARRAY_vv (atan2f, float, v_f32, 2 * VLEN, v_atan2f)
+DEFINE_ARRAY_v (exp2f, float, v_f32, 2 * VLEN, v_exp2f)
+DEFINE_ARRAY_v (expm1f, float, v_f32, 2 * VLEN, v_expm1f)
+DEFINE_ARRAY_v (log2f, float, v_f32, 2 * VLEN, v_log2f)
+DEFINE_ARRAY_v (log10f, float, v_f32, 2 * VLEN, v_log10f)
+DEFINE_ARRAY_v (log1pf, float, v_f32, 2 * VLEN, v_log1pf)
+DEFINE_ARRAY_v (sinhf, float, v_f32, 2 * VLEN, v_sinhf)
+DEFINE_ARRAY_v (coshf, float, v_f32, 2 * VLEN, v_coshf)
+DEFINE_ARRAY_v (tanhf, float, v_f32, 2 * VLEN, v_tanhf)
+DEFINE_ARRAY_v (cbrtf, float, v_f32, 2 * VLEN, v_cbrtf)
+DEFINE_ARRAY_v (erff, float, v_f32, 2 * VLEN, v_erff)
@@ -0,0 +1,616 @@
+/* Generic vector kernels for libmvec double functions.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#ifndef D_VECMATH_H
+#define D_VECMATH_H
+
+/* The includer defines VLEN to the number of double lanes of the
+   native vector registers of the ISA the file is compiled for.  The
+   kernels are written with GCC vector extensions and are always
+   inlined, so that no vector is passed through memory.
+
+   Every kernel computes the lanes in a fast domain without branches
+   and recomputes the lanes outside of it (zeros, subnormals, infinities,
+   NaNs and huge arguments) with the scalar libm function, which keeps
+   the special case handling of the scalar code.  The algorithms are
+   the ones of the fdlibm based scalar code, with the branches replaced
+   by selects.  Rounding to integer uses the 0x1.8p52 shift trick, so
+   the results are only correct in round-to-nearest mode, as for the
+   other libmvec functions.  */
+
+#include <math.h>
+#include <stdint.h>
+
+typedef double v_f64 __attribute__ ((vector_size (VLEN * 8)));
+typedef int64_t v_i64 __attribute__ ((vector_size (VLEN * 8)));
+typedef uint64_t v_u64 __attribute__ ((vector_size (VLEN * 8)));
+
+#define V_SIGN_MASK	0x8000000000000000ULL
+#define V_SHIFT		0x1.8p52
+
+static __always_inline v_f64
+v_sel (v_i64 m, v_f64 a, v_f64 b)
+{
+  return (v_f64) ((m & (v_i64) a) | (~m & (v_i64) b));
+}
+
+static __always_inline int
+v_any (v_i64 m)
+{
+  v_i64 r = m;
+  for (int i = 1; i < VLEN; i++)
+    r[0] |= m[i];
+  return r[0] != 0;
+}
+
+static __always_inline v_f64
+v_abs (v_f64 x)
+{
+  return (v_f64) ((v_u64) x & ~V_SIGN_MASK);
+}
+
+/* Return X with the sign bits SIGN flipped.  */
+static __always_inline v_f64
+v_xorsign (v_f64 x, v_u64 sign)
+{
+  return (v_f64) ((v_u64) x ^ sign);
+}
+
+/* Recompute the lanes of R selected by SPECIAL with the scalar
+   function F.  */
+static __always_inline v_f64
+v_call (double (*f) (double), v_f64 x, v_f64 r, v_i64 special)
+{
+  for (int i = 0; i < VLEN; i++)
+    if (special[i])
+      r[i] = f (x[i]);
+  return r;
+}
+
+static __always_inline v_f64
+v_call2 (double (*f) (double, double), v_f64 x, v_f64 y, v_f64 r,
+	 v_i64 special)
+{
+  for (int i = 0; i < VLEN; i++)
+    if (special[i])
+      r[i] = f (x[i], y[i]);
+  return r;
+}
+
+/* Clear the low 32 bits of X.  */
+static __always_inline v_f64
+v_trunc32 (v_f64 x)
+{
+  return (v_f64) ((v_u64) x & 0xffffffff00000000ULL);
+}
+
+/* Round X to the nearest integer, for |X| < 2^51.  */
+static __always_inline v_f64
+v_round (v_f64 x)
+{
+  return (x + V_SHIFT) - V_SHIFT;
+}
+
+/* Return 2^N for the integers N in KD, which must be in [-1022, 1023].  */
+static __always_inline v_f64
+v_pow2 (v_f64 kd)
+{
+  v_u64 ki = (v_u64) (kd + V_SHIFT);
+  return (v_f64) ((ki << 52) + 0x3ff0000000000000ULL);
+}
+
+/* exp and expm1.  The argument is reduced to R = X - N*ln2 with
+   |R| <= ln2/2, and expm1(R) is the Taylor polynomial of degree 13,
+   whose truncation error is below 2^-57.  */
+
+static __always_inline v_f64
+v_expm1_poly (v_f64 r)
+{
+  v_f64 p = (v_f64) {} + 0x1.6124613a86d09p-33;
+  p = p * r + 0x1.1eed8eff8d898p-29;
+  p = p * r + 0x1.ae64567f544e4p-26;
+  p = p * r + 0x1.27e4fb7789f5cp-22;
+  p = p * r + 0x1.71de3a556c734p-19;
+  p = p * r + 0x1.a01a01a01a01ap-16;
+  p = p * r + 0x1.a01a01a01a01ap-13;
+  p = p * r + 0x1.6c16c16c16c17p-10;
+  p = p * r + 0x1.1111111111111p-7;
+  p = p * r + 0x1.5555555555555p-5;
+  p = p * r + 0x1.5555555555555p-3;
+  p = p * r + 0x1p-1;
+  return r + r * r * p;
+}
+
+#define V_INV_LN2	0x1.71547652b82fep0
+#define V_LN2_HI	0x1.62e42fee00000p-1
+#define V_LN2_LO	0x1.a39ef35793c76p-33
+
+/* Return the scale 2^N in *SCALE and expm1(X - N*ln2), for
+   |X| <= 708.  exp(X) is then SCALE + SCALE * P.  */
+static __always_inline v_f64
+v_expm1_reduce (v_f64 x, v_f64 *scale)
+{
+  v_f64 kd = v_round (x * V_INV_LN2);
+  v_f64 r = (x - kd * V_LN2_HI) - kd * V_LN2_LO;
+  *scale = v_pow2 (kd);
+  return v_expm1_poly (r);
+}
+
+static __always_inline v_f64
+v_exp_core (v_f64 x)
+{
+  v_f64 scale;
+  v_f64 p = v_expm1_reduce (x, &scale);
+  return scale + scale * p;
+}
+
+static __always_inline v_f64
+v_expm1_core (v_f64 x)
+{
+  v_f64 scale;
+  v_f64 p = v_expm1_reduce (x, &scale);
+  return (scale - 1.0) + scale * p;
+}
+
+static __always_inline v_f64
+v_expm1 (v_f64 x)
+{
+  v_i64 special = ~(v_abs (x) <= 708.0);
+  v_f64 r = v_expm1_core (v_sel (special, (v_f64) {}, x));
+  /* X itself is the correctly rounded result for tiny X, including
+     the sign of zero.  */
+  r = v_sel (v_abs (x) < 0x1p-54, x, r);
+  if (__glibc_unlikely (v_any (special)))
+    r = v_call (expm1, x, r, special);
+  return r;
+}
+
+static __always_inline v_f64
+v_exp2 (v_f64 x)
+{
+  v_i64 special = ~(v_abs (x) <= 1022.0);
+  v_f64 xx = v_sel (special, (v_f64) {}, x);
+  v_f64 kd = v_round (xx);
+  v_f64 scale = v_pow2 (kd);
+  /* XX - KD is exact; the rounding error of the product only adds
+     0.17 ulp.  */
+  v_f64 p = v_expm1_poly ((xx - kd) * 0x1.62e42fefa39efp-1);
+  v_f64 r = scale + scale * p;
+  if (__glibc_unlikely (v_any (special)))
+    r = v_call (exp2, x, r, special);
+  return r;
+}
+
+/* The hyperbolic functions, from exp and expm1 of |X|.  */
+
+static __always_inline v_f64
+v_sinh (v_f64 x)
+{
+  v_u64 sign = (v_u64) x & V_SIGN_MASK;
+  v_f64 ax = v_abs (x);
+  v_i64 special = ~(ax <= 708.0);
+  v_f64 t = v_expm1_core (v_sel (special, (v_f64) {}, ax));
+  v_f64 r = v_xorsign (0.5 * (t + t / (t + 1.0)), sign);
+  if (__glibc_unlikely (v_any (special)))
+    r = v_call (sinh, x, r, special);
+  return r;
+}
+
+static __always_inline v_f64
+v_cosh (v_f64 x)
+{
+  v_f64 ax = v_abs (x);
+  v_i64 special = ~(ax <= 708.0);
+  v_f64 t = v_exp_core (v_sel (special, (v_f64) {}, ax));
+  v_f64 r = 0.5 * t + 0.5 / t;
+  if (__glibc_unlikely (v_any (special)))
+    r = v_call (cosh, x, r, special);
+  return r;
+}
+
+static __always_inline v_f64
+v_tanh (v_f64 x)
+{
+  v_u64 sign = (v_u64) x & V_SIGN_MASK;
+  v_f64 ax = v_abs (x);
+  v_i64 special = x != x;
+  /* tanh(22) rounds to 1.  */
+  v_f64 t = v_expm1_core (2.0 * v_sel (ax < 22.0, ax, (v_f64) {} + 22.0));
+  v_f64 r = v_xorsign (t / (t + 2.0), sign);
+  if (__glibc_unlikely (v_any (special)))
+    r = v_call (tanh, x, r, special);
+  return r;
+}
+
+/* log and its relatives.  X = 2^K * (1 + F) with 1 + F in
+   [sqrt(2)/2, sqrt(2)), and log(1 + F) = F - HFSQ + S * (HFSQ + R(S))
+   with S = F / (2 + F), as in the scalar code.  The log of the
+   mantissa is returned split into HI + LO, where HI has only 21
+   significant bits, so that it can be scaled exactly.  */
+
+static __always_inline v_f64
+v_log_reduce (v_f64 x, v_f64 *kd, v_f64 *lo)
+{
+  v_u64 u = (v_u64) x + 0x00095f6200000000ULL;
+  /* K + V_SHIFT, built from the exponent bits.  */
+  *kd = (v_f64) ((u >> 52) + (0x4338000000000000ULL - 0x3ff)) - V_SHIFT;
+  v_f64 m = (v_f64) ((u & 0x000fffffffffffffULL) + 0x3fe6a09e00000000ULL);
+  v_f64 f = m - 1.0;
+  v_f64 hfsq = 0.5 * f * f;
+  v_f64 s = f / (2.0 + f);
+  v_f64 z = s * s;
+  v_f64 w = z * z;
+  v_f64 t1 = w * (0x1.999999997fa04p-2
+		  + w * (0x1.c71c51d8e78afp-3 + w * 0x1.39a09d078c69fp-3));
+  v_f64 t2 = z * (0x1.5555555555593p-1
+		  + w * (0x1.2492494229359p-2
+			 + w * (0x1.7466496cb03dep-3
+				+ w * 0x1.2f112df3e5244p-3)));
+  v_f64 r = t2 + t1;
+  v_f64 hi = v_trunc32 (f - hfsq);
+  *lo = (f - hi) - hfsq + s * (hfsq + r);
+  return hi;
+}
+
+/* The fast domain of the log functions: positive normal numbers.  */
+static __always_inline v_i64
+v_log_special (v_f64 x)
+{
+  return ((v_u64) x - 0x0010000000000000ULL)
+	 >= 0x7ff0000000000000ULL - 0x0010000000000000ULL;
+}
+
+/* Return log(X) from the reduction of X, with C added to the low
+   part.  */
+static __always_inline v_f64
+v_log_combine (v_f64 kd, v_f64 hi, v_f64 lo, v_f64 c)
+{
+  v_f64 k_hi = kd * V_LN2_HI;
+  v_f64 w = k_hi + hi;
+  v_f64 e = (k_hi - w) + hi;
+  return w + (e + (lo + c + kd * V_LN2_LO));
+}
+
+static __always_inline v_f64
+v_log2 (v_f64 x)
+{
+  v_i64 special = v_log_special (x);
+  v_f64 kd, lo;
+  v_f64 hi = v_log_reduce (v_sel (special, (v_f64) {} + 1.0, x), &kd, &lo);
+  v_f64 val_hi = hi * 0x1.7154765200000p0;
+  v_f64 val_lo = (lo + hi) * 0x1.705fc2eefa200p-33
+		 + lo * 0x1.7154765200000p0;
+  v_f64 w = kd + val_hi;
+  val_lo += (kd - w) + val_hi;
+  v_f64 r = val_lo + w;
+  if (__glibc_unlikely (v_any (special)))
+    r = v_call (log2, x, r, special);
+  return r;
+}
+
+static __always_inline v_f64
+v_log10 (v_f64 x)
+{
+  v_i64 special = v_log_special (x);
+  v_f64 kd, lo;
+  v_f64 hi = v_log_reduce (v_sel (special, (v_f64) {} + 1.0, x), &kd, &lo);
+  v_f64 val_hi = hi * 0x1.bcb7b15200000p-2;
+  v_f64 y2 = kd * 0x1.34413509f6000p-2;
+  v_f64 val_lo = kd * 0x1.9fef311f12b36p-42
+		 + (lo + hi) * 0x1.b9438ca9aadd5p-36
+		 + lo * 0x1.bcb7b15200000p-2;
+  v_f64 w = y2 + val_hi;
+  val_lo += (y2 - w) + val_hi;
+  v_f64 r = val_lo + w;
+  if (__glibc_unlikely (v_any (special)))
+    r = v_call (log10, x, r, special);
+  return r;
+}
+
+/* log1p(X) is log(U) + (X - (U - 1)) / U with U = 1 + X rounded, the
+   correction term accounting for the rounding error of U.  */
+static __always_inline v_f64
+v_log1p (v_f64 x)
+{
+  v_f64 u = 1.0 + x;
+  v_i64 special = v_log_special (u);
+  u = v_sel (special, (v_f64) {} + 1.0, u);
+  v_f64 xx = v_sel (special, (v_f64) {}, x);
+  v_f64 kd, lo;
+  v_f64 hi = v_log_reduce (u, &kd, &lo);
+  v_f64 r = v_log_combine (kd, hi, lo, (xx - (u - 1.0)) / u);
+  r = v_sel (v_abs (x) < 0x1p-54, x, r);
+  if (__glibc_unlikely (v_any (special)))
+    r = v_call (log1p, x, r, special);
+  return r;
+}
+
+/* atan.  The argument NUM / DEN >= 0 is reduced to T with
+   atan(NUM / DEN) = atan(C) + atan(T) for C in { 0, 0.5, 1, 1.5, inf },
+   and atan(T) is the polynomial of the scalar code.  Passing the
+   quotient unevaluated lets atan2 avoid a rounding error.  In the
+   lanes of NEG the result is pi - atan(NUM / DEN), with the low part
+   of pi added to the correction term: subtracting the rounded atan
+   from pi would lose its low part, which is 1 ulp near pi/2.  */
+
+static __always_inline v_f64
+v_atan_kernel (v_f64 num, v_f64 den, v_f64 q, v_i64 neg)
+{
+  v_i64 m0 = q >= 0x1.cp-2;	/* 7/16  */
+  v_i64 m1 = q >= 0x1.6p-1;	/* 11/16 */
+  v_i64 m2 = q >= 0x1.3p0;	/* 19/16 */
+  v_i64 m3 = q >= 0x1.38p1;	/* 39/16 */
+
+  /* T = (A * NUM - B * DEN) / (B * NUM + A * DEN) for C = 0.5, 1 and
+     1.5, whose numerator is exact, NUM / DEN below and -DEN / NUM
+     above.  The extreme intervals are selected separately, as NUM or
+     DEN may be infinite there.  */
+  v_f64 zero = {};
+  v_f64 a = v_sel (m1, zero + 1.0, zero + 2.0);
+  v_f64 b = v_sel (m2, zero + 1.5, zero + 1.0);
+  v_f64 n = v_sel (m0, a * num - b * den, num);
+  v_f64 d = v_sel (m0, b * num + a * den, den);
+  v_f64 t = v_sel (m3, -den, n) / v_sel (m3, num, d);
+
+  v_f64 hi = v_sel (m3, zero + 0x1.921fb54442d18p0,
+		    v_sel (m2, zero + 0x1.f730bd281f69bp-1,
+			   v_sel (m1, zero + 0x1.921fb54442d18p-1,
+				  v_sel (m0, zero + 0x1.dac670561bb4fp-2,
+					 zero))));
+  v_f64 lo = v_sel (m3, zero + 0x1.1a62633145c07p-54,
+		    v_sel (m2, zero + 0x1.007887af0cbbdp-56,
+			   v_sel (m1, zero + 0x1.1a62633145c07p-55,
+				  v_sel (m0, zero + 0x1.a2b7f222f65e2p-56,
+					 zero))));
+
+  v_f64 z = t * t;
+  v_f64 w = z * z;
+  v_f64 s1 = z * (0x1.555555555550dp-2
+		  + w * (0x1.24924920083ffp-3
+			 + w * (0x1.745cdc54c206ep-4
+				+ w * (0x1.10d66a0d03d51p-4
+				       + w * (0x1.97b4b24760debp-5
+					      + w * 0x1.0ad3ae322da11p-6)))));
+  v_f64 s2 = w * (-0x1.999999998ebc4p-3
+		  + w * (-0x1.c71c6fe231671p-4
+			 + w * (-0x1.3b0f2af749a6dp-4
+				+ w * (-0x1.dde2d52defd9ap-5
+				       + w * -0x1.2b4442c6a6c2fp-5))));
+  v_f64 c = (t * (s1 + s2) - lo) - t;
+  hi = v_sel (neg, 0x1.921fb54442d18p1 - hi, hi);
+  c = v_sel (neg, -c - 0x1.1a62633145c07p-53, c);
+  return hi - c;
+}
+
+static __always_inline v_f64
+v_atan (v_f64 x)
+{
+  v_u64 sign = (v_u64) x & V_SIGN_MASK;
+  v_f64 ax = v_abs (x);
+  /* Infinities reduce to T = -0 and NaNs propagate, so there is no
+     special case.  */
+  return v_xorsign (v_atan_kernel (ax, (v_f64) {} + 1.0, ax, (v_i64) {}),
+		    sign);
+}
+
+static __always_inline v_f64
+v_atan2 (v_f64 y, v_f64 x)
+{
+  v_u64 sign_y = (v_u64) y & V_SIGN_MASK;
+  v_i64 x_neg = (v_i64) x < 0;
+  v_f64 ay = v_abs (y);
+  v_f64 ax = v_abs (x);
+  v_f64 q = ay / ax;
+  /* Zeros and infinities on both sides, and NaNs.  */
+  v_i64 special = q != q;
+  q = v_sel (special, (v_f64) {}, q);
+  /* pi - atan(AY / AX) for negative X, including -0.  */
+  v_f64 a = v_atan_kernel (ay, ax, q, x_neg);
+  v_f64 r = v_xorsign (a, sign_y);
+  if (__glibc_unlikely (v_any (special)))
+    r = v_call2 (atan2, y, x, r, special);
+  return r;
+}
+
+/* tan.  The argument is reduced by multiples of pi/2 split in three
+   parts, the first two of 33 bits, which is accurate for |X| < 2^20,
+   and the reduced argument Y_HI + Y_LO goes through the polynomial of
+   the fdlibm tan kernel.  */
+
+static __always_inline v_f64
+v_tan (v_f64 x)
+{
+  v_i64 special = ~(v_abs (x) < 0x1p20);
+  v_f64 xx = v_sel (special, (v_f64) {}, x);
+
+  v_f64 kd = v_round (xx * 0x1.45f306dc9c883p-1);
+  v_i64 odd = ((v_i64) (kd + V_SHIFT) & 1) != 0;
+  v_f64 r1 = xx - kd * 0x1.921fb54400000p0;
+  v_f64 w = kd * 0x1.0b4611a600000p-34;
+  v_f64 r2 = r1 - w;
+  v_f64 bb = r2 - r1;
+  v_f64 e = (r1 - (r2 - bb)) - (w + bb);
+  v_f64 ylo = e - kd * 0x1.3198a2e037073p-69;
+  v_f64 yhi = r2 + ylo;
+  ylo -= yhi - r2;
+
+  /* For |Y| >= 0.6744, tan(Y) is computed from tan(pi/4 - |Y|).  */
+  v_i64 big = v_abs (yhi) >= 0x1.59428p-1;
+  v_u64 sign = (v_u64) yhi & V_SIGN_MASK;
+  v_f64 xb = (0x1.921fb54442d18p-1 - v_abs (yhi))
+	     + (0x1.1a62633145c07p-55 - v_xorsign (ylo, sign));
+  v_f64 xs = v_sel (big, xb, yhi);
+  v_f64 ys = v_sel (big, (v_f64) {}, ylo);
+
+  v_f64 z = xs * xs;
+  w = z * z;
+  v_f64 p = 0x1.111111110fe7ap-3
+	    + w * (0x1.664f48406d637p-6
+		   + w * (0x1.d6d22c9560328p-9
+			  + w * (0x1.344d8f2f26501p-11
+				 + w * (0x1.47e88a03792a6p-14
+					+ w * -0x1.375cbdb605373p-16))));
+  v_f64 v = z * (0x1.ba1ba1bb341fep-5
+		 + w * (0x1.226e3e96e8493p-7
+			+ w * (0x1.7dbc8fee08315p-10
+			       + w * (0x1.026f71a8d1068p-12
+				      + w * (0x1.2b80f32f0a7e9p-14
+					     + w * 0x1.b2a7074bf7ad4p-16)))));
+  v_f64 s = z * xs;
+  p = ys + z * (s * (p + v) + ys);
+  p += 0x1.5555555555563p-2 * s;
+  w = xs + p;
+
+  /* The big case, where the result is tan(pi/4 - Y) or its negative
+     inverse.  */
+  v_f64 iy = v_sel (odd, (v_f64) {} - 1.0, (v_f64) {} + 1.0);
+  v_f64 rb = v_xorsign (iy - 2.0 * (xs - (w * w / (w + iy) - p)), sign);
+
+  /* -1 / (XS + P), with the reciprocal refined from split parts.  */
+  v_f64 zt = v_trunc32 (w);
+  v_f64 vt = p - (zt - xs);
+  v_f64 aa = -1.0 / w;
+  v_f64 t = v_trunc32 (aa);
+  v_f64 st = 1.0 + t * zt;
+  v_f64 rinv = t + aa * (st + t * vt);
+
+  v_f64 r = v_sel (big, rb, v_sel (odd, rinv, w));
+  /* X is the correctly rounded tan for |X| < 2^-27, and this gets the
+     sign of zero right.  */
+  r = v_sel (v_abs (x) < 0x1p-27, x, r);
+  if (__glibc_unlikely (v_any (special)))
+    r = v_call (tan, x, r, special);
+  return r;
+}
+
+/* cbrt.  A 5 bit accurate estimate from the exponent bits is improved
+   to 23 bits by a polynomial and then to full precision by one Newton
+   step, as in the scalar code.  */
+static __always_inline v_f64
+v_cbrt (v_f64 x)
+{
+  v_u64 sign = (v_u64) x & V_SIGN_MASK;
+  v_f64 ax = v_abs (x);
+  v_i64 special = v_log_special (ax);
+  ax = v_sel (special, (v_f64) {} + 1.0, ax);
+
+  v_u64 hx = (v_u64) ax >> 32;
+  v_f64 t = (v_f64) ((((hx * 0xaaaaaaabULL) >> 33) + 715094163) << 32);
+  v_f64 r = (t * t) * (t / ax);
+  t = t * ((0x1.e03e60f61e692p0
+	    + r * (-0x1.e28e092f02420p0 + r * 0x1.9f1604a49d6c2p0))
+	   + ((r * r * r)
+	      * (-0x1.844cbbee751d9p-1 + r * 0x1.2b000d4e4edd7p-3)));
+  t = (v_f64) (((v_u64) t + 0x80000000ULL) & 0xffffffffc0000000ULL);
+  v_f64 s = t * t;
+  r = ax / s;
+  v_f64 w = t + t;
+  r = (r - t) / (w + r);
+  t = t + t * r;
+
+  r = v_xorsign (t, sign);
+  if (__glibc_unlikely (v_any (special)))
+    r = v_call (cbrt, x, r, special);
+  return r;
+}
+
+/* erf, with the rational approximations of the scalar code on
+   [0, 0.84375), [0.84375, 1.25) and [1.25, 6).  Each one is only
+   evaluated if some lane needs it.  */
+static __always_inline v_f64
+v_erf (v_f64 x)
+{
+  v_u64 sign = (v_u64) x & V_SIGN_MASK;
+  v_f64 ax = v_abs (x);
+  v_i64 special = x != x;
+  v_i64 m1 = ax < 0.84375;
+  v_i64 m2 = ~m1 & (ax < 1.25);
+  v_i64 m3 = ~m1 & ~m2 & (ax < 6.0);
+  v_f64 r = (v_f64) {} + 1.0;
+
+  if (v_any (m1))
+    {
+      v_f64 z = ax * ax;
+      v_f64 z2 = z * z;
+      v_f64 z4 = z2 * z2;
+      v_f64 p = (0x1.06eba8214db68p-3 + z * -0x1.4cd7d691cb913p-2)
+		+ z2 * (-0x1.d2a51dbd7194fp-6 + z * -0x1.7a291236668e4p-8)
+		+ z4 * -0x1.8ead6120016acp-16;
+      v_f64 q = (1.0 + z * 0x1.97779cddadc09p-2)
+		+ z2 * (0x1.0a54c5536cebap-4 + z * 0x1.4d022c4d36b0fp-8)
+		+ z4 * (0x1.15dc9221c1a10p-13 + z * -0x1.09c4342a26120p-18);
+      r = v_sel (m1, ax + ax * (p / q), r);
+    }
+
+  if (v_any (m2))
+    {
+      v_f64 s = ax - 1.0;
+      v_f64 s2 = s * s;
+      v_f64 s4 = s2 * s2;
+      v_f64 s6 = s4 * s2;
+      v_f64 p = (-0x1.359b8bef77538p-9 + s * 0x1.a8d00ad92b34dp-2)
+		+ s2 * (-0x1.7d240fbb8c3f1p-2 + s * 0x1.45fca805120e4p-2)
+		+ s4 * (-0x1.c63983d3e28ecp-4 + s * 0x1.22a36599795ebp-5)
+		+ s6 * -0x1.1bf380a96073fp-9;
+      v_f64 q = (1.0 + s * 0x1.b3e6618eee323p-4)
+		+ s2 * (0x1.14af092eb6f33p-1 + s * 0x1.2635cd99fe9a7p-4)
+		+ s4 * (0x1.02660e763351fp-3 + s * 0x1.bedc26b51dd1cp-7)
+		+ s6 * 0x1.88b545735151dp-7;
+      r = v_sel (m2, 0x1.b0ac160000000p-1 + p / q, r);
+    }
+
+  if (v_any (m3))
+    {
+      v_f64 xx = v_sel (m3, ax, (v_f64) {} + 1.25);
+      v_f64 s = 1.0 / (xx * xx);
+      v_f64 s2 = s * s;
+      v_f64 s4 = s2 * s2;
+      v_f64 s6 = s4 * s2;
+      v_f64 s8 = s4 * s4;
+      v_i64 mb = xx >= 0x1.6db6dp1;	/* 1/0.35 */
+      v_f64 ra = (-0x1.43412600d6435p-7 + s * -0x1.63416e4ba7360p-1)
+		 + s2 * (-0x1.51e0441b0e726p3 + s * -0x1.f300ae4cba38dp5)
+		 + s4 * (-0x1.44cb184282266p7 + s * -0x1.7135cebccabb2p7)
+		 + s6 * (-0x1.4526557e4d2f2p6 + s * -0x1.3a0efc69ac25cp3);
+      v_f64 sa = (1.0 + s * 0x1.3a6b9bd707687p4)
+		 + s2 * (0x1.1350c526ae721p7 + s * 0x1.b290dd58a1a71p8)
+		 + s4 * (0x1.42b1921ec2868p9 + s * 0x1.ad02157700314p8)
+		 + s6 * (0x1.b28a3ee48ae2cp6 + s * 0x1.a47ef8e484a93p2)
+		 + s8 * -0x1.eeff2ee749a62p-5;
+      v_f64 rb = (-0x1.4341239e86f4ap-7 + s * -0x1.993ba70c285dep-1)
+		 + s2 * (-0x1.1c209555f995ap4 + s * -0x1.4145d43c5ed98p7)
+		 + s4 * (-0x1.3ec881375f228p9 + s * -0x1.004616a2e5992p10)
+		 + s6 * -0x1.e384e9bdc383fp8;
+      v_f64 sb = (1.0 + s * 0x1.e568b261d5190p4)
+		 + s2 * (0x1.45cae221b9f0ap8 + s * 0x1.802eb189d5118p10)
+		 + s4 * (0x1.8ffb7688c246ap11 + s * 0x1.3f219cedf3be6p11)
+		 + s6 * (0x1.da874e79fe763p8 + s * -0x1.670e242712d62p4);
+      v_f64 z = v_trunc32 (xx);
+      v_f64 e = v_exp_core (-z * z - 0.5625)
+		* v_exp_core ((z - xx) * (z + xx)
+			      + v_sel (mb, rb / sb, ra / sa));
+      r = v_sel (m3, 1.0 - e / xx, r);
+    }
+
+  r = v_xorsign (r, sign);
+  if (__glibc_unlikely (v_any (special)))
+    r = v_call (erf, x, r, special);
+  return r;
+}
+
+#endif
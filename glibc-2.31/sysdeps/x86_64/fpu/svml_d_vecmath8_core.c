@@ -1,5 +1,6 @@
-/* Function expf vectorized with AVX2, wrapper version.
-   Copyright (C) 2014-2020 Free Software Foundation, Inc.
+/* Functions tan, atan, atan2, exp2, log2, log10, log1p, expm1, sinh,
+   cosh, tanh, cbrt and erf vectorized with AVX-512.
+   Copyright (C) 2020 Free Software Foundation, Inc.
    This file is part of the GNU C Library.
 
    The GNU C Library is free software; you can redistribute it and/or
@@ -16,14 +17,8 @@
    License along with the GNU C Library; if not, see
    <https://www.gnu.org/licenses/>.  */
 
-#include <sysdep.h>
-#include "svml_s_wrapper_impl.h"
+#define VLEN 8
+#define VECTOR_NAME_v(func) _ZGVeN8v_##func
+#define VECTOR_NAME_vv(func) _ZGVeN8vv_##func
 
-	.text
-ENTRY (_ZGVdN8v_expf)
-WRAPPER_IMPL_AVX _ZGVbN4v_expf
-END (_ZGVdN8v_expf)
-
-#ifndef USE_MULTIARCH
- libmvec_hidden_def (_ZGVdN8v_expf)
-#endif
+#include "svml_d_vecmath_core.h"
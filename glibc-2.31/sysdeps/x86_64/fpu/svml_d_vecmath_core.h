@@ -0,0 +1,55 @@
+/* Template for the libmvec double functions with generic vector kernels.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+/* The includer defines VLEN, and VECTOR_NAME_v and VECTOR_NAME_vv to
+   build the vector ABI names of the one and two argument functions for
+   its ISA.  Unlike cos, sin, sincos, exp, log and pow, these functions
+   have no __DECL_SIMD_* declarations in <math.h>, so programs call the
+   variants directly by these names.  */
+
+#include "svml_d_vecmath.h"
+
+#define DEFINE_VECTOR_v(func)						      \
+  v_f64 VECTOR_NAME_v (func) (v_f64);					      \
+  v_f64									      \
+  VECTOR_NAME_v (func) (v_f64 x)					      \
+  {									      \
+    return v_##func (x);						      \
+  }
+
+#define DEFINE_VECTOR_vv(func)						      \
+  v_f64 VECTOR_NAME_vv (func) (v_f64, v_f64);				      \
+  v_f64									      \
+  VECTOR_NAME_vv (func) (v_f64 x, v_f64 y)				      \
+  {									      \
+    return v_##func (x, y);						      \
+  }
+
+DEFINE_VECTOR_v (tan)
+DEFINE_VECTOR_v (atan)
+DEFINE_VECTOR_vv (atan2)
+DEFINE_VECTOR_v (exp2)
+DEFINE_VECTOR_v (log2)
+DEFINE_VECTOR_v (log10)
+DEFINE_VECTOR_v (log1p)
+DEFINE_VECTOR_v (expm1)
+DEFINE_VECTOR_v (sinh)
+DEFINE_VECTOR_v (cosh)
+DEFINE_VECTOR_v (tanh)
+DEFINE_VECTOR_v (cbrt)
+DEFINE_VECTOR_v (erf)
@@ -0,0 +1,315 @@
+/* Generic vector kernels for libmvec float functions.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#ifndef S_VECMATHF_H
+#define S_VECMATHF_H
+
+/* The includer defines VLEN to the number of double lanes of its ISA.
+   A float vector holds 2 * VLEN lanes; both halves are widened to
+   double and go through the double kernels, whose accuracy leaves the
+   float results within 1 ulp.
+
+   expf, logf and powf instead use the algorithms and tables of the
+   scalar functions in sysdeps/ieee754/flt-32, with the same order of
+   operations, so that they return the same results as the scalar
+   functions bit for bit.  */
+
+#include "svml_d_vecmath.h"
+#include <sysdeps/ieee754/flt-32/math_config.h>
+
+typedef float v_f32 __attribute__ ((vector_size (VLEN * 8)));
+typedef int32_t v_i32 __attribute__ ((vector_size (VLEN * 8)));
+typedef uint32_t v_u32 __attribute__ ((vector_size (VLEN * 8)));
+
+static __always_inline void
+v_widen (v_f32 x, v_f64 *lo, v_f64 *hi)
+{
+  for (int i = 0; i < VLEN; i++)
+    {
+      (*lo)[i] = x[i];
+      (*hi)[i] = x[i + VLEN];
+    }
+}
+
+static __always_inline v_f32
+v_narrow (v_f64 lo, v_f64 hi)
+{
+  v_f32 r;
+  for (int i = 0; i < VLEN; i++)
+    {
+      r[i] = lo[i];
+      r[i + VLEN] = hi[i];
+    }
+  return r;
+}
+
+#define DEFINE_VF_v(func)						      \
+  static __always_inline v_f32						      \
+  v_##func##f (v_f32 x)							      \
+  {									      \
+    v_f64 lo, hi;							      \
+    v_widen (x, &lo, &hi);						      \
+    return v_narrow (v_##func (lo), v_##func (hi));			      \
+  }
+
+#define DEFINE_VF_vv(func)						      \
+  static __always_inline v_f32						      \
+  v_##func##f (v_f32 x, v_f32 y)					      \
+  {									      \
+    v_f64 xlo, xhi, ylo, yhi;						      \
+    v_widen (x, &xlo, &xhi);						      \
+    v_widen (y, &ylo, &yhi);						      \
+    return v_narrow (v_##func (xlo, ylo), v_##func (xhi, yhi));	      \
+  }
+
+DEFINE_VF_v (tan)
+DEFINE_VF_v (atan)
+DEFINE_VF_vv (atan2)
+DEFINE_VF_v (exp2)
+DEFINE_VF_v (log2)
+DEFINE_VF_v (log10)
+DEFINE_VF_v (log1p)
+DEFINE_VF_v (expm1)
+DEFINE_VF_v (sinh)
+DEFINE_VF_v (cosh)
+DEFINE_VF_v (tanh)
+DEFINE_VF_v (cbrt)
+DEFINE_VF_v (erf)
+
+static __always_inline int
+v_anyf (v_i32 m)
+{
+  v_i32 r = m;
+  for (int i = 1; i < 2 * VLEN; i++)
+    r[0] |= m[i];
+  return r[0] != 0;
+}
+
+/* Recompute the lanes of R selected by SPECIAL with the scalar
+   function F.  */
+static __always_inline v_f32
+v_callf (float (*f) (float), v_f32 x, v_f32 r, v_i32 special)
+{
+  for (int i = 0; i < 2 * VLEN; i++)
+    if (special[i])
+      r[i] = f (x[i]);
+  return r;
+}
+
+static __always_inline v_f32
+v_callf2 (float (*f) (float, float), v_f32 x, v_f32 y, v_f32 r,
+	  v_i32 special)
+{
+  for (int i = 0; i < 2 * VLEN; i++)
+    if (special[i])
+      r[i] = f (x[i], y[i]);
+  return r;
+}
+
+static __always_inline void
+v_widen_i32 (v_i32 x, v_f64 *lo, v_f64 *hi)
+{
+  for (int i = 0; i < VLEN; i++)
+    {
+      (*lo)[i] = x[i];
+      (*hi)[i] = x[i + VLEN];
+    }
+}
+
+/* Return 2^(KI/N) for the integers KI, which exp2f_data.tab holds
+   without the integer part of the exponent.  */
+static __always_inline v_f64
+v_exp2f_scale (v_u64 ki)
+{
+  v_u64 t;
+  for (int i = 0; i < VLEN; i++)
+    t[i] = __exp2f_data.tab[ki[i] % (1 << EXP2F_TABLE_BITS)];
+  t += ki << (52 - EXP2F_TABLE_BITS);
+  return (v_f64) t;
+}
+
+/* The fast path of e_expf.c on the widened lanes XD.  */
+static __always_inline v_f64
+v_expf_inline (v_f64 xd)
+{
+  const double *c = __exp2f_data.poly_scaled;
+  v_f64 z, kd, r, r2, y, s;
+  v_u64 ki;
+
+  z = __exp2f_data.invln2_scaled * xd;
+  kd = z + __exp2f_data.shift;
+  ki = (v_u64) kd;
+  kd -= __exp2f_data.shift;
+  r = z - kd;
+
+  s = v_exp2f_scale (ki);
+  z = c[0] * r + c[1];
+  r2 = r * r;
+  y = c[2] * r + 1;
+  y = z * r2 + y;
+  y = y * s;
+  return y;
+}
+
+static __always_inline v_f32
+v_expf (v_f32 x)
+{
+  v_u32 ix = (v_u32) x;
+  v_i32 special = (ix >> 20 & 0x7ff) >= (asuint (88.0f) >> 20);
+  v_f64 lo, hi;
+
+  v_widen (x, &lo, &hi);
+  v_f32 r = v_narrow (v_expf_inline (lo), v_expf_inline (hi));
+  if (__glibc_unlikely (v_anyf (special)))
+    r = v_callf (expf, x, r, special);
+  return r;
+}
+
+#define V_LOGF_OFF 0x3f330000
+
+/* Split the lanes IX of x = 2^K Z with Z in [OFF, 2*OFF], as logf and
+   powf do, and return the index of the subinterval of Z in the table
+   with TABLE_BITS index bits.  */
+static __always_inline v_u32
+v_logf_reduce (v_u32 ix, int table_bits, v_f64 *zlo, v_f64 *zhi,
+	       v_f64 *klo, v_f64 *khi)
+{
+  v_u32 tmp = ix - V_LOGF_OFF;
+  v_u32 top = tmp & 0xff800000;
+  v_i32 k = (v_i32) top >> 23;
+
+  v_widen ((v_f32) (ix - top), zlo, zhi);
+  v_widen_i32 (k, klo, khi);
+  return (tmp >> (23 - table_bits)) % (1 << table_bits);
+}
+
+/* The fast path of e_logf.c on the lanes BASE to BASE + VLEN - 1.  */
+static __always_inline v_f64
+v_logf_inline (v_f64 z, v_f64 k, v_u32 i, int base)
+{
+  const double *a = __logf_data.poly;
+  v_f64 r, r2, y, y0, invc, logc;
+
+  for (int j = 0; j < VLEN; j++)
+    {
+      invc[j] = __logf_data.tab[i[base + j]].invc;
+      logc[j] = __logf_data.tab[i[base + j]].logc;
+    }
+
+  /* log(x) = log1p(z/c-1) + log(c) + k*Ln2 */
+  r = z * invc - 1;
+  y0 = logc + k * __logf_data.ln2;
+
+  r2 = r * r;
+  y = a[1] * r + a[2];
+  y = a[0] * r2 + y;
+  y = y * r2 + (y0 + r);
+  return y;
+}
+
+static __always_inline v_f32
+v_logf (v_f32 x)
+{
+  v_u32 ix = (v_u32) x;
+  /* x < 0x1p-126 or inf or nan, and x == 1 for which logf returns
+     exactly 0.  */
+  v_i32 special = ((ix - 0x00800000 >= 0x7f800000 - 0x00800000)
+		   | (ix == 0x3f800000));
+  v_f64 zlo, zhi, klo, khi;
+
+  v_u32 i = v_logf_reduce (ix, LOGF_TABLE_BITS, &zlo, &zhi, &klo, &khi);
+  v_f32 r = v_narrow (v_logf_inline (zlo, klo, i, 0),
+		      v_logf_inline (zhi, khi, i, VLEN));
+  if (__glibc_unlikely (v_anyf (special)))
+    r = v_callf (logf, x, r, special);
+  return r;
+}
+
+/* The fast path of e_powf.c on the lanes BASE to BASE + VLEN - 1,
+   for a positive normal x and a non-zero finite y.  Set SPECIAL for
+   the lanes where |y*log2(x)| >= 126.  */
+static __always_inline v_f64
+v_powf_inline (v_f64 z, v_f64 k, v_u32 i, int base, v_f64 yd,
+	       v_i64 *special)
+{
+  const double *a = __powf_log2_data.poly;
+  const double *c = __exp2f_data.poly;
+  v_f64 r, r2, r4, p, q, y, y0, invc, logc, logx, ylogx, kd, s;
+
+  for (int j = 0; j < VLEN; j++)
+    {
+      invc[j] = __powf_log2_data.tab[i[base + j]].invc;
+      logc[j] = __powf_log2_data.tab[i[base + j]].logc;
+    }
+
+  /* log2(x) = log1p(z/c-1)/ln2 + log2(c) + k */
+  r = z * invc - 1;
+  y0 = logc + k;
+
+  r2 = r * r;
+  y = a[0] * r + a[1];
+  p = a[2] * r + a[3];
+  r4 = r2 * r2;
+  q = a[4] * r + y0;
+  q = p * r2 + q;
+  logx = y * r4 + q;
+
+  ylogx = yd * logx;
+  *special = ((v_u64) ylogx >> 47 & 0xffff) >= asuint64 (126.0) >> 47;
+
+  /* exp2(x) = 2^(k/N) * 2^r ~= s * (C0*r^3 + C1*r^2 + C2*r + 1) */
+  kd = ylogx + __exp2f_data.shift_scaled;
+  s = v_exp2f_scale ((v_u64) kd);
+  kd -= __exp2f_data.shift_scaled;
+  r = ylogx - kd;
+
+  z = c[0] * r + c[1];
+  r2 = r * r;
+  y = c[2] * r + 1;
+  y = z * r2 + y;
+  y = y * s;
+  return y;
+}
+
+static __always_inline v_f32
+v_powf (v_f32 x, v_f32 y)
+{
+  v_u32 ix = (v_u32) x;
+  v_u32 iy = (v_u32) y;
+  /* x < 0x1p-126 or inf or nan, or y is 0 or inf or nan.  */
+  v_i32 special = ((ix - 0x00800000 >= 0x7f800000 - 0x00800000)
+		   | (2 * iy - 1 >= 2u * 0x7f800000 - 1));
+  v_f64 zlo, zhi, klo, khi, ylo, yhi;
+  v_i64 slo, shi;
+
+  v_u32 i = v_logf_reduce (ix, POWF_LOG2_TABLE_BITS, &zlo, &zhi, &klo,
+			   &khi);
+  v_widen (y, &ylo, &yhi);
+  v_f32 r = v_narrow (v_powf_inline (zlo, klo, i, 0, ylo, &slo),
+		      v_powf_inline (zhi, khi, i, VLEN, yhi, &shi));
+  for (int j = 0; j < VLEN; j++)
+    {
+      special[j] |= slo[j];
+      special[j + VLEN] |= shi[j];
+    }
+  if (__glibc_unlikely (v_anyf (special)))
+    r = v_callf2 (powf, x, y, r, special);
+  return r;
+}
+
+#endif
@@ -0,0 +1,24 @@
+/* Functions tanf, atanf, atan2f, exp2f, log2f, log10f, log1pf, expm1f,
+   sinhf, coshf, tanhf, cbrtf and erff vectorized with AVX2.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#define VLEN 4
+#define VECTOR_NAME_v(func) _ZGVdN8v_##func
+#define VECTOR_NAME_vv(func) _ZGVdN8vv_##func
+
+#include "svml_s_vecmathf_core.h"
@@ -0,0 +1,110 @@
+/* Template for the libmvec float functions with generic vector kernels.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+/* The includer defines VLEN to the number of double lanes of its ISA,
+   and VECTOR_NAME_v and VECTOR_NAME_vv as for the double functions.  */
+
+#include "svml_s_vecmathf.h"
+#ifdef USE_MULTIARCH
+# include <init-arch.h>
+#endif
+
+#define DEFINE_VECTOR_v(func)						      \
+  v_f32 VECTOR_NAME_v (func##f) (v_f32);				      \
+  v_f32									      \
+  VECTOR_NAME_v (func##f) (v_f32 x)					      \
+  {									      \
+    return v_##func##f (x);						      \
+  }
+
+#define DEFINE_VECTOR_vv(func)						      \
+  v_f32 VECTOR_NAME_vv (func##f) (v_f32, v_f32);			      \
+  v_f32									      \
+  VECTOR_NAME_vv (func##f) (v_f32 x, v_f32 y)				      \
+  {									      \
+    return v_##func##f (x, y);						      \
+  }
+
+DEFINE_VECTOR_v (tan)
+DEFINE_VECTOR_v (atan)
+DEFINE_VECTOR_vv (atan2)
+DEFINE_VECTOR_v (exp2)
+DEFINE_VECTOR_v (log2)
+DEFINE_VECTOR_v (log10)
+DEFINE_VECTOR_v (log1p)
+DEFINE_VECTOR_v (expm1)
+DEFINE_VECTOR_v (sinh)
+DEFINE_VECTOR_v (cosh)
+DEFINE_VECTOR_v (tanh)
+DEFINE_VECTOR_v (cbrt)
+DEFINE_VECTOR_v (erf)
+
+/* expf, logf and powf return the same results as the scalar functions.
+   With multiarch those use FMA when AVX2 and FMA are usable, so the
+   vector functions are built with and without FMA and selected by the
+   same test.  AVX-512F has its own FMA instructions, so contraction is
+   disabled explicitly for the build without FMA.  */
+#define NO_FMA __attribute__ ((__optimize__ ("-ffp-contract=off")))
+
+#ifdef USE_MULTIARCH
+static inline int
+use_fma (void)
+{
+  const struct cpu_features* cpu_features = __get_cpu_features ();
+
+  return (CPU_FEATURES_ARCH_P (cpu_features, FMA_Usable)
+	  && CPU_FEATURES_ARCH_P (cpu_features, AVX2_Usable));
+}
+
+# define DEFINE_VECTOR_FMA(name, func, params, args)			      \
+  static v_f32 NO_FMA							      \
+  func##_sse2 params							      \
+  {									      \
+    return v_##func args;						      \
+  }									      \
+  static v_f32 __attribute__ ((target ("avx2,fma")))			      \
+  func##_fma params							      \
+  {									      \
+    return v_##func args;						      \
+  }									      \
+  libc_ifunc (name, use_fma () ? func##_fma : func##_sse2);
+#else
+# define DEFINE_VECTOR_FMA(name, func, params, args)			      \
+  v_f32 NO_FMA								      \
+  name params								      \
+  {									      \
+    return v_##func args;						      \
+  }
+#endif
+
+#define DEFINE_VECTOR_FMA_v(func)					      \
+  v_f32 VECTOR_NAME_v (func##f) (v_f32);				      \
+  libmvec_hidden_proto (VECTOR_NAME_v (func##f))			      \
+  DEFINE_VECTOR_FMA (VECTOR_NAME_v (func##f), func##f, (v_f32 x), (x))	      \
+  libmvec_hidden_def (VECTOR_NAME_v (func##f))
+
+#define DEFINE_VECTOR_FMA_vv(func)					      \
+  v_f32 VECTOR_NAME_vv (func##f) (v_f32, v_f32);			      \
+  libmvec_hidden_proto (VECTOR_NAME_vv (func##f))			      \
+  DEFINE_VECTOR_FMA (VECTOR_NAME_vv (func##f), func##f, (v_f32 x, v_f32 y), \
+		     (x, y))						      \
+  libmvec_hidden_def (VECTOR_NAME_vv (func##f))
+
+DEFINE_VECTOR_FMA_v (exp)
+DEFINE_VECTOR_FMA_v (log)
+DEFINE_VECTOR_FMA_vv (pow)
@@ -0,0 +1,137 @@
+/* Test that the vector expf, logf and powf match the scalar functions.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <support/check.h>
+
+/* The vector variants of expf, logf and powf use the algorithms of
+   the scalar functions and must return the same results, bit for bit,
+   for every ISA the processor supports.  */
+
+typedef float v4sf __attribute__ ((vector_size (16)));
+typedef float v8sf __attribute__ ((vector_size (32)));
+typedef float v16sf __attribute__ ((vector_size (64)));
+
+extern v4sf _ZGVbN4v_expf (v4sf);
+extern v4sf _ZGVbN4v_logf (v4sf);
+extern v4sf _ZGVbN4vv_powf (v4sf, v4sf);
+extern v8sf _ZGVcN8v_expf (v8sf);
+extern v8sf _ZGVcN8v_logf (v8sf);
+extern v8sf _ZGVcN8vv_powf (v8sf, v8sf);
+extern v8sf _ZGVdN8v_expf (v8sf);
+extern v8sf _ZGVdN8v_logf (v8sf);
+extern v8sf _ZGVdN8vv_powf (v8sf, v8sf);
+extern v16sf _ZGVeN16v_expf (v16sf);
+extern v16sf _ZGVeN16v_logf (v16sf);
+extern v16sf _ZGVeN16vv_powf (v16sf, v16sf);
+
+/* Walk every STRIDE-th bit pattern, so that all exponents and both
+   signs are covered, including the special values.  */
+#define STRIDE 4099
+#define POW_COUNT 200000
+
+static int
+same (float a, float b)
+{
+  uint32_t ia, ib;
+  memcpy (&ia, &a, sizeof (ia));
+  memcpy (&ib, &b, sizeof (ib));
+  return ia == ib || (isnan (a) && isnan (b));
+}
+
+static void
+check (const char *isa, const char *name, float (*f) (float),
+       float (*f2) (float, float), const float *x, const float *y,
+       const float *r, int lanes)
+{
+  for (int i = 0; i < lanes; i++)
+    {
+      float expect = f != NULL ? f (x[i]) : f2 (x[i], y[i]);
+      if (!same (r[i], expect))
+	{
+	  support_record_failure ();
+	  printf ("error: %s %s (%a, %a): %a, expected %a\n", isa, name,
+		  x[i], y[i], r[i], expect);
+	}
+    }
+}
+
+/* Define the test of the variant with prefix ISA and LANES lanes of
+   type VT.  */
+#define TEST_ISA(isa, vt, lanes, features)				\
+  static void __attribute__ ((target (features)))			\
+  test_##isa (void)							\
+  {									\
+    vt x, y, r;								\
+									\
+    for (uint64_t b = 0; b < (1ULL << 32); b += STRIDE * (lanes))	\
+      {									\
+	for (int i = 0; i < (lanes); i++)				\
+	  {								\
+	    uint32_t u = b + (uint64_t) i * STRIDE;			\
+	    memcpy (&x[i], &u, sizeof (u));				\
+	  }								\
+	r = _ZGV##isa##N##lanes##v_expf (x);				\
+	check (#isa, "expf", expf, NULL, (float *) &x, (float *) &x,	\
+	       (float *) &r, (lanes));					\
+	r = _ZGV##isa##N##lanes##v_logf (x);				\
+	check (#isa, "logf", logf, NULL, (float *) &x, (float *) &x,	\
+	       (float *) &r, (lanes));					\
+      }									\
+									\
+    srandom (1);							\
+    for (int n = 0; n < POW_COUNT; n += (lanes))			\
+      {									\
+	for (int i = 0; i < (lanes); i++)				\
+	  {								\
+	    x[i] = ldexpf (random () / (float) RAND_MAX,		\
+			   random () % 16 - 8);				\
+	    y[i] = (random () / (float) RAND_MAX - 0.5f) * 200.0f;	\
+	  }								\
+	r = _ZGV##isa##N##lanes##vv_powf (x, y);			\
+	check (#isa, "powf", NULL, powf, (float *) &x, (float *) &y,	\
+	       (float *) &r, (lanes));					\
+      }									\
+  }
+
+TEST_ISA (b, v4sf, 4, "sse4.1")
+TEST_ISA (c, v8sf, 8, "avx")
+TEST_ISA (d, v8sf, 8, "avx2")
+TEST_ISA (e, v16sf, 16, "avx512f")
+
+static int
+do_test (void)
+{
+  __builtin_cpu_init ();
+  if (__builtin_cpu_supports ("sse4.1"))
+    test_b ();
+  if (__builtin_cpu_supports ("avx"))
+    test_c ();
+  if (__builtin_cpu_supports ("avx2"))
+    test_d ();
+  if (__builtin_cpu_supports ("avx512f"))
+    test_e ();
+
+  return 0;
+}
+
+#include <support/test-driver.c>
@@ -0,0 +1,243 @@
+/* Test the libmvec array functions.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <array_length.h>
+#include <math.h>
+#include <mathvec.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <support/check.h>
+
+/* The accuracy of the vector variants is checked by libm-test; this
+   only checks that every element of arrays of any length and alignment
+   is computed by the right function, and that the elements after the
+   end are left alone.  */
+
+#define MAX_ULP 8
+#define MAX_N 1100
+#define GUARD 16
+#define SIZE (MAX_N + 2 * GUARD)
+
+struct func_d
+{
+  const char *name;
+  void (*array1) (double *, const double *, size_t);
+  void (*array2) (double *, const double *, const double *, size_t);
+  double (*scalar1) (double);
+  double (*scalar2) (double, double);
+  double lo;
+  double hi;
+};
+
+struct func_f
+{
+  const char *name;
+  void (*array1) (float *, const float *, size_t);
+  void (*array2) (float *, const float *, const float *, size_t);
+  float (*scalar1) (float);
+  float (*scalar2) (float, float);
+  float lo;
+  float hi;
+};
+
+#define FUNC1(name, lo, hi) { #name, v##name, NULL, name, NULL, lo, hi }
+#define FUNC2(name, lo, hi) { #name, NULL, v##name, NULL, name, lo, hi }
+
+static const struct func_d funcs_d[] =
+{
+  FUNC1 (sin, -10, 10),
+  FUNC1 (cos, -10, 10),
+  FUNC1 (tan, -10, 10),
+  FUNC1 (atan, -100, 100),
+  FUNC2 (atan2, -10, 10),
+  FUNC1 (exp, -700, 700),
+  FUNC1 (exp2, -1000, 1000),
+  FUNC1 (expm1, -30, 30),
+  FUNC1 (log, 0x1p-20, 0x1p20),
+  FUNC1 (log2, 0x1p-20, 0x1p20),
+  FUNC1 (log10, 0x1p-20, 0x1p20),
+  FUNC1 (log1p, -0.9, 100),
+  FUNC1 (sinh, -30, 30),
+  FUNC1 (cosh, -30, 30),
+  FUNC1 (tanh, -10, 10),
+  FUNC1 (cbrt, -1000, 1000),
+  FUNC1 (erf, -5, 5),
+  FUNC2 (pow, 0.5, 10),
+};
+
+static const struct func_f funcs_f[] =
+{
+  FUNC1 (sinf, -10, 10),
+  FUNC1 (cosf, -10, 10),
+  FUNC1 (tanf, -10, 10),
+  FUNC1 (atanf, -100, 100),
+  FUNC2 (atan2f, -10, 10),
+  FUNC1 (expf, -80, 80),
+  FUNC1 (exp2f, -120, 120),
+  FUNC1 (expm1f, -15, 15),
+  FUNC1 (logf, 0x1p-20, 0x1p20),
+  FUNC1 (log2f, 0x1p-20, 0x1p20),
+  FUNC1 (log10f, 0x1p-20, 0x1p20),
+  FUNC1 (log1pf, -0.9, 100),
+  FUNC1 (sinhf, -15, 15),
+  FUNC1 (coshf, -15, 15),
+  FUNC1 (tanhf, -10, 10),
+  FUNC1 (cbrtf, -1000, 1000),
+  FUNC1 (erff, -5, 5),
+  FUNC2 (powf, 0.5, 10),
+};
+
+static double in1_d[SIZE] __attribute__ ((aligned (64)));
+static double in2_d[SIZE] __attribute__ ((aligned (64)));
+static double out_d[SIZE] __attribute__ ((aligned (64)));
+static float in1_f[SIZE] __attribute__ ((aligned (64)));
+static float in2_f[SIZE] __attribute__ ((aligned (64)));
+static float out_f[SIZE] __attribute__ ((aligned (64)));
+
+static const size_t lengths[] = { 0, 1, 2, 3, 5, 7, 8, 9, 15, 16, 17, 31,
+				  33, 64, 100, 1000, MAX_N - 3 };
+
+static uint64_t
+ulps_d (double a, double b)
+{
+  int64_t ia, ib;
+  memcpy (&ia, &a, sizeof (ia));
+  memcpy (&ib, &b, sizeof (ib));
+  if (ia < 0)
+    ia = INT64_MIN - ia;
+  if (ib < 0)
+    ib = INT64_MIN - ib;
+  return ia > ib ? ia - ib : ib - ia;
+}
+
+static uint32_t
+ulps_f (float a, float b)
+{
+  int32_t ia, ib;
+  memcpy (&ia, &a, sizeof (ia));
+  memcpy (&ib, &b, sizeof (ib));
+  if (ia < 0)
+    ia = INT32_MIN - ia;
+  if (ib < 0)
+    ib = INT32_MIN - ib;
+  return ia > ib ? ia - ib : ib - ia;
+}
+
+static void
+test_d (const struct func_d *f, size_t n, size_t off, int in_place)
+{
+  double *in1 = in1_d + off;
+  double *in2 = in2_d + off;
+  double *out = in_place ? in1 : out_d + (off + 1) % 4;
+  double expect[MAX_N];
+
+  for (size_t i = 0; i < n + GUARD; i++)
+    {
+      in1[i] = f->lo + (f->hi - f->lo) * (random () / (double) RAND_MAX);
+      in2[i] = f->lo + (f->hi - f->lo) * (random () / (double) RAND_MAX);
+      if (!in_place)
+	out[i] = -1.0;
+    }
+  for (size_t i = 0; i < n; i++)
+    expect[i] = (f->scalar1 != NULL ? f->scalar1 (in1[i])
+		 : f->scalar2 (in1[i], in2[i]));
+  double guard = out[n];
+
+  if (f->array1 != NULL)
+    f->array1 (out, in1, n);
+  else
+    f->array2 (out, in1, in2, n);
+
+  for (size_t i = 0; i < n; i++)
+    if (ulps_d (out[i], expect[i]) > MAX_ULP)
+      {
+	support_record_failure ();
+	printf ("error: v%s, n %zu, offset %zu%s: element %zu is %a, "
+		"expected %a\n", f->name, n, off,
+		in_place ? ", in place" : "", i, out[i], expect[i]);
+	return;
+      }
+  if (memcmp (&out[n], &guard, sizeof (guard)) != 0)
+    {
+      support_record_failure ();
+      printf ("error: v%s, n %zu, offset %zu: wrote past the end\n",
+	      f->name, n, off);
+    }
+}
+
+static void
+test_f (const struct func_f *f, size_t n, size_t off, int in_place)
+{
+  float *in1 = in1_f + off;
+  float *in2 = in2_f + off;
+  float *out = in_place ? in1 : out_f + (off + 1) % 8;
+  float expect[MAX_N];
+
+  for (size_t i = 0; i < n + GUARD; i++)
+    {
+      in1[i] = f->lo + (f->hi - f->lo) * (random () / (double) RAND_MAX);
+      in2[i] = f->lo + (f->hi - f->lo) * (random () / (double) RAND_MAX);
+      if (!in_place)
+	out[i] = -1.0f;
+    }
+  for (size_t i = 0; i < n; i++)
+    expect[i] = (f->scalar1 != NULL ? f->scalar1 (in1[i])
+		 : f->scalar2 (in1[i], in2[i]));
+  float guard = out[n];
+
+  if (f->array1 != NULL)
+    f->array1 (out, in1, n);
+  else
+    f->array2 (out, in1, in2, n);
+
+  for (size_t i = 0; i < n; i++)
+    if (ulps_f (out[i], expect[i]) > MAX_ULP)
+      {
+	support_record_failure ();
+	printf ("error: v%s, n %zu, offset %zu%s: element %zu is %a, "
+		"expected %a\n", f->name, n, off,
+		in_place ? ", in place" : "", i, out[i], expect[i]);
+	return;
+      }
+  if (memcmp (&out[n], &guard, sizeof (guard)) != 0)
+    {
+      support_record_failure ();
+      printf ("error: v%s, n %zu, offset %zu: wrote past the end\n",
+	      f->name, n, off);
+    }
+}
+
+static int
+do_test (void)
+{
+  for (size_t l = 0; l < array_length (lengths); l++)
+    for (size_t off = 0; off < 8; off++)
+      for (int in_place = 0; in_place < 2; in_place++)
+	{
+	  for (size_t i = 0; i < array_length (funcs_d); i++)
+	    test_d (&funcs_d[i], lengths[l], off % 4, in_place);
+	  for (size_t i = 0; i < array_length (funcs_f); i++)
+	    test_f (&funcs_f[i], lengths[l], off, in_place);
+	}
+
+  return 0;
+}
+
+#include <support/test-driver.c>
@@ -0,0 +1,229 @@
+/* Bulk conversion of runs of characters in the gconv loops.  x86-64 version.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#ifndef _GCONV_BULK_H
+#define _GCONV_BULK_H	1
+
+#include <stddef.h>
+#include <emmintrin.h>
+
+/* See sysdeps/generic/gconv_bulk.h for the interface.  The blocks are
+   16 bytes of input or output, whichever is the narrower, and use only
+   SSE2, which every x86-64 processor has: the loops are bound by the
+   stores, so that wider vectors would gain little over the cost of
+   selecting them at run time.  */
+
+static inline size_t
+gconv_bulk_ascii_to_ucs4 (const unsigned char *in, unsigned char *out,
+			  size_t n)
+{
+  const __m128i zero = _mm_setzero_si128 ();
+  size_t done;
+
+  for (done = 0; done + 16 <= n; done += 16)
+    {
+      __m128i b = _mm_loadu_si128 ((const __m128i *) (in + done));
+      if (_mm_movemask_epi8 (b) != 0)
+	break;
+
+      __m128i lo = _mm_unpacklo_epi8 (b, zero);
+      __m128i hi = _mm_unpackhi_epi8 (b, zero);
+      __m128i *o = (__m128i *) (out + 4 * done);
+      _mm_storeu_si128 (o, _mm_unpacklo_epi16 (lo, zero));
+      _mm_storeu_si128 (o + 1, _mm_unpackhi_epi16 (lo, zero));
+      _mm_storeu_si128 (o + 2, _mm_unpacklo_epi16 (hi, zero));
+      _mm_storeu_si128 (o + 3, _mm_unpackhi_epi16 (hi, zero));
+    }
+
+  return done;
+}
+
+static inline size_t
+gconv_bulk_ucs4_to_ascii (const unsigned char *in, unsigned char *out,
+			  size_t n)
+{
+  const __m128i high = _mm_set1_epi32 (~0x7f);
+  const __m128i zero = _mm_setzero_si128 ();
+  size_t done;
+
+  for (done = 0; done + 16 <= n; done += 16)
+    {
+      const __m128i *i = (const __m128i *) (in + 4 * done);
+      __m128i w0 = _mm_loadu_si128 (i);
+      __m128i w1 = _mm_loadu_si128 (i + 1);
+      __m128i w2 = _mm_loadu_si128 (i + 2);
+      __m128i w3 = _mm_loadu_si128 (i + 3);
+      __m128i any = _mm_or_si128 (_mm_or_si128 (w0, w1),
+				  _mm_or_si128 (w2, w3));
+      any = _mm_cmpeq_epi32 (_mm_and_si128 (any, high), zero);
+      if (_mm_movemask_epi8 (any) != 0xffff)
+	break;
+
+      /* All values are below 0x80, so that the saturating packs do not
+	 change them.  */
+      __m128i lo = _mm_packs_epi32 (w0, w1);
+      __m128i hi = _mm_packs_epi32 (w2, w3);
+      _mm_storeu_si128 ((__m128i *) (out + done), _mm_packus_epi16 (lo, hi));
+    }
+
+  return done;
+}
+
+/* Return the eight UCS2 units at IN in host byte order.  */
+static inline __m128i
+gconv_bulk_load_ucs2 (const unsigned char *in, int swap)
+{
+  __m128i u = _mm_loadu_si128 ((const __m128i *) in);
+  if (swap)
+    u = _mm_or_si128 (_mm_slli_epi16 (u, 8), _mm_srli_epi16 (u, 8));
+  return u;
+}
+
+/* Return whether none of the eight UCS2 units in U is a surrogate.  */
+static inline int
+gconv_bulk_no_surrogate (__m128i u)
+{
+  __m128i s = _mm_cmpeq_epi16 (_mm_and_si128 (u, _mm_set1_epi16 (0xf800)),
+			       _mm_set1_epi16 (0xd800));
+  return _mm_movemask_epi8 (s) == 0;
+}
+
+static inline size_t
+gconv_bulk_ucs2_to_ucs4 (const unsigned char *in, unsigned char *out,
+			 size_t n, int swap)
+{
+  const __m128i zero = _mm_setzero_si128 ();
+  size_t done;
+
+  for (done = 0; done + 8 <= n; done += 8)
+    {
+      __m128i u = gconv_bulk_load_ucs2 (in + 2 * done, swap);
+      if (!gconv_bulk_no_surrogate (u))
+	break;
+
+      __m128i *o = (__m128i *) (out + 4 * done);
+      _mm_storeu_si128 (o, _mm_unpacklo_epi16 (u, zero));
+      _mm_storeu_si128 (o + 1, _mm_unpackhi_epi16 (u, zero));
+    }
+
+  return done;
+}
+
+static inline size_t
+gconv_bulk_ucs4_to_ucs2 (const unsigned char *in, unsigned char *out,
+			 size_t n, int swap)
+{
+  const __m128i bias32 = _mm_set1_epi32 (0x8000);
+  const __m128i bias16 = _mm_set1_epi16 (0x8000);
+  const __m128i zero = _mm_setzero_si128 ();
+  size_t done;
+
+  for (done = 0; done + 8 <= n; done += 8)
+    {
+      const __m128i *i = (const __m128i *) (in + 4 * done);
+      __m128i w0 = _mm_loadu_si128 (i);
+      __m128i w1 = _mm_loadu_si128 (i + 1);
+      __m128i big = _mm_srli_epi32 (_mm_or_si128 (w0, w1), 16);
+      if (_mm_movemask_epi8 (_mm_cmpeq_epi32 (big, zero)) != 0xffff)
+	break;
+
+      /* SSE2 only has a signed saturating pack; bias the values into
+	 its range and back.  */
+      __m128i u = _mm_packs_epi32 (_mm_sub_epi32 (w0, bias32),
+				   _mm_sub_epi32 (w1, bias32));
+      u = _mm_xor_si128 (u, bias16);
+      if (!gconv_bulk_no_surrogate (u))
+	break;
+
+      if (swap)
+	u = _mm_or_si128 (_mm_slli_epi16 (u, 8), _mm_srli_epi16 (u, 8));
+      _mm_storeu_si128 ((__m128i *) (out + 2 * done), u);
+    }
+
+  return done;
+}
+
+static inline size_t
+gconv_bulk_ascii_copy (const unsigned char *in, unsigned char *out, size_t n)
+{
+  size_t done;
+
+  for (done = 0; done + 16 <= n; done += 16)
+    {
+      __m128i b = _mm_loadu_si128 ((const __m128i *) (in + done));
+      if (_mm_movemask_epi8 (b) != 0)
+	break;
+
+      _mm_storeu_si128 ((__m128i *) (out + done), b);
+    }
+
+  return done;
+}
+
+static inline size_t
+gconv_bulk_ascii_to_ucs2 (const unsigned char *in, unsigned char *out,
+			  size_t n, int swap)
+{
+  const __m128i zero = _mm_setzero_si128 ();
+  size_t done;
+
+  for (done = 0; done + 16 <= n; done += 16)
+    {
+      __m128i b = _mm_loadu_si128 ((const __m128i *) (in + done));
+      if (_mm_movemask_epi8 (b) != 0)
+	break;
+
+      __m128i *o = (__m128i *) (out + 2 * done);
+      if (swap)
+	{
+	  _mm_storeu_si128 (o, _mm_unpacklo_epi8 (zero, b));
+	  _mm_storeu_si128 (o + 1, _mm_unpackhi_epi8 (zero, b));
+	}
+      else
+	{
+	  _mm_storeu_si128 (o, _mm_unpacklo_epi8 (b, zero));
+	  _mm_storeu_si128 (o + 1, _mm_unpackhi_epi8 (b, zero));
+	}
+    }
+
+  return done;
+}
+
+static inline size_t
+gconv_bulk_ucs2_to_ascii (const unsigned char *in, unsigned char *out,
+			  size_t n, int swap)
+{
+  const __m128i high = _mm_set1_epi16 (~0x7f);
+  const __m128i zero = _mm_setzero_si128 ();
+  size_t done;
+
+  for (done = 0; done + 16 <= n; done += 16)
+    {
+      __m128i lo = gconv_bulk_load_ucs2 (in + 2 * done, swap);
+      __m128i hi = gconv_bulk_load_ucs2 (in + 2 * done + 16, swap);
+      __m128i any = _mm_and_si128 (_mm_or_si128 (lo, hi), high);
+      if (_mm_movemask_epi8 (_mm_cmpeq_epi16 (any, zero)) != 0xffff)
+	break;
+
+      _mm_storeu_si128 ((__m128i *) (out + done), _mm_packus_epi16 (lo, hi));
+    }
+
+  return done;
+}
+
+#endif /* gconv_bulk.h */
@@ -1,5 +1,5 @@
-/* Function expf vectorized with SSE2.
-   Copyright (C) 2014-2020 Free Software Foundation, Inc.
+/* ChaCha20 block function optimized with SSE2.
+   Copyright (C) 2020 Free Software Foundation, Inc.
    This file is part of the GNU C Library.
 
    The GNU C Library is free software; you can redistribute it and/or
@@ -16,15 +16,12 @@
    License along with the GNU C Library; if not, see
    <https://www.gnu.org/licenses/>.  */
 
+#if IS_IN (libc)
+# include <stdlib/chacha20.h>
 
-#include <sysdep.h>
-#include "svml_s_wrapper_impl.h"
+# define CHACHA20_BLOCKS __chacha20_blocks_sse2
 
-	.text
-ENTRY (_ZGVbN4v_expf)
-WRAPPER_IMPL_SSE2 expf
-END (_ZGVbN4v_expf)
-
-#ifndef USE_MULTIARCH
- libmvec_hidden_def (_ZGVbN4v_expf)
+extern __typeof (__chacha20_blocks) __chacha20_blocks_sse2 attribute_hidden;
 #endif
+
+#include <stdlib/chacha20.c>
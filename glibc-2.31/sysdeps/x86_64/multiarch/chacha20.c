@@ -0,0 +1,48 @@
+/* Multiple versions of the ChaCha20 block function.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+/* Define multiple versions only for the definition in libc.  */
+#if IS_IN (libc)
+# define __chacha20_blocks __redirect___chacha20_blocks
+# include <stdlib/chacha20.h>
+# undef __chacha20_blocks
+
+# include <init-arch.h>
+
+extern __typeof (__redirect___chacha20_blocks) __chacha20_blocks_sse2
+  attribute_hidden;
+extern __typeof (__redirect___chacha20_blocks) __chacha20_blocks_avx2
+  attribute_hidden;
+
+static inline void *
+IFUNC_SELECTOR (void)
+{
+  const struct cpu_features* cpu_features = __get_cpu_features ();
+
+  if (!CPU_FEATURES_ARCH_P (cpu_features, Prefer_No_VZEROUPPER)
+      && CPU_FEATURES_ARCH_P (cpu_features, AVX2_Usable))
+    return __chacha20_blocks_avx2;
+
+  return __chacha20_blocks_sse2;
+}
+
+extern __typeof (__redirect___chacha20_blocks) __chacha20_blocks
+  attribute_hidden;
+libc_ifunc_redirected (__redirect___chacha20_blocks, __chacha20_blocks,
+		       IFUNC_SELECTOR ());
+#endif
@@ -0,0 +1,34 @@
+/* random64_fill_r and random64_fill_double_r optimized with AVX2.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#if IS_IN (libc)
+# include <stdlib.h>
+
+# define RANDOM64_FILL __random64_fill_r_avx2
+# define RANDOM64_FILL_DOUBLE __random64_fill_double_r_avx2
+
+extern __typeof (random64_fill_r) __random64_fill_r_avx2;
+extern __typeof (random64_fill_double_r) __random64_fill_double_r_avx2;
+
+# undef libc_hidden_def
+# define libc_hidden_def(name)
+# undef weak_alias
+# define weak_alias(name, aliasname)
+#endif
+
+#include <stdlib/random64_fill.c>
@@ -0,0 +1,69 @@
+/* Multiple versions of random64_fill_r and random64_fill_double_r.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+/* Define multiple versions only for the definition in libc.  */
+#if IS_IN (libc)
+# define __random64_fill_r __redirect___random64_fill_r
+# define __random64_fill_double_r __redirect___random64_fill_double_r
+# include <stdlib.h>
+# undef __random64_fill_r
+# undef __random64_fill_double_r
+
+# include <init-arch.h>
+
+extern __typeof (__redirect___random64_fill_r) __random64_fill_r_sse2
+  attribute_hidden;
+extern __typeof (__redirect___random64_fill_r) __random64_fill_r_avx2
+  attribute_hidden;
+extern __typeof (__redirect___random64_fill_double_r)
+  __random64_fill_double_r_sse2 attribute_hidden;
+extern __typeof (__redirect___random64_fill_double_r)
+  __random64_fill_double_r_avx2 attribute_hidden;
+
+/* The AVX2 versions keep the state of all four lanes of the generic
+   code in vector registers.  */
+static inline int
+use_avx2 (void)
+{
+  const struct cpu_features* cpu_features = __get_cpu_features ();
+
+  return (!CPU_FEATURES_ARCH_P (cpu_features, Prefer_No_VZEROUPPER)
+	  && CPU_FEATURES_ARCH_P (cpu_features, AVX2_Usable));
+}
+
+libc_ifunc_redirected (__redirect___random64_fill_r, __random64_fill_r,
+		       use_avx2 ()
+		       ? __random64_fill_r_avx2 : __random64_fill_r_sse2);
+weak_alias (__random64_fill_r, random64_fill_r)
+
+libc_ifunc_redirected (__redirect___random64_fill_double_r,
+		       __random64_fill_double_r,
+		       use_avx2 ()
+		       ? __random64_fill_double_r_avx2
+		       : __random64_fill_double_r_sse2);
+weak_alias (__random64_fill_double_r, random64_fill_double_r)
+
+# ifdef SHARED
+__hidden_ver1 (__random64_fill_r, __GI___random64_fill_r,
+	       __redirect___random64_fill_r)
+  __attribute__ ((visibility ("hidden")));
+__hidden_ver1 (__random64_fill_double_r, __GI___random64_fill_double_r,
+	       __redirect___random64_fill_double_r)
+  __attribute__ ((visibility ("hidden")));
+# endif
+#endif
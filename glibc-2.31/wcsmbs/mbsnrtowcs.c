@@ -20,6 +20,7 @@
 #include <dlfcn.h>
 #include <errno.h>
 #include <gconv.h>
+#include <stdint.h>
 #include <string.h>
 #include <wchar.h>
 #include <wcsmbsload.h>
@@ -69,6 +70,7 @@ __mbsnrtowcs (wchar_t *dst, const char **src, size_t nmc, size_t len,
   if (towc->__shlib_handle != NULL)
     PTR_DEMANGLE (fct);
 #endif
+  enum wcsmbs_direct direct = wcsmbs_direct_towc (fct, data.__statep);
 
   /* We have to handle DST == NULL special.  */
   if (dst == NULL)
@@ -81,6 +83,10 @@ __mbsnrtowcs (wchar_t *dst, const char **src, size_t nmc, size_t len,
       data.__statep = &temp_state;
 
       result = 0;
+      if (direct != wcsmbs_direct_none)
+	result = __wcsmbs_direct_towcs (NULL, &inbuf, srcend - 1, SIZE_MAX,
+					direct);
+
       data.__outbufend = (unsigned char *) buf + sizeof (buf);
       do
 	{
@@ -106,6 +112,12 @@ __mbsnrtowcs (wchar_t *dst, const char **src, size_t nmc, size_t len,
       data.__outbuf = (unsigned char *) dst;
       data.__outbufend = data.__outbuf + len * sizeof (wchar_t);
 
+      if (direct != wcsmbs_direct_none)
+	data.__outbuf += (__wcsmbs_direct_towcs (dst,
+						 (const unsigned char **) src,
+						 srcend - 1, len, direct)
+			  * sizeof (wchar_t));
+
       status = DL_CALL_FCT (fct,
 			    (towc, &data, (const unsigned char **) src, srcend,
 			     NULL, &dummy, 0, 1));
@@ -23,6 +23,7 @@
 #include <dlfcn.h>
 #include <errno.h>
 #include <gconv.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 #include <wchar.h>
@@ -63,6 +64,7 @@ __mbsrtowcs_l (wchar_t *dst, const char **src, size_t len, mbstate_t *ps,
   if (towc->__shlib_handle != NULL)
     PTR_DEMANGLE (fct);
 #endif
+  enum wcsmbs_direct direct = wcsmbs_direct_towc (fct, ps);
 
   /* We have to handle DST == NULL special.  */
   if (dst == NULL)
@@ -76,6 +78,10 @@ __mbsrtowcs_l (wchar_t *dst, const char **src, size_t len, mbstate_t *ps,
       data.__statep = &temp_state;
 
       result = 0;
+      if (direct != wcsmbs_direct_none)
+	result = __wcsmbs_direct_towcs (NULL, &inbuf, srcend - 1, SIZE_MAX,
+					direct);
+
       data.__outbufend = (unsigned char *) buf + sizeof (buf);
       do
 	{
@@ -107,6 +113,17 @@ __mbsrtowcs_l (wchar_t *dst, const char **src, size_t len, mbstate_t *ps,
       data.__outbuf = (unsigned char *) dst;
       data.__outbufend = data.__outbuf + len * sizeof (wchar_t);
 
+      if (direct != wcsmbs_direct_none)
+	{
+	  /* No character takes more than four bytes here.  */
+	  srcend = srcp + __strnlen ((const char *) srcp,
+				     len > SIZE_MAX / 4 ? SIZE_MAX : 4 * len);
+	  size_t done = __wcsmbs_direct_towcs (dst, &srcp, srcend, len,
+					       direct);
+	  data.__outbuf = (unsigned char *) (dst + done);
+	  len -= done;
+	}
+
       status = __GCONV_FULL_OUTPUT;
 
       while (len > 0)
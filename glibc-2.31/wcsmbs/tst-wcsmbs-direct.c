@@ -0,0 +1,252 @@
+/* Test the string conversions against mbrtowc and wcrtomb.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+/* In the UTF-8 and ASCII locales, mbsrtowcs, mbsnrtowcs, wcsrtombs and
+   wcsnrtombs convert the text themselves up to the first character
+   which needs the gconv step, while mbrtowc and wcrtomb always use the
+   step.  Compare them on random text with errors and short buffers.  */
+
+#include <errno.h>
+#include <locale.h>
+#include <stdlib.h>
+#include <string.h>
+#include <wchar.h>
+#include <sys/param.h>
+
+#include <support/check.h>
+
+#define MAXCHARS 100
+
+static const char *const locales[] =
+  { "C", "en_US.ANSI_X3.4-1968", "de_DE.UTF-8", "de_DE.ISO-8859-1" };
+
+/* The characters of the random text, besides ASCII letters.  */
+static const wchar_t others[] =
+  { L'\xe9', L'\xdf', L'\x20ac', L'\x4e2d', L'\x1f600', L'\x10ffff' };
+
+/* The text and its conversion with mbrtowc.  */
+static char text[MAXCHARS * 4 + 1];
+static size_t text_len;
+static wchar_t wide[MAXCHARS + 1];
+/* The number of characters before the end or the first error, and
+   the offsets of their ends.  */
+static size_t nwide;
+static size_t ends[MAXCHARS + 1];
+static int illegal;
+
+static void
+make_text (int bad)
+{
+  size_t nchars = random () % MAXCHARS;
+  mbstate_t st;
+
+  text_len = 0;
+  for (size_t i = 0; i < nchars; ++i)
+    {
+      long int r = random ();
+      if (r % 4 != 0)
+	text[text_len++] = 'a' + r % 26;
+      else if (bad && r % 64 == 4)
+	/* A stray continuation byte or a truncated sequence.  */
+	text[text_len++] = r % 128 == 4 ? '\x80' : '\xe4';
+      else
+	{
+	  memset (&st, '\0', sizeof (st));
+	  size_t n = wcrtomb (text + text_len, others[r % 6], &st);
+	  if (n != (size_t) -1)
+	    text_len += n;
+	}
+    }
+  text[text_len] = '\0';
+
+  memset (&st, '\0', sizeof (st));
+  nwide = 0;
+  illegal = 0;
+  for (size_t off = 0; off < text_len; )
+    {
+      size_t n = mbrtowc (&wide[nwide], text + off, text_len - off, &st);
+      if (n == (size_t) -1 || n == (size_t) -2)
+	{
+	  illegal = 1;
+	  break;
+	}
+      off += n;
+      ends[nwide++] = off;
+    }
+  wide[nwide] = L'\0';
+}
+
+static void
+check_towcs (void)
+{
+  wchar_t buf[MAXCHARS + 1];
+  const char *src;
+  mbstate_t st;
+
+  memset (&st, '\0', sizeof (st));
+  src = text;
+  errno = 0;
+  size_t n = mbsrtowcs (NULL, &src, 0, &st);
+  if (illegal)
+    {
+      TEST_COMPARE (n, (size_t) -1);
+      TEST_COMPARE (errno, EILSEQ);
+    }
+  else
+    TEST_COMPARE (n, nwide);
+  TEST_VERIFY (src == text);
+
+  for (size_t len = 0; len <= nwide + 1; ++len)
+    {
+      memset (&st, '\0', sizeof (st));
+      src = text;
+      errno = 0;
+      n = mbsrtowcs (buf, &src, len, &st);
+      if (len <= nwide)
+	{
+	  TEST_COMPARE (n, len);
+	  TEST_VERIFY (src == text + (len == 0 ? 0 : ends[len - 1]));
+	}
+      else if (illegal)
+	{
+	  TEST_COMPARE (n, (size_t) -1);
+	  TEST_COMPARE (errno, EILSEQ);
+	}
+      else
+	{
+	  TEST_COMPARE (n, nwide);
+	  TEST_VERIFY (src == NULL);
+	  TEST_VERIFY (buf[nwide] == L'\0');
+	}
+      TEST_COMPARE_BLOB (buf, MIN (len, nwide) * sizeof (wchar_t),
+			 wide, MIN (len, nwide) * sizeof (wchar_t));
+    }
+
+  /* Stop the input at the end of each character.  */
+  for (size_t i = 0; i < nwide; ++i)
+    {
+      memset (&st, '\0', sizeof (st));
+      src = text;
+      n = mbsnrtowcs (buf, &src, ends[i], MAXCHARS + 1, &st);
+      TEST_COMPARE (n, i + 1);
+      TEST_VERIFY (src == text + ends[i]);
+      TEST_COMPARE_BLOB (buf, n * sizeof (wchar_t), wide,
+			 n * sizeof (wchar_t));
+
+      memset (&st, '\0', sizeof (st));
+      src = text;
+      TEST_COMPARE (mbsnrtowcs (NULL, &src, ends[i], 0, &st), i + 1);
+    }
+}
+
+static void
+check_tombs (void)
+{
+  char buf[MAXCHARS * 4 + 1];
+  const wchar_t *src;
+  mbstate_t st;
+  /* The length of the text converted back, which is that of the
+     characters before an error.  */
+  size_t mblen = nwide == 0 ? 0 : ends[nwide - 1];
+
+  memset (&st, '\0', sizeof (st));
+  src = wide;
+  TEST_COMPARE (wcsrtombs (NULL, &src, 0, &st), mblen);
+
+  for (size_t len = 0; len <= mblen + 1; ++len)
+    {
+      memset (&st, '\0', sizeof (st));
+      src = wide;
+      size_t n = wcsrtombs (buf, &src, len, &st);
+      if (len > mblen)
+	{
+	  TEST_COMPARE (n, mblen);
+	  TEST_VERIFY (src == NULL);
+	}
+      else
+	{
+	  /* Only whole characters are stored.  */
+	  size_t i = 0;
+	  while (i < nwide && ends[i] <= len)
+	    ++i;
+	  TEST_COMPARE (n, i == 0 ? 0 : ends[i - 1]);
+	  TEST_VERIFY (src == wide + i);
+	}
+      TEST_COMPARE_BLOB (buf, MIN (n, mblen), text, MIN (n, mblen));
+    }
+
+  for (size_t i = 0; i < nwide; ++i)
+    {
+      memset (&st, '\0', sizeof (st));
+      src = wide;
+      size_t n = wcsnrtombs (buf, &src, i + 1, sizeof (buf), &st);
+      TEST_COMPARE (n, ends[i]);
+      TEST_VERIFY (src == wide + i + 1);
+      TEST_COMPARE_BLOB (buf, n, text, ends[i]);
+
+      memset (&st, '\0', sizeof (st));
+      src = wide;
+      TEST_COMPARE (wcsnrtombs (NULL, &src, i + 1, 0, &st), ends[i]);
+    }
+
+  /* A character which the charset lacks.  */
+  wchar_t bad[] = { L'a', L'b', L'\xd800', L'c', L'\0' };
+  memset (&st, '\0', sizeof (st));
+  src = bad;
+  errno = 0;
+  TEST_COMPARE (wcsrtombs (buf, &src, sizeof (buf), &st), (size_t) -1);
+  TEST_COMPARE (errno, EILSEQ);
+  TEST_VERIFY (src == bad + 2);
+}
+
+static int
+do_test (void)
+{
+  for (size_t l = 0; l < sizeof (locales) / sizeof (locales[0]); ++l)
+    {
+      if (setlocale (LC_ALL, locales[l]) == NULL)
+	FAIL_EXIT1 ("setlocale (LC_ALL, \"%s\") failed", locales[l]);
+
+      srandom (l);
+      for (int i = 0; i < 500; ++i)
+	{
+	  make_text (i % 2);
+	  check_towcs ();
+	  check_tombs ();
+	}
+
+      /* A character started with mbrtowc is finished by mbsrtowcs
+	 through the gconv step.  */
+      if (MB_CUR_MAX > 1)
+	{
+	  mbstate_t st;
+	  wchar_t wc;
+	  memset (&st, '\0', sizeof (st));
+	  TEST_COMPARE (mbrtowc (&wc, "\xc3", 1, &st), (size_t) -2);
+	  const char *src = "\xa9xyz";
+	  wchar_t buf[8];
+	  TEST_COMPARE (mbsrtowcs (buf, &src, 8, &st), 4);
+	  TEST_COMPARE_BLOB (buf, 5 * sizeof (wchar_t), L"\xe9xyz",
+			     5 * sizeof (wchar_t));
+	}
+    }
+
+  return 0;
+}
+
+#include <support/test-driver.c>
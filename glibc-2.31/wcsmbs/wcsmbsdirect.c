@@ -0,0 +1,193 @@
+/* Direct conversion of strings in UTF-8 and ASCII locales.
+   Copyright (C) 2020 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+#include <array_length.h>
+#include <stdint.h>
+#include <sys/param.h>
+#include <wchar.h>
+#include <wcsmbsload.h>
+#include <gconv_bulk.h>
+
+
+/* The characters are checked as in the UTF-8 converters of
+   gconv_simple.c, which the callers use for everything else: only the
+   well-formed sequences of at most four bytes and the Unicode
+   characters are converted here, and the first character of another
+   kind ends the conversion.  */
+
+/* After a bulk conversion stopped at a block with a character it does
+   not handle, the number of characters converted one at a time before
+   it is tried again, which covers the block.  */
+#define BULK_RETRY	16
+
+size_t
+__wcsmbs_direct_towcs (wchar_t *dst, const unsigned char **srcp,
+		       const unsigned char *srcend, size_t len,
+		       enum wcsmbs_direct direct)
+{
+  const unsigned char *inptr = *srcp;
+  wchar_t buf[64];
+  size_t done = 0;
+
+  while (inptr < srcend && done < len)
+    {
+      /* Convert runs of ASCII characters in blocks, into BUF if they
+	 are only counted.  */
+      size_t n = MIN ((size_t) (srcend - inptr), len - done);
+      wchar_t *outptr = buf;
+      if (dst != NULL)
+	outptr = dst + done;
+      else
+	n = MIN (n, array_length (buf));
+      n = gconv_bulk_ascii_to_ucs4 (inptr, (unsigned char *) outptr, n);
+      inptr += n;
+      done += n;
+
+      /* Convert the block where that stopped one character at a
+	 time.  */
+      const unsigned char *blockend = inptr + MIN (BULK_RETRY,
+						   srcend - inptr);
+      while (inptr < blockend && done < len)
+	{
+	  uint32_t ch = inptr[0];
+	  size_t cnt;
+
+	  if (ch < 0x80)
+	    cnt = 1;
+	  else if (direct == wcsmbs_direct_ascii)
+	    goto out;
+	  else if (ch >= 0xc2 && ch < 0xe0 && srcend - inptr >= 2
+		   && (inptr[1] & 0xc0) == 0x80)
+	    {
+	      ch = ((ch & 0x1f) << 6) | (inptr[1] & 0x3f);
+	      cnt = 2;
+	    }
+	  else if ((ch & 0xf0) == 0xe0 && srcend - inptr >= 3
+		   && (inptr[1] & 0xc0) == 0x80 && (inptr[2] & 0xc0) == 0x80)
+	    {
+	      ch = (((ch & 0x0f) << 12) | ((inptr[1] & 0x3f) << 6)
+		    | (inptr[2] & 0x3f));
+	      if (ch < 0x800 || (ch >= 0xd800 && ch <= 0xdfff))
+		goto out;
+	      cnt = 3;
+	    }
+	  else if ((ch & 0xf8) == 0xf0 && srcend - inptr >= 4
+		   && (inptr[1] & 0xc0) == 0x80 && (inptr[2] & 0xc0) == 0x80
+		   && (inptr[3] & 0xc0) == 0x80)
+	    {
+	      ch = (((ch & 0x07) << 18) | ((inptr[1] & 0x3f) << 12)
+		    | ((inptr[2] & 0x3f) << 6) | (inptr[3] & 0x3f));
+	      if (ch < 0x10000)
+		goto out;
+	      cnt = 4;
+	    }
+	  else
+	    goto out;
+
+	  if (dst != NULL)
+	    dst[done] = ch;
+	  ++done;
+	  inptr += cnt;
+	}
+    }
+
+ out:
+  *srcp = inptr;
+  return done;
+}
+
+
+size_t
+__wcsmbs_direct_tombs (unsigned char *dst, const wchar_t **srcp,
+		       const wchar_t *srcend, size_t len,
+		       enum wcsmbs_direct direct)
+{
+  const wchar_t *inptr = *srcp;
+  unsigned char buf[256];
+  size_t done = 0;
+
+  while (inptr < srcend && done < len)
+    {
+      /* Convert runs of ASCII characters in blocks, into BUF if they
+	 are only counted.  */
+      size_t n = MIN ((size_t) (srcend - inptr), len - done);
+      unsigned char *outptr = buf;
+      if (dst != NULL)
+	outptr = dst + done;
+      else
+	n = MIN (n, sizeof (buf));
+      n = gconv_bulk_ucs4_to_ascii ((const unsigned char *) inptr, outptr,
+				    n);
+      inptr += n;
+      done += n;
+
+      /* Convert the block where that stopped one character at a
+	 time.  */
+      const wchar_t *blockend = inptr + MIN (BULK_RETRY, srcend - inptr);
+      while (inptr < blockend)
+	{
+	  uint32_t wc = *inptr;
+	  size_t cnt;
+
+	  if (wc < 0x80)
+	    cnt = 1;
+	  else if (direct == wcsmbs_direct_ascii)
+	    goto out;
+	  else if (wc < 0x800)
+	    cnt = 2;
+	  else if (wc < 0x10000)
+	    {
+	      if (wc >= 0xd800 && wc <= 0xdfff)
+		goto out;
+	      cnt = 3;
+	    }
+	  else if (wc <= 0x10ffff)
+	    cnt = 4;
+	  else
+	    goto out;
+
+	  if (len - done < cnt)
+	    goto out;
+
+	  if (dst != NULL)
+	    {
+	      outptr = dst + done;
+	      if (cnt == 1)
+		outptr[0] = wc;
+	      else
+		{
+		  static const unsigned char lead[] =
+		    { 0, 0, 0xc0, 0xe0, 0xf0 };
+
+		  for (size_t i = cnt - 1; i > 0; --i)
+		    {
+		      outptr[i] = 0x80 | (wc & 0x3f);
+		      wc >>= 6;
+		    }
+		  outptr[0] = lead[cnt] | wc;
+		}
+	    }
+	  done += cnt;
+	  ++inptr;
+	}
+    }
+
+ out:
+  *srcp = inptr;
+  return done;
+}
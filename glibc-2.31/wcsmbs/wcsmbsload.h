@@ -76,4 +76,58 @@ get_gconv_fcts (struct __locale_data *data)
   return data->private.ctype;
 }
 
+
+/* The conversions which the string functions do themselves in the
+   UTF-8 and ASCII locales, up to the first character which needs the
+   gconv step.  */
+enum wcsmbs_direct
+  {
+    wcsmbs_direct_none,
+    wcsmbs_direct_utf8,
+    wcsmbs_direct_ascii
+  };
+
+/* Return the direct conversion which can replace the step with the
+   function FCT converting to wide characters from state PS.  */
+static inline enum wcsmbs_direct
+wcsmbs_direct_towc (__gconv_fct fct, const mbstate_t *ps)
+{
+  if (ps->__count != 0)
+    return wcsmbs_direct_none;
+  if (fct == __gconv_transform_utf8_internal)
+    return wcsmbs_direct_utf8;
+  if (fct == __gconv_transform_ascii_internal)
+    return wcsmbs_direct_ascii;
+  return wcsmbs_direct_none;
+}
+
+/* Likewise for the step converting from wide characters.  */
+static inline enum wcsmbs_direct
+wcsmbs_direct_tomb (__gconv_fct fct, const mbstate_t *ps)
+{
+  if (ps->__count != 0)
+    return wcsmbs_direct_none;
+  if (fct == __gconv_transform_internal_utf8)
+    return wcsmbs_direct_utf8;
+  if (fct == __gconv_transform_internal_ascii)
+    return wcsmbs_direct_ascii;
+  return wcsmbs_direct_none;
+}
+
+/* Convert the characters from *SRCP up to SRCEND, which contains no NUL
+   byte, to at most LEN wide characters at DST, or only count them if
+   DST is NULL, as long as DIRECT handles them.  Advance *SRCP past the
+   characters converted and return their number.  */
+extern size_t __wcsmbs_direct_towcs (wchar_t *dst, const unsigned char **srcp,
+				     const unsigned char *srcend, size_t len,
+				     enum wcsmbs_direct direct)
+     attribute_hidden;
+
+/* Likewise from the wide characters at *SRCP to at most LEN bytes at
+   DST, and return the number of bytes.  */
+extern size_t __wcsmbs_direct_tombs (unsigned char *dst, const wchar_t **srcp,
+				     const wchar_t *srcend, size_t len,
+				     enum wcsmbs_direct direct)
+     attribute_hidden;
+
 #endif	/* wcsmbsload.h */
@@ -20,6 +20,7 @@
 #include <dlfcn.h>
 #include <errno.h>
 #include <gconv.h>
+#include <stdint.h>
 #include <wchar.h>
 #include <wcsmbsload.h>
 
@@ -67,6 +68,7 @@ __wcsnrtombs (char *dst, const wchar_t **src, size_t nwc, size_t len,
   if (tomb->__shlib_handle != NULL)
     PTR_DEMANGLE (fct);
 #endif
+  enum wcsmbs_direct direct = wcsmbs_direct_tomb (fct, data.__statep);
 
   /* We have to handle DST == NULL special.  */
   if (dst == NULL)
@@ -80,6 +82,10 @@ __wcsnrtombs (char *dst, const wchar_t **src, size_t nwc, size_t len,
       data.__statep = &temp_state;
 
       result = 0;
+      if (direct != wcsmbs_direct_none)
+	result = __wcsmbs_direct_tombs (NULL, (const wchar_t **) &inbuf,
+					srcend - 1, SIZE_MAX, direct);
+
       data.__outbufend = buf + sizeof (buf);
 
       do
@@ -110,6 +116,10 @@ __wcsnrtombs (char *dst, const wchar_t **src, size_t nwc, size_t len,
       data.__outbuf = (unsigned char *) dst;
       data.__outbufend = (unsigned char *) dst + len;
 
+      if (direct != wcsmbs_direct_none)
+	data.__outbuf += __wcsmbs_direct_tombs ((unsigned char *) dst, src,
+						srcend - 1, len, direct);
+
       status = DL_CALL_FCT (fct, (tomb, &data, (const unsigned char **) src,
 				  (const unsigned char *) srcend, NULL,
 				  &dummy, 0, 1));
@@ -21,6 +21,7 @@
 #include <errno.h>
 #include <stdlib.h>
 #include <gconv.h>
+#include <stdint.h>
 #include <wchar.h>
 #include <wcsmbsload.h>
 
@@ -59,6 +60,7 @@ __wcsrtombs (char *dst, const wchar_t **src, size_t len, mbstate_t *ps)
   if (tomb->__shlib_handle != NULL)
     PTR_DEMANGLE (fct);
 #endif
+  enum wcsmbs_direct direct = wcsmbs_direct_tomb (fct, data.__statep);
 
   /* We have to handle DST == NULL special.  */
   if (dst == NULL)
@@ -73,6 +75,10 @@ __wcsrtombs (char *dst, const wchar_t **src, size_t len, mbstate_t *ps)
       data.__statep = &temp_state;
 
       result = 0;
+      if (direct != wcsmbs_direct_none)
+	result = __wcsmbs_direct_tombs (NULL, (const wchar_t **) &inbuf,
+					srcend - 1, SIZE_MAX, direct);
+
       data.__outbufend = buf + sizeof (buf);
 
       do
@@ -107,6 +113,10 @@ __wcsrtombs (char *dst, const wchar_t **src, size_t len, mbstate_t *ps)
       data.__outbuf = (unsigned char *) dst;
       data.__outbufend = (unsigned char *) dst + len;
 
+      if (direct != wcsmbs_direct_none)
+	data.__outbuf += __wcsmbs_direct_tombs ((unsigned char *) dst, src,
+						srcend - 1, len, direct);
+
       status = DL_CALL_FCT (fct, (tomb, &data, (const unsigned char **) src,
 				  (const unsigned char *) srcend, NULL,
 				  &dummy, 0, 1));